@@ -0,0 +1,60 @@
+#!/usr/bin/env python
+
+import argparse
+import json
+import sys
+
+parser = argparse.ArgumentParser(
+    description="""
+Compares two result files written by clingo-bench and reports regressions.
+The exit code is non-zero if a measurement of the new run exceeds the old one
+by more than the given threshold.
+"""
+)
+parser.add_argument("old", help="results of the baseline")
+parser.add_argument("new", help="results to compare against the baseline")
+parser.add_argument(
+    "-t",
+    "--threshold",
+    type=float,
+    default=0.1,
+    help="relative increase flagged as regression (default: 0.1)",
+)
+parser.add_argument(
+    "-m",
+    "--min-time",
+    type=float,
+    default=0.05,
+    help="ignore time measurements below this many seconds (default: 0.05)",
+)
+args = parser.parse_args()
+
+KEYS = ["parse", "ground", "solve", "atoms", "peak_rss"]
+TIMES = {"parse", "ground", "solve"}
+
+with open(args.old, encoding="utf-8") as f:
+    old = json.load(f)
+with open(args.new, encoding="utf-8") as f:
+    new = json.load(f)
+
+if old["size"] != new["size"]:
+    sys.stderr.write("warning: comparing results for different sizes\n")
+
+regressions = 0
+print(f"{'instance':<12} {'key':<9} {'old':>12} {'new':>12} {'change':>8}")
+for name, old_res in old["instances"].items():
+    new_res = new["instances"].get(name)
+    if new_res is None:
+        continue
+    for key in KEYS:
+        a, b = old_res[key], new_res[key]
+        change = (b - a) / a if a > 0 else 0.0
+        flag = ""
+        if change > args.threshold and (key not in TIMES or b >= args.min_time):
+            flag = " !"
+            regressions += 1
+        print(f"{name:<12} {key:<9} {a:>12.4g} {b:>12.4g} {change:>+8.1%}{flag}")
+
+if regressions > 0:
+    print(f"\n{regressions} regression(s) found")
+    sys.exit(1)
@@ -0,0 +1,309 @@
+// {{{ MIT License
+
+// Copyright 2024 Roland Kaminski
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// }}}
+
+#include <clingo.hh>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace {
+
+using namespace Clingo;
+
+// {{{1 instances
+
+// Each instance is a program generated for a given size. Multi-shot instances
+// additionally ground and solve the step/1 part for the given number of steps.
+struct Instance {
+    char const *name;
+    std::string (*program)(unsigned size);
+    unsigned (*steps)(unsigned size);
+};
+
+std::string join(unsigned size) {
+    std::ostringstream oss;
+    oss << "node(1.." << size << ").\n"
+        << "edge(X,(X*7+3)\\" << size << "+1) :- node(X).\n"
+        << "edge(X,(X*13+5)\\" << size << "+1) :- node(X).\n"
+        << "edge(X,(X*31+11)\\" << size << "+1) :- node(X).\n"
+        << "{ sel(X,Y) } :- edge(X,Y).\n"
+        << "path(X,Z) :- sel(X,Y), sel(Y,Z).\n"
+        << "triangle(X,Y,Z) :- edge(X,Y), edge(Y,Z), edge(Z,X), X < Y, X < Z.\n";
+    return oss.str();
+}
+
+std::string aggregate(unsigned size) {
+    std::ostringstream oss;
+    oss << "p(1.." << size << ").\n"
+        << "{ q(X) } :- p(X).\n"
+        << "c(X) :- p(X), #count { Y : q(Y), Y < X } >= X / 2.\n"
+        << "s(X) :- p(X), #sum { Y,Z : q(Y), p(Z), Z = Y+X } <= X.\n";
+    return oss.str();
+}
+
+std::string recursive(unsigned size) {
+    std::ostringstream oss;
+    oss << "node(1.." << size << ").\n"
+        << "edge(X,X+1) :- node(X), node(X+1).\n"
+        << "edge(X,X*2) :- node(X), node(X*2).\n"
+        << "reach(X,Y) :- edge(X,Y).\n"
+        << "reach(X,Z) :- reach(X,Y), edge(Y,Z).\n";
+    return oss.str();
+}
+
+std::string theory(unsigned size) {
+    std::ostringstream oss;
+    oss << "#theory bench {\n"
+        << "    term { - : 2, unary; + : 1, binary, left };\n"
+        << "    &sum/0 : term, {<=, >=}, term, any\n"
+        << "}.\n"
+        << "p(1.." << size << ").\n"
+        << "{ q(X) } :- p(X).\n"
+        << "&sum { X : q(X), X <= K } <= K :- p(K).\n";
+    return oss.str();
+}
+
+std::string multishot(unsigned size) {
+    std::ostringstream oss;
+    oss << "p(1.." << size << ").\n"
+        << "#program step(t).\n"
+        << "{ q(t,X) } :- p(X).\n"
+        << "r(t,X) :- q(t,X), not q(t-1,X).\n"
+        << ":- p(X), not q(t,X), not q(t-1,X), t > 1.\n";
+    return oss.str();
+}
+
+unsigned multishotSteps(unsigned size) { return std::max(1U, size / 10); }
+
+std::string facts(unsigned size) {
+    std::ostringstream oss;
+    for (unsigned i = 0; i < size; ++i) {
+        for (unsigned j = 0; j < 100; ++j) {
+            oss << "f(" << i << "," << j << ",\"s" << (i * 100 + j) % 997 << "\").\n";
+        }
+    }
+    oss << "g(X) :- f(X,0,_).\n";
+    return oss.str();
+}
+
+std::string rules(unsigned size) {
+    std::ostringstream oss;
+    unsigned n = size * 10;
+    oss << "c(1..3).\n";
+    for (unsigned i = 0; i < n; ++i) {
+        oss << "b(" << i << ",X) :- c(X).\n"
+            << "a(" << i << ",X) :- b(" << i << ",X), not a(" << (i + 1) % n << ",X).\n";
+    }
+    return oss.str();
+}
+
+std::vector<Instance> const &instances() {
+    static std::vector<Instance> ret = {
+        {"join", join, nullptr},
+        {"aggregate", aggregate, nullptr},
+        {"recursive", recursive, nullptr},
+        {"theory", theory, nullptr},
+        {"multishot", multishot, multishotSteps},
+        {"facts", facts, nullptr},
+        {"rules", rules, nullptr},
+    };
+    return ret;
+}
+
+// {{{1 measurements
+
+struct Result {
+    double parse = std::numeric_limits<double>::max();
+    double ground = std::numeric_limits<double>::max();
+    double solve = std::numeric_limits<double>::max();
+    size_t atoms = 0;
+    long peakRss = 0;
+};
+
+// Returns the peak resident set size of the process in KiB or zero if unknown.
+long peakRss() {
+#if defined(__unix__) || defined(__APPLE__)
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(__APPLE__)
+        return usage.ru_maxrss / 1024;
+#else
+        return usage.ru_maxrss;
+#endif
+    }
+#endif
+    return 0;
+}
+
+class Timer {
+  public:
+    Timer() : start_(std::chrono::steady_clock::now()) {}
+    double elapsed() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+    }
+
+  private:
+    std::chrono::steady_clock::time_point start_;
+};
+
+void run(Instance const &inst, unsigned size, StringSpan args, Result &res) {
+    Control ctl{args, [](WarningCode, char const *) {}};
+    double parse = 0;
+    double ground = 0;
+    double solve = 0;
+    auto prg = inst.program(size);
+    {
+        Timer t;
+        ctl.add("base", {}, prg.c_str());
+        parse += t.elapsed();
+    }
+    unsigned steps = inst.steps != nullptr ? inst.steps(size) : 0;
+    for (unsigned step = 0; step <= steps; ++step) {
+        {
+            Timer t;
+            if (step == 0) {
+                ctl.ground({{"base", {}}});
+            } else {
+                ctl.ground({{"step", {Number(static_cast<int>(step))}}});
+            }
+            ground += t.elapsed();
+        }
+        {
+            Timer t;
+            ctl.solve().get();
+            solve += t.elapsed();
+        }
+    }
+    res.parse = std::min(res.parse, parse);
+    res.ground = std::min(res.ground, ground);
+    res.solve = std::min(res.solve, solve);
+    res.atoms = ctl.symbolic_atoms().length();
+    res.peakRss = std::max(res.peakRss, peakRss());
+}
+
+// {{{1 command line
+
+void usage(char const *name) {
+    std::cout << "usage: " << name << " [options] [instance...] [-- clingo options]\n\n"
+              << "Runs the benchmark instances and prints the results in JSON format.\n"
+              << "The ground phase includes rewriting and translating the program.\n"
+              << "Peak RSS is taken for the whole process; select a single instance to\n"
+              << "get meaningful per instance memory usage.\n\n"
+              << "options:\n"
+              << "  --size=<n>   : scale instances by <n> (default: 100)\n"
+              << "  --repeat=<n> : run each instance <n> times and report the fastest run (default: 1)\n"
+              << "  --list       : list available instances\n"
+              << "  --help       : print this help\n";
+}
+
+bool parseNum(char const *arg, char const *opt, unsigned &num) {
+    auto len = std::strlen(opt);
+    if (std::strncmp(arg, opt, len) != 0) {
+        return false;
+    }
+    num = static_cast<unsigned>(std::stoul(arg + len));
+    return true;
+}
+
+// }}}1
+
+} // namespace
+
+int main(int argc, char const **argv) {
+    try {
+        unsigned size = 100;
+        unsigned repeat = 1;
+        std::vector<Instance> selected;
+        std::vector<char const *> args;
+        for (int i = 1; i < argc; ++i) {
+            char const *arg = argv[i]; // NOLINT
+            if (std::strcmp(arg, "--") == 0) {
+                args.assign(argv + i + 1, argv + argc); // NOLINT
+                break;
+            }
+            if (std::strcmp(arg, "--help") == 0) {
+                usage(argv[0]); // NOLINT
+                return 0;
+            }
+            if (std::strcmp(arg, "--list") == 0) {
+                for (auto const &inst : instances()) {
+                    std::cout << inst.name << "\n";
+                }
+                return 0;
+            }
+            if (parseNum(arg, "--size=", size) || parseNum(arg, "--repeat=", repeat)) {
+                continue;
+            }
+            auto it = std::find_if(instances().begin(), instances().end(),
+                                   [arg](Instance const &inst) { return std::strcmp(inst.name, arg) == 0; });
+            if (it == instances().end()) {
+                throw std::runtime_error(std::string("unknown instance: ") + arg);
+            }
+            selected.emplace_back(*it);
+        }
+        if (selected.empty()) {
+            selected = instances();
+        }
+
+        int major = 0;
+        int minor = 0;
+        int revision = 0;
+        std::tie(major, minor, revision) = version();
+        std::cout << "{\n"
+                  << "  \"version\": \"" << major << "." << minor << "." << revision << "\",\n"
+                  << "  \"size\": " << size << ",\n"
+                  << "  \"instances\": {";
+        char const *sep = "\n";
+        for (auto const &inst : selected) {
+            Result res;
+            for (unsigned i = 0; i < std::max(1U, repeat); ++i) {
+                run(inst, size, {args.data(), args.size()}, res);
+            }
+            std::cout << sep << "    \"" << inst.name << "\": {"
+                      << "\"parse\": " << res.parse << ", "
+                      << "\"ground\": " << res.ground << ", "
+                      << "\"solve\": " << res.solve << ", "
+                      << "\"atoms\": " << res.atoms << ", "
+                      << "\"peak_rss\": " << res.peakRss << "}";
+            sep = ",\n";
+        }
+        std::cout << "\n  }\n}" << std::endl;
+    } catch (std::exception const &e) {
+        std::cerr << "clingo-bench failed with: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
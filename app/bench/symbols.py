@@ -0,0 +1,70 @@
+#!/usr/bin/env python
+
+import argparse
+import timeit
+
+from clingo.control import Control
+from clingo.symbol import Function, Number, String
+
+parser = argparse.ArgumentParser(
+    description="""
+Measures symbol-heavy workloads of the Python API. Prints the time in seconds
+for each workload to compare runs before and after a change.
+"""
+)
+parser.add_argument(
+    "-s",
+    "--size",
+    type=int,
+    default=100000,
+    help="number of symbols per workload (default: 100000)",
+)
+parser.add_argument(
+    "-r",
+    "--repeat",
+    type=int,
+    default=3,
+    help="number of repetitions keeping the best time (default: 3)",
+)
+args = parser.parse_args()
+
+syms = [Function("p", [Number(i), String(f"s{i % 97}")]) for i in range(args.size)]
+
+
+def create():
+    for i in range(args.size):
+        Function("p", [Number(i), String("s")])
+
+
+def hash_eq():
+    seen = set(syms)
+    for sym in syms:
+        assert sym in seen
+
+
+def inspect():
+    for sym in syms:
+        _ = sym.name
+        _ = sym.arguments[0].number
+
+
+def to_string():
+    for sym in syms:
+        str(sym)
+
+
+def models():
+    ctl = Control(["0"])
+    ctl.add("base", [], f"{{ p(1..{max(1, args.size // 10000)}) }}. q(1..1000).")
+    ctl.ground([("base", [])])
+    with ctl.solve(yield_=True) as hnd:
+        for model in hnd:
+            for sym in model.symbols(atoms=True):
+                hash(sym)
+
+
+WORKLOADS = [create, hash_eq, inspect, to_string, models]
+
+for workload in WORKLOADS:
+    best = min(timeit.repeat(workload, number=1, repeat=args.repeat))
+    print(f"{workload.__name__:<10} {best:>10.4f}")
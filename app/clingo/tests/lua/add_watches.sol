@@ -0,0 +1,8 @@
+Step: 1
+
+a(1)
+a(1) a(3)
+a(2)
+a(2) a(3)
+a(3)
+SAT
@@ -455,6 +455,19 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_symbol_to_string_size(clingo_symbol_t symb
 //!
 //! @see clingo_symbol_to_string_size()
 CLINGO_VISIBILITY_DEFAULT bool clingo_symbol_to_string(clingo_symbol_t symbol, char *string, size_t size);
+//! Get the string representation of a symbol without copying it.
+//!
+//! Renderings of functions and strings are cached up to a memory limit.
+//! Unlike with clingo_symbol_to_string_size() and clingo_symbol_to_string(),
+//! the symbol has to be rendered at most once.
+//!
+//! @note The string is valid until the next call to one of the symbol to string functions in the same thread.
+//!
+//! @param[in] symbol the target symbol
+//! @param[out] string the resulting string
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+CLINGO_VISIBILITY_DEFAULT bool clingo_symbol_to_cached_string(clingo_symbol_t symbol, char const **string);
 
 //! @}
 
@@ -681,6 +694,64 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_symbolic_atoms_next(clingo_symbolic_atoms_
 //! @return whether the call was successful
 CLINGO_VISIBILITY_DEFAULT bool clingo_symbolic_atoms_is_valid(clingo_symbolic_atoms_t const *atoms,
                                                               clingo_symbolic_atom_iterator_t iterator, bool *valid);
+//! Get the number of atoms with the given signature.
+//!
+//! @param[in] atoms the target
+//! @param[in] signature the signature
+//! @param[out] size the number of atoms
+//! @return whether the call was successful
+CLINGO_VISIBILITY_DEFAULT bool clingo_symbolic_atoms_signature_size(clingo_symbolic_atoms_t const *atoms,
+                                                                    clingo_signature_t signature, size_t *size);
+//! Get the symbols, literals, and flags of a range of atoms with the given signature in one call.
+//!
+//! The atoms are stored in the order in which they are visited when iterating
+//! over the atoms with the given signature. Output arrays that are NULL are not
+//! filled.
+//!
+//! @param[in] atoms the target
+//! @param[in] signature the signature
+//! @param[in] offset the index of the first atom
+//! @param[out] symbols the symbolic representations of the atoms
+//! @param[out] literals the associated literals (see clingo_symbolic_atoms_literal())
+//! @param[out] facts whether the atoms are facts
+//! @param[out] externals whether the atoms are externals
+//! @param[in] size the number of atoms to fetch
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_runtime if the range exceeds the number of atoms
+//!
+//! @see clingo_symbolic_atoms_signature_size()
+CLINGO_VISIBILITY_DEFAULT bool clingo_symbolic_atoms_fetch(clingo_symbolic_atoms_t const *atoms,
+                                                           clingo_signature_t signature, size_t offset,
+                                                           clingo_symbol_t *symbols, clingo_literal_t *literals,
+                                                           bool *facts, bool *externals, size_t size);
+//! Find the atoms with the given signature whose arguments at the given positions have the given values.
+//!
+//! Arguments at other positions act as wildcards. For example, the atoms
+//! matching `edge(3,_)` are found with signature `edge/2`, position 0, and
+//! value 3. An index is built for each set of positions on first use and
+//! updated with atoms added later, so the cost of a query is proportional to
+//! the number of matching atoms.
+//!
+//! At most `capacity` iterators are stored. The total number of matching
+//! atoms is stored in `matches`, so calling the function with a capacity of
+//! zero first determines the size of the array required.
+//!
+//! @param[in] atoms the target
+//! @param[in] signature the signature
+//! @param[in] positions the (zero-based) argument positions
+//! @param[in] values the values of the arguments at the given positions
+//! @param[in] size the number of positions and values
+//! @param[out] iterators iterators pointing to the matching atoms
+//! @param[in] capacity the size of the iterator array
+//! @param[out] matches the number of matching atoms
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+//! - ::clingo_error_runtime if a position is out of range or given twice
+CLINGO_VISIBILITY_DEFAULT bool clingo_symbolic_atoms_find_pattern(clingo_symbolic_atoms_t const *atoms,
+                                                                  clingo_signature_t signature, size_t const *positions,
+                                                                  clingo_symbol_t const *values, size_t size,
+                                                                  clingo_symbolic_atom_iterator_t *iterators,
+                                                                  size_t capacity, size_t *matches);
 
 //! Callback function to inject symbols.
 //!
@@ -950,6 +1021,119 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_theory_atoms_atom_to_string(clingo_theory_
                                                                   char *string, size_t size);
 //! @}
 
+//! @name Bulk Export
+//!
+//! The functions in this group export ranges of terms, elements, and atoms
+//! into flat arrays to avoid one call per entry when initializing theory
+//! propagators. Output arrays that are NULL are not filled. Arrays of offsets
+//! receive size + 1 entries where the i-th entry is the position of the
+//! arguments, tuple, or elements of the i-th entry in the concatenated array
+//! obtained with the corresponding second function.
+//!
+//! Since theory atoms get consecutive ids, theory atoms added since the
+//! previous initialization can be fetched by starting at the number of
+//! previously seen atoms.
+//! @{
+
+//! Get the total number of theory terms.
+//!
+//! @param[in] atoms the target
+//! @param[out] size the resulting number
+//! @return whether the call was successful
+CLINGO_VISIBILITY_DEFAULT bool clingo_theory_atoms_terms_size(clingo_theory_atoms_t const *atoms, size_t *size);
+//! Get the total number of theory elements.
+//!
+//! @param[in] atoms the target
+//! @param[out] size the resulting number
+//! @return whether the call was successful
+CLINGO_VISIBILITY_DEFAULT bool clingo_theory_atoms_elements_size(clingo_theory_atoms_t const *atoms, size_t *size);
+//! Get the types, values, and argument offsets of a range of theory terms.
+//!
+//! The value of a number term is its number and the value of a function term
+//! is the id of the symbol term holding its name. Other terms have value 0.
+//!
+//! @param[in] atoms the target
+//! @param[in] offset the id of the first term
+//! @param[out] types the types of the terms
+//! @param[out] values the values of the terms
+//! @param[out] argument_offsets the offsets of the arguments of the terms
+//! @param[in] size the number of terms
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_runtime if the range exceeds the number of terms
+CLINGO_VISIBILITY_DEFAULT bool clingo_theory_atoms_fetch_terms(clingo_theory_atoms_t const *atoms, clingo_id_t offset,
+                                                               clingo_theory_term_type_t *types, int *values,
+                                                               size_t *argument_offsets, size_t size);
+//! Get the concatenated arguments of a range of theory terms.
+//!
+//! @param[in] atoms the target
+//! @param[in] offset the id of the first term
+//! @param[in] size the number of terms
+//! @param[out] arguments the resulting term ids
+//! @param[in] capacity the capacity of the arguments array
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_runtime if the range exceeds the number of terms or the capacity is too small
+CLINGO_VISIBILITY_DEFAULT bool clingo_theory_atoms_fetch_term_arguments(clingo_theory_atoms_t const *atoms,
+                                                                        clingo_id_t offset, size_t size,
+                                                                        clingo_id_t *arguments, size_t capacity);
+//! Get the condition ids and tuple offsets of a range of theory elements.
+//!
+//! @param[in] atoms the target
+//! @param[in] offset the id of the first element
+//! @param[out] conditions the condition ids (see clingo_theory_atoms_element_condition_id())
+//! @param[out] tuple_offsets the offsets of the tuples of the elements
+//! @param[in] size the number of elements
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_runtime if the range exceeds the number of elements
+CLINGO_VISIBILITY_DEFAULT bool clingo_theory_atoms_fetch_elements(clingo_theory_atoms_t const *atoms,
+                                                                  clingo_id_t offset, clingo_literal_t *conditions,
+                                                                  size_t *tuple_offsets, size_t size);
+//! Get the concatenated tuples of a range of theory elements.
+//!
+//! @param[in] atoms the target
+//! @param[in] offset the id of the first element
+//! @param[in] size the number of elements
+//! @param[out] tuples the resulting term ids
+//! @param[in] capacity the capacity of the tuples array
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_runtime if the range exceeds the number of elements or the capacity is too small
+CLINGO_VISIBILITY_DEFAULT bool clingo_theory_atoms_fetch_element_tuples(clingo_theory_atoms_t const *atoms,
+                                                                        clingo_id_t offset, size_t size,
+                                                                        clingo_id_t *tuples, size_t capacity);
+//! Get the literals, terms, guards, and element offsets of a range of theory atoms.
+//!
+//! The connective of a guard is given as the id of a symbol term. For atoms
+//! without guard, the connective and the term are set to 0.
+//!
+//! @param[in] atoms the target
+//! @param[in] offset the id of the first atom
+//! @param[out] literals the aspif literals of the atoms
+//! @param[out] terms the terms of the atoms
+//! @param[out] has_guard whether the atoms have a guard
+//! @param[out] guard_connectives the connectives of the guards
+//! @param[out] guard_terms the terms of the guards
+//! @param[out] element_offsets the offsets of the elements of the atoms
+//! @param[in] size the number of atoms
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_runtime if the range exceeds the number of atoms
+CLINGO_VISIBILITY_DEFAULT bool clingo_theory_atoms_fetch_atoms(clingo_theory_atoms_t const *atoms, clingo_id_t offset,
+                                                               clingo_literal_t *literals, clingo_id_t *terms,
+                                                               bool *has_guard, clingo_id_t *guard_connectives,
+                                                               clingo_id_t *guard_terms, size_t *element_offsets,
+                                                               size_t size);
+//! Get the concatenated elements of a range of theory atoms.
+//!
+//! @param[in] atoms the target
+//! @param[in] offset the id of the first atom
+//! @param[in] size the number of atoms
+//! @param[out] elements the resulting element ids
+//! @param[in] capacity the capacity of the elements array
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_runtime if the range exceeds the number of atoms or the capacity is too small
+CLINGO_VISIBILITY_DEFAULT bool clingo_theory_atoms_fetch_atom_elements(clingo_theory_atoms_t const *atoms,
+                                                                       clingo_id_t offset, size_t size,
+                                                                       clingo_id_t *elements, size_t capacity);
+//! @}
+
 //! @}
 
 // {{{1 propagator
@@ -1180,6 +1364,17 @@ typedef struct clingo_propagate_init clingo_propagate_init_t;
 CLINGO_VISIBILITY_DEFAULT bool clingo_propagate_init_solver_literal(clingo_propagate_init_t const *init,
                                                                     clingo_literal_t aspif_literal,
                                                                     clingo_literal_t *solver_literal);
+//! Map the given program literals or condition ids to their solver literals.
+//!
+//! @param[in] init the target
+//! @param[in] aspif_literals the aspif literals to map
+//! @param[in] size the number of literals
+//! @param[out] solver_literals the resulting solver literals
+//! @return whether the call was successful
+//! @see clingo_propagate_init_solver_literal()
+CLINGO_VISIBILITY_DEFAULT bool clingo_propagate_init_solver_literals(clingo_propagate_init_t const *init,
+                                                                     clingo_literal_t const *aspif_literals,
+                                                                     size_t size, clingo_literal_t *solver_literals);
 //! Add a watch for the solver literal in the given phase.
 //!
 //! @param[in] init the target
@@ -1187,6 +1382,26 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_propagate_init_solver_literal(clingo_propa
 //! @return whether the call was successful
 CLINGO_VISIBILITY_DEFAULT bool clingo_propagate_init_add_watch(clingo_propagate_init_t *init,
                                                                clingo_literal_t solver_literal);
+//! Add watches for the given solver literals.
+//!
+//! @param[in] init the target
+//! @param[in] solver_literals the solver literals
+//! @param[in] size the number of literals
+//! @return whether the call was successful
+//! @see clingo_propagate_init_add_watch()
+CLINGO_VISIBILITY_DEFAULT bool clingo_propagate_init_add_watches(clingo_propagate_init_t *init,
+                                                                 clingo_literal_t const *solver_literals, size_t size);
+//! Add watches for the given solver literals to the given solver thread.
+//!
+//! @param[in] init the target
+//! @param[in] solver_literals the solver literals
+//! @param[in] size the number of literals
+//! @param[in] thread_id the id of the solver thread
+//! @return whether the call was successful
+//! @see clingo_propagate_init_add_watch_to_thread()
+CLINGO_VISIBILITY_DEFAULT bool clingo_propagate_init_add_watches_to_thread(clingo_propagate_init_t *init,
+                                                                           clingo_literal_t const *solver_literals,
+                                                                           size_t size, clingo_id_t thread_id);
 //! Add a watch for the solver literal in the given phase to the given solver thread.
 //!
 //! @param[in] init the target
@@ -1446,6 +1661,47 @@ CLINGO_VISIBILITY_DEFAULT void clingo_propagate_control_remove_watch(clingo_prop
 CLINGO_VISIBILITY_DEFAULT bool clingo_propagate_control_add_clause(clingo_propagate_control_t *control,
                                                                    clingo_literal_t const *clause, size_t size,
                                                                    clingo_clause_type_t type, bool *result);
+//! Add the given clauses to the solver.
+//!
+//! The clauses are given as one array of literals where the i-th clause is
+//! stored in the range [offsets[i], offsets[i+1]). Clauses are added in order
+//! until one sets the result to false.
+//!
+//! @attention No further calls on the control object or functions on the assignment should be called when the result of
+//! this method is false.
+//!
+//! @param[in] control the target
+//! @param[in] literals the literals of the clauses
+//! @param[in] offsets the size + 1 offsets delimiting the clauses
+//! @param[in] size the number of clauses
+//! @param[in] type the clause type determining the lifetime of the clauses
+//! @param[out] result result indicating whether propagation has to be stopped
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+//! @see clingo_propagate_control_add_clause()
+CLINGO_VISIBILITY_DEFAULT bool clingo_propagate_control_add_clauses(clingo_propagate_control_t *control,
+                                                                    clingo_literal_t const *literals,
+                                                                    size_t const *offsets, size_t size,
+                                                                    clingo_clause_type_t type, bool *result);
+//! Add watches for the given solver literals in the current solver thread.
+//!
+//! @param[in] control the target
+//! @param[in] literals the literals to watch
+//! @param[in] size the number of literals
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+//! - ::clingo_error_logic if a literal is invalid
+//! @see clingo_propagate_control_add_watch()
+CLINGO_VISIBILITY_DEFAULT bool clingo_propagate_control_add_watches(clingo_propagate_control_t *control,
+                                                                    clingo_literal_t const *literals, size_t size);
+//! Removes the watches (if any) for the given solver literals in the current solver thread.
+//!
+//! @param[in] control the target
+//! @param[in] literals the literals to remove
+//! @param[in] size the number of literals
+//! @see clingo_propagate_control_remove_watch()
+CLINGO_VISIBILITY_DEFAULT void clingo_propagate_control_remove_watches(clingo_propagate_control_t *control,
+                                                                       clingo_literal_t const *literals, size_t size);
 //! Propagate implied literals (resulting from added clauses).
 //!
 //! This method sets its result to false if the current propagation must be stopped for the solver to backtrack.
@@ -2239,6 +2495,36 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_statistics_value_get(clingo_statistics_t c
 CLINGO_VISIBILITY_DEFAULT bool clingo_statistics_value_set(clingo_statistics_t *statistics, uint64_t key, double value);
 //! @}
 
+//! @name Functions to export statistics
+//! @{
+
+//! Get the size of the JSON representation of an entry (including the terminating 0).
+//!
+//! @param[in] statistics the target statistics
+//! @param[in] key the key
+//! @param[out] size the resulting size
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+CLINGO_VISIBILITY_DEFAULT bool clingo_statistics_to_json_size(clingo_statistics_t const *statistics, uint64_t key,
+                                                              size_t *size);
+//! Get the JSON representation of an entry and all its subentries.
+//!
+//! Maps are represented as objects, arrays as arrays, and values as numbers.
+//! Values that are not finite are represented as null.
+//! This avoids traversing large statistics trees with one call per entry.
+//!
+//! @param[in] statistics the target statistics
+//! @param[in] key the key
+//! @param[out] string the resulting string
+//! @param[in] size the size of the string
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+//!
+//! @see clingo_statistics_to_json_size()
+CLINGO_VISIBILITY_DEFAULT bool clingo_statistics_to_json(clingo_statistics_t const *statistics, uint64_t key,
+                                                         char *string, size_t size);
+//! @}
+
 //! @}
 
 // {{{1 model and solve control
@@ -2847,6 +3133,86 @@ typedef struct clingo_ground_program_observer {
                                    size_t size, clingo_id_t operator_id, clingo_id_t right_hand_side_id, void *data);
 } clingo_ground_program_observer_t;
 
+//! A batch of rules.
+//!
+//! The head atoms of the i-th rule are stored in `heads[head_offsets[i]]` to `heads[head_offsets[i+1]-1]` and its body
+//! literals in `bodies[body_offsets[i]]` to `bodies[body_offsets[i+1]-1]`.
+typedef struct clingo_rule_batch {
+    bool const *choices;            //!< whether the head of the i-th rule is a choice
+    size_t const *head_offsets;     //!< the offsets of the heads (size + 1 elements)
+    clingo_atom_t const *heads;     //!< the head atoms of all rules
+    size_t const *body_offsets;     //!< the offsets of the bodies (size + 1 elements)
+    clingo_literal_t const *bodies; //!< the body literals of all rules
+    size_t size;                    //!< the number of rules in the batch
+} clingo_rule_batch_t;
+
+//! A batch of weight rules.
+//!
+//! The rules are stored as in ::clingo_rule_batch_t.
+typedef struct clingo_weight_rule_batch {
+    bool const *choices;                     //!< whether the head of the i-th rule is a choice
+    size_t const *head_offsets;              //!< the offsets of the heads (size + 1 elements)
+    clingo_atom_t const *heads;              //!< the head atoms of all rules
+    clingo_weight_t const *lower_bounds;     //!< the lower bound of the i-th rule
+    size_t const *body_offsets;              //!< the offsets of the bodies (size + 1 elements)
+    clingo_weighted_literal_t const *bodies; //!< the weighted body literals of all rules
+    size_t size;                             //!< the number of rules in the batch
+} clingo_weight_rule_batch_t;
+
+//! A batch of output atoms.
+typedef struct clingo_output_atom_batch {
+    clingo_symbol_t const *symbols; //!< the symbolic representation of the i-th atom
+    clingo_atom_t const *atoms;     //!< the i-th atom or zero for facts
+    size_t size;                    //!< the number of atoms in the batch
+} clingo_output_atom_batch_t;
+
+//! A batch of theory elements.
+//!
+//! The elements are stored as in ::clingo_rule_batch_t.
+typedef struct clingo_theory_element_batch {
+    clingo_id_t const *element_ids;     //!< the id of the i-th element
+    size_t const *term_offsets;         //!< the offsets of the term tuples (size + 1 elements)
+    clingo_id_t const *terms;           //!< the term tuples of all elements
+    size_t const *condition_offsets;    //!< the offsets of the conditions (size + 1 elements)
+    clingo_literal_t const *conditions; //!< the condition literals of all elements
+    size_t size;                        //!< the number of elements in the batch
+} clingo_theory_element_batch_t;
+
+//! Callbacks to observe ground directives in batches.
+//!
+//! If a callback is set, the corresponding directives are collected and passed in batches instead of calling the
+//! respective callback of ::clingo_ground_program_observer_t. The order of directives is preserved, i.e., a batch is
+//! passed before any other directive is observed, and all batches are passed before a step ends.
+//! The arrays of a batch are only valid during the call.
+//!
+//! @see clingo_control_register_batch_observer()
+typedef struct clingo_ground_program_batch_observer {
+    //! Observe a batch of rules.
+    //!
+    //! @param[in] batch the rules
+    //! @param[in] data user data for the callback
+    //! @return whether the call was successful
+    bool (*rules)(clingo_rule_batch_t const *batch, void *data);
+    //! Observe a batch of weight rules.
+    //!
+    //! @param[in] batch the weight rules
+    //! @param[in] data user data for the callback
+    //! @return whether the call was successful
+    bool (*weight_rules)(clingo_weight_rule_batch_t const *batch, void *data);
+    //! Observe a batch of output atoms.
+    //!
+    //! @param[in] batch the output atoms
+    //! @param[in] data user data for the callback
+    //! @return whether the call was successful
+    bool (*output_atoms)(clingo_output_atom_batch_t const *batch, void *data);
+    //! Observe a batch of theory elements.
+    //!
+    //! @param[in] batch the theory elements
+    //! @param[in] data user data for the callback
+    //! @return whether the call was successful
+    bool (*theory_elements)(clingo_theory_element_batch_t const *batch, void *data);
+} clingo_ground_program_batch_observer_t;
+
 //! @}
 
 // {{{1 control
@@ -3206,6 +3572,9 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_control_statistics(clingo_control_t const
                                                          clingo_statistics_t const **statistics);
 //! Interrupt the active solve call (or the following solve call right at the beginning).
 //!
+//! If called while grounding, the active ground call additionally stops with a runtime error.
+//! The program grounded so far is kept but might be incomplete.
+//!
 //! @param[in] control the target
 CLINGO_VISIBILITY_DEFAULT void clingo_control_interrupt(clingo_control_t *control);
 //! Get low-level access to clasp.
@@ -3333,6 +3702,21 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_control_theory_atoms(clingo_control_t cons
 CLINGO_VISIBILITY_DEFAULT bool clingo_control_register_observer(clingo_control_t *control,
                                                                 clingo_ground_program_observer_t const *observer,
                                                                 bool replace, void *data);
+//! Register a program observer receiving directives in batches with the control object.
+//!
+//! Directives for which the batch observer has no callback are passed to the given program observer.
+//!
+//! @param[in] control the target
+//! @param[in] observer the observer to register
+//! @param[in] batch_observer the callbacks receiving batches
+//! @param[in] batch_size the maximum number of directives in a batch
+//! @param[in] replace just pass the grounding to the observer but not the solver
+//! @param[in] data user data passed to the observer functions
+//! @return whether the call was successful
+CLINGO_VISIBILITY_DEFAULT bool
+clingo_control_register_batch_observer(clingo_control_t *control, clingo_ground_program_observer_t const *observer,
+                                       clingo_ground_program_batch_observer_t const *batch_observer, size_t batch_size,
+                                       bool replace, void *data);
 //! Register a backend with the control object.
 //!
 //! This function is similar to clingo_control_register_observer except that
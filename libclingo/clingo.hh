@@ -679,6 +679,14 @@ class SymbolicAtoms {
     SymbolicAtomIterator find(Symbol atom) const;
     std::vector<Signature> signatures() const;
     size_t length() const;
+    size_t length(Signature sig) const;
+    // Fetches the given range of atoms with the given signature; output
+    // arrays that are null are not filled.
+    void fetch(Signature sig, size_t offset, Symbol *symbols, literal_t *literals, bool *facts, bool *externals,
+               size_t size) const;
+    // Returns the atoms with the given signature whose arguments at the given
+    // positions have the given values.
+    std::vector<SymbolicAtom> find_pattern(Signature sig, Span<size_t> positions, SymbolSpan values) const;
     clingo_symbolic_atoms_t const *to_c() const { return atoms_; }
     SymbolicAtom operator[](Symbol atom) const { return *find(atom); }
 
@@ -1070,8 +1078,11 @@ class PropagateInit {
   public:
     explicit PropagateInit(clingo_propagate_init_t *init) : init_(init) {}
     literal_t solver_literal(literal_t lit) const;
+    std::vector<literal_t> solver_literals(LiteralSpan lits) const;
     void add_watch(literal_t lit);
     void add_watch(literal_t literal, id_t thread_id);
+    void add_watches(LiteralSpan lits);
+    void add_watches(LiteralSpan lits, id_t thread_id);
     void remove_watch(literal_t lit);
     void remove_watch(literal_t literal, id_t thread_id);
     void freeze_literal(literal_t lit);
@@ -1135,7 +1146,10 @@ class PropagateControl {
     void add_watch(literal_t literal);
     bool has_watch(literal_t literal) const;
     void remove_watch(literal_t literal);
+    void add_watches(LiteralSpan literals);
+    void remove_watches(LiteralSpan literals);
     bool add_clause(LiteralSpan clause, ClauseType type = ClauseType::Learnt);
+    bool add_clauses(LiteralSpan literals, Span<size_t> offsets, ClauseType type = ClauseType::Learnt);
     bool propagate();
     clingo_propagate_control_t *to_c() const { return ctl_; }
 
@@ -1699,6 +1713,8 @@ template <bool constant> class StatisticsBase {
     operator double() const { return value(); }
     double value() const;
     void set_value(double d);
+    // export
+    std::string to_json() const;
     statistics_t to_c() const { return stats_; }
 
   private:
@@ -2582,7 +2598,9 @@ inline bool Symbol::match(char const *name, unsigned arity) const {
 }
 
 inline std::string Symbol::to_string() const {
-    return Detail::to_string(clingo_symbol_to_string_size, clingo_symbol_to_string, sym_);
+    char const *ret = nullptr;
+    Detail::handle_error(clingo_symbol_to_cached_string(sym_, &ret));
+    return ret;
 }
 
 inline size_t Symbol::hash() const { return clingo_symbol_hash(sym_); }
@@ -2688,6 +2706,41 @@ inline size_t SymbolicAtoms::length() const {
     return ret;
 }
 
+inline size_t SymbolicAtoms::length(Signature sig) const {
+    size_t ret = 0;
+    Detail::handle_error(clingo_symbolic_atoms_signature_size(atoms_, sig.to_c(), &ret));
+    return ret;
+}
+
+inline void SymbolicAtoms::fetch(Signature sig, size_t offset, Symbol *symbols, literal_t *literals, bool *facts,
+                                 bool *externals, size_t size) const {
+    Detail::handle_error(clingo_symbolic_atoms_fetch(atoms_, sig.to_c(), offset,
+                                                     Detail::cast<clingo_symbol_t *>(symbols), literals, facts,
+                                                     externals, size));
+}
+
+inline std::vector<SymbolicAtom> SymbolicAtoms::find_pattern(Signature sig, Span<size_t> positions,
+                                                             SymbolSpan values) const {
+    if (positions.size() != values.size()) {
+        throw std::runtime_error("positions and values must have the same size");
+    }
+    size_t n = 0;
+    auto find = [&](clingo_symbolic_atom_iterator_t *iterators, size_t capacity) {
+        Detail::handle_error(clingo_symbolic_atoms_find_pattern(atoms_, sig.to_c(), positions.begin(),
+                                                                Detail::cast<clingo_symbol_t const *>(values.begin()),
+                                                                values.size(), iterators, capacity, &n));
+    };
+    find(nullptr, 0);
+    std::vector<clingo_symbolic_atom_iterator_t> iterators(n);
+    find(iterators.data(), iterators.size());
+    std::vector<SymbolicAtom> ret;
+    ret.reserve(iterators.size());
+    for (auto const &it : iterators) {
+        ret.emplace_back(atoms_, it);
+    }
+    return ret;
+}
+
 // {{{2 theory atoms
 
 inline TheoryTermType TheoryTerm::type() const {
@@ -2895,6 +2948,12 @@ inline literal_t PropagateInit::solver_literal(literal_t lit) const {
     return ret;
 }
 
+inline std::vector<literal_t> PropagateInit::solver_literals(LiteralSpan lits) const {
+    std::vector<literal_t> ret(lits.size());
+    Detail::handle_error(clingo_propagate_init_solver_literals(init_, lits.begin(), lits.size(), ret.data()));
+    return ret;
+}
+
 inline void PropagateInit::add_watch(literal_t lit) {
     Detail::handle_error(clingo_propagate_init_add_watch(init_, lit));
 }
@@ -2903,6 +2962,14 @@ inline void PropagateInit::add_watch(literal_t lit, id_t thread_id) {
     Detail::handle_error(clingo_propagate_init_add_watch_to_thread(init_, lit, thread_id));
 }
 
+inline void PropagateInit::add_watches(LiteralSpan lits) {
+    Detail::handle_error(clingo_propagate_init_add_watches(init_, lits.begin(), lits.size()));
+}
+
+inline void PropagateInit::add_watches(LiteralSpan lits, id_t thread_id) {
+    Detail::handle_error(clingo_propagate_init_add_watches_to_thread(init_, lits.begin(), lits.size(), thread_id));
+}
+
 inline void PropagateInit::remove_watch(literal_t lit) {
     Detail::handle_error(clingo_propagate_init_remove_watch(init_, lit));
 }
@@ -3000,6 +3067,14 @@ inline bool PropagateControl::has_watch(literal_t literal) const {
 
 inline void PropagateControl::remove_watch(literal_t literal) { clingo_propagate_control_remove_watch(ctl_, literal); }
 
+inline void PropagateControl::add_watches(LiteralSpan literals) {
+    Detail::handle_error(clingo_propagate_control_add_watches(ctl_, literals.begin(), literals.size()));
+}
+
+inline void PropagateControl::remove_watches(LiteralSpan literals) {
+    clingo_propagate_control_remove_watches(ctl_, literals.begin(), literals.size());
+}
+
 inline bool PropagateControl::add_clause(LiteralSpan clause, ClauseType type) {
     bool ret = false;
     Detail::handle_error(clingo_propagate_control_add_clause(ctl_, clause.begin(), clause.size(),
@@ -3007,6 +3082,17 @@ inline bool PropagateControl::add_clause(LiteralSpan clause, ClauseType type) {
     return ret;
 }
 
+inline bool PropagateControl::add_clauses(LiteralSpan literals, Span<size_t> offsets, ClauseType type) {
+    if (offsets.empty()) {
+        return true;
+    }
+    bool ret = false;
+    Detail::handle_error(clingo_propagate_control_add_clauses(ctl_, literals.begin(), offsets.begin(),
+                                                              offsets.size() - 1,
+                                                              static_cast<clingo_clause_type_t>(type), &ret));
+    return ret;
+}
+
 inline bool PropagateControl::propagate() {
     bool ret = false;
     Detail::handle_error(clingo_propagate_control_propagate(ctl_, &ret));
@@ -3432,6 +3518,10 @@ template <bool constant> inline void StatisticsBase<constant>::set_value(double
     Detail::handle_error(clingo_statistics_value_set(stats_, key_, d));
 }
 
+template <bool constant> inline std::string StatisticsBase<constant>::to_json() const {
+    return Detail::to_string(clingo_statistics_to_json_size, clingo_statistics_to_json, stats_, key_);
+}
+
 template <bool constant> inline char const *StatisticsBase<constant>::key_name(size_t index) const {
     char const *ret = nullptr;
     Detail::handle_error(clingo_statistics_map_subkey_name(stats_, key_, index, &ret));
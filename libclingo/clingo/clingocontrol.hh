@@ -26,6 +26,7 @@
 #define CLINGO_CLINGOCONTROL_HH
 
 #include "clingo.h"
+#include <atomic>
 #include <clasp/clasp_facade.h>
 #include <clasp/cli/clasp_options.h>
 #include <clasp/clingo.h>
@@ -227,6 +228,8 @@ class ClingoControl : public clingo_control,
     bool onUnsat(Potassco::Span<int64_t> optimization);
     void onFinish(Clasp::ClaspFacade::Result ret);
     bool update();
+    // Adds the memory used for grounding to the statistics.
+    void updateGroundStatistics();
     Clasp::Asp::LogicProgram *claspProgram() const;
 
     virtual void postGround(Clasp::ProgramBuilder &prg) {
@@ -252,6 +255,11 @@ class ClingoControl : public clingo_control,
     bool eq(SymbolicAtomIter it, SymbolicAtomIter jt) const override;
     SymbolicAtomIter lookup(Symbol atom) const override;
     size_t length() const override;
+    size_t length(Sig sig) const override;
+    void fetch(Sig sig, size_t offset, Symbol *symbols, Potassco::Lit_t *literals, bool *facts, bool *externals,
+               size_t size) const override;
+    size_t findPattern(Sig sig, Potassco::Span<size_t> positions, Potassco::Span<Symbol> values,
+                       SymbolicAtomIter *iterators, size_t capacity) const override;
     std::vector<Sig> signatures() const override;
     Symbol atom(SymbolicAtomIter it) const override;
     Potassco::Lit_t literal(SymbolicAtomIter it) const override;
@@ -361,6 +369,8 @@ class ClingoControl : public clingo_control,
     std::unique_ptr<Ground::Program> backend_prg_;
     UserStatistics step_stats_;
     UserStatistics accu_stats_;
+    uint32_t fixed_ = std::numeric_limits<uint32_t>::max();
+    std::atomic<bool> groundInterrupted_{false};
     bool enableEnumAssupmption_ = true;
     bool enableCleanup_ = true;
     bool clingoMode_;
@@ -372,6 +382,7 @@ class ClingoControl : public clingo_control,
     bool incmode_ = false;
     bool canClean_ = false;
     bool preserveFacts_ = false;
+    bool groundDemand_ = false;
 };
 
 // {{{1 declaration of ClingoModel
@@ -59,6 +59,11 @@ struct clingo_symbolic_atoms {
     virtual Gringo::SymbolicAtomIter end() const = 0;
     virtual std::vector<Gringo::Sig> signatures() const = 0;
     virtual size_t length() const = 0;
+    virtual size_t length(Gringo::Sig sig) const = 0;
+    virtual void fetch(Gringo::Sig sig, size_t offset, Gringo::Symbol *symbols, Potassco::Lit_t *literals, bool *facts,
+                       bool *externals, size_t size) const = 0;
+    virtual size_t findPattern(Gringo::Sig sig, Potassco::Span<size_t> positions, Potassco::Span<Gringo::Symbol> values,
+                               Gringo::SymbolicAtomIter *iterators, size_t capacity) const = 0;
     virtual ~clingo_symbolic_atoms() noexcept = default;
 };
 
@@ -210,8 +215,11 @@ struct clingo_propagate_init {
     virtual Gringo::Output::DomainData const &theory() const = 0;
     virtual Gringo::SymbolicAtoms const &getDomain() const = 0;
     virtual Gringo::Lit_t mapLit(Gringo::Lit_t lit) const = 0;
+    virtual void mapLits(Potassco::LitSpan lits, Gringo::Lit_t *out) const = 0;
     virtual void addWatch(Gringo::Lit_t lit) = 0;
     virtual void addWatch(uint32_t solverId, Gringo::Lit_t lit) = 0;
+    virtual void addWatches(Potassco::LitSpan lits) = 0;
+    virtual void addWatches(uint32_t solverId, Potassco::LitSpan lits) = 0;
     virtual void removeWatch(Gringo::Lit_t lit) = 0;
     virtual void removeWatch(uint32_t solverId, Gringo::Lit_t lit) = 0;
     virtual void freezeLiteral(Gringo::Lit_t lit) = 0;
@@ -46,6 +46,9 @@ struct GringoOptions {
     bool rewriteMinimize = false;
     bool keepFacts = false;
     bool singleShot = false;
+    unsigned groundMemoryLimit = 0;
+    bool groundDemand = false;
+    SigVec retractable;
     SigVec sigvec;
 };
 
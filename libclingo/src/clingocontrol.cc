@@ -38,6 +38,7 @@
 #include <gringo/input/programbuilder.hh>
 #include <potassco/basic_types.h>
 #include <potassco/program_opts/typed_value.h>
+#include <sstream>
 #include <stdexcept>
 
 namespace Gringo {
@@ -219,7 +220,10 @@ void ClingoControl::parse(const StringVec &files, const ClingoOptions &opts, Cla
                                                       opts.outputOptions);
     }
     out_->keepFacts = opts.keepFacts;
+    out_->retractableFacts.insert(opts.retractable.begin(), opts.retractable.end());
+    out_->memoryLimit = static_cast<size_t>(opts.groundMemoryLimit) << 20U;
     preserveFacts_ = opts.outputOptions.preserveFacts;
+    groundDemand_ = opts.groundDemand;
     aspif_bck_ = gringo_make_unique<ControlBackend>(*this);
     pb_ =
         gringo_make_unique<Input::NongroundProgramBuilder>(scripts_, prg_, out_->outPreds, defs_, opts.rewriteMinimize);
@@ -264,6 +268,9 @@ bool ClingoControl::update() {
 }
 
 void ClingoControl::ground(Control::GroundVec const &parts, Context *context) {
+    // Note: interrupts arriving while the program is rewritten or prepared
+    // stop grounding as soon as instantiation starts
+    groundInterrupted_ = false;
     if (!update()) {
         return;
     }
@@ -284,11 +291,17 @@ void ClingoControl::ground(Control::GroundVec const &parts, Context *context) {
             params.add(x.first, SymVec(x.second));
             sigs.emplace(x.first, numeric_cast<uint32_t>(x.second.size()), false);
         }
-        auto gPrg = prg_.toGround(sigs, out_->data, logger_);
+        std::function<bool(Sig)> demand;
+        // slicing the program is only sound if no further parts are grounded
+        if (groundDemand_ && out_->outPreds.active() && (clasp_ == nullptr || !clasp_->incremental())) {
+            demand = [this](Sig sig) { return out_->outPreds.contains(sig); };
+        }
+        auto gPrg = prg_.toGround(sigs, out_->data, logger_, demand);
         LOG << "*********** intermediate program ***********" << std::endl << gPrg << std::endl;
         LOG << "************* grounded program *************" << std::endl;
         gPrg.prepare(params, *out_, logger_);
-        scripts_.withContext(context, [&, this](Context &ctx) { gPrg.ground(ctx, *out_, logger_); });
+        scripts_.withContext(context,
+                             [&, this](Context &ctx) { gPrg.ground(ctx, *out_, logger_, &groundInterrupted_); });
     }
 }
 
@@ -443,6 +456,7 @@ USolveFuture ClingoControl::solve(Assumptions ass, clingo_solve_mode_bitset_t mo
                       "");
         static_assert(clingo_solve_mode_async == static_cast<clingo_solve_mode_bitset_t>(Clasp::SolveMode_t::Async),
                       "");
+        updateGroundStatistics();
         if (cb) {
             step_stats_.init(clasp_->getStats(), "user_step");
             accu_stats_.init(clasp_->getStats(), "user_accu");
@@ -453,7 +467,36 @@ USolveFuture ClingoControl::solve(Assumptions ass, clingo_solve_mode_bitset_t mo
         return gringo_make_unique<DefaultSolveFuture>(std::move(cb));
     }
 }
-void ClingoControl::interrupt() { clasp_->interrupt(65); }
+void ClingoControl::updateGroundStatistics() {
+    using Potassco::Statistics_t;
+    auto *stats = clasp_->getStats();
+    auto grounding = stats->add(stats->root(), "grounding", Statistics_t::Map);
+    auto memory = stats->add(grounding, "memory", Statistics_t::Map);
+    auto set = [stats](Potassco::AbstractStatistics::Key_t map, char const *name, size_t value) {
+        stats->set(stats->add(map, name, Statistics_t::Value), static_cast<double>(value));
+    };
+    set(memory, "total", out_->memoryUsage());
+    set(memory, "symbols", Symbol::memoryUsage());
+    auto domains = stats->add(memory, "domains", Statistics_t::Map);
+    for (auto const &dom : out_->predDoms()) {
+        std::ostringstream oss;
+        oss << dom->sig();
+        set(domains, oss.str().c_str(), dom->memoryUsage());
+    }
+    if (out_->dedupActive()) {
+        set(memory, "dedup", out_->dedupMemoryUsage());
+        set(grounding, "dropped_rules", out_->dedupDropped());
+    }
+    auto minStats = out_->minimizeStats();
+    auto minimize = stats->add(grounding, "minimize", Statistics_t::Map);
+    set(minimize, "tuples", minStats.tuples);
+    set(minimize, "literals", minStats.literals);
+    set(minimize, "extensions", minStats.extensions);
+}
+void ClingoControl::interrupt() {
+    groundInterrupted_ = true;
+    clasp_->interrupt(65);
+}
 bool ClingoControl::blocked() { return clasp_->solving(); }
 
 namespace {
@@ -471,9 +514,25 @@ class ClingoPropagateInit : public PropagateInit {
         const auto &prg = static_cast<Clasp::Asp::LogicProgram &>(*facade_().program());
         return Clasp::encodeLit(prg.getLiteral(lit, Clasp::Asp::MapLit_t::Refined));
     }
+    void mapLits(Potassco::LitSpan lits, Lit_t *out) const override {
+        const auto &prg = static_cast<Clasp::Asp::LogicProgram &>(*facade_().program());
+        for (auto const &lit : lits) {
+            *out++ = Clasp::encodeLit(prg.getLiteral(lit, Clasp::Asp::MapLit_t::Refined));
+        }
+    }
     int threads() const override { return facade_().ctx.concurrency(); }
     void addWatch(Lit_t lit) override { p_.addWatch(Clasp::decodeLit(lit)); }
     void addWatch(uint32_t solverId, Lit_t lit) override { p_.addWatch(solverId, Clasp::decodeLit(lit)); }
+    void addWatches(Potassco::LitSpan lits) override {
+        for (auto const &lit : lits) {
+            p_.addWatch(Clasp::decodeLit(lit));
+        }
+    }
+    void addWatches(uint32_t solverId, Potassco::LitSpan lits) override {
+        for (auto const &lit : lits) {
+            p_.addWatch(solverId, Clasp::decodeLit(lit));
+        }
+    }
     void removeWatch(Lit_t lit) override { p_.removeWatch(Clasp::decodeLit(lit)); }
     void removeWatch(uint32_t solverId, Lit_t lit) override { p_.removeWatch(solverId, Clasp::decodeLit(lit)); }
     void freezeLiteral(Lit_t lit) override { p_.freezeLit(Clasp::decodeLit(lit)); }
@@ -607,9 +666,7 @@ const char *TheoryOutput::first(const Clasp::Model &) {
 
 const char *TheoryOutput::next() {
     if (index_ < symbols_.size()) {
-        std::stringstream ss;
-        symbols_[index_].print(ss);
-        current_ = ss.str();
+        current_ = symbols_[index_].printCached();
         ++index_;
         return current_.c_str();
     }
@@ -661,7 +718,12 @@ void ClingoControl::cleanup() {
         }
         return std::make_pair(external, truth);
     };
-    auto stats = out_->simplify(assignment);
+    // The number of literals fixed at the top level can only grow. If it did
+    // not change since the last cleanup, only new atoms have to be inspected.
+    auto fixed = solver.decisionLevel() == 0 ? solver.numAssignedVars() : solver.levelStart(1);
+    bool changed = fixed != fixed_;
+    fixed_ = fixed;
+    auto stats = out_->simplify(assignment, changed);
     LOG << stats.first << " atom" << (stats.first == 1 ? "" : "s") << " became facts" << std::endl;
     LOG << stats.second << " atom" << (stats.second == 1 ? "" : "s") << " deleted" << std::endl;
 }
@@ -858,6 +920,73 @@ size_t ClingoControl::length() const {
     return ret;
 }
 
+size_t ClingoControl::length(Sig sig) const {
+    auto it = out_->predDoms().find(sig);
+    return it != out_->predDoms().end() && !skipDomain(sig) ? (*it)->size() : 0;
+}
+
+void ClingoControl::fetch(Sig sig, size_t offset, Symbol *symbols, Potassco::Lit_t *literals, bool *facts,
+                          bool *externals, size_t size) const {
+    if (size == 0) {
+        return;
+    }
+    if (offset + size > length(sig)) {
+        throw std::runtime_error("range exceeds number of atoms");
+    }
+    auto &dom = **out_->predDoms().find(sig);
+    auto *prg = clingoMode_ ? claspProgram() : nullptr;
+    for (auto it = dom.begin() + offset, ie = it + size; it != ie; ++it) {
+        auto &elem = *it;
+        if (symbols != nullptr) {
+            *symbols++ = elem;
+        }
+        if (literals != nullptr) {
+            *literals++ = elem.hasUid() ? elem.uid() : 0;
+        }
+        if (facts != nullptr) {
+            *facts++ = elem.fact();
+        }
+        if (externals != nullptr) {
+            *externals++ = elem.hasUid() && elem.isExternal() && (prg == nullptr || prg->isExternal(elem.uid()));
+        }
+    }
+}
+
+size_t ClingoControl::findPattern(Sig sig, Potassco::Span<size_t> positions, Potassco::Span<Symbol> values,
+                                  SymbolicAtomIter *iterators, size_t capacity) const {
+    std::vector<std::pair<unsigned, Symbol>> pattern;
+    for (size_t i = 0; i < positions.size; ++i) {
+        if (positions[i] >= sig.arity()) {
+            throw std::runtime_error("argument position out of range");
+        }
+        pattern.emplace_back(static_cast<unsigned>(positions[i]), values[i]);
+    }
+    // indices are shared between queries binding the same positions
+    std::sort(pattern.begin(), pattern.end(), [](auto const &a, auto const &b) { return a.first < b.first; });
+    auto dup = std::adjacent_find(pattern.begin(), pattern.end(),
+                                  [](auto const &a, auto const &b) { return a.first == b.first; });
+    if (dup != pattern.end()) {
+        throw std::runtime_error("argument position given twice");
+    }
+    auto it = out_->predDoms().find(sig);
+    if (it == out_->predDoms().end() || skipDomain(sig)) {
+        return 0;
+    }
+    std::vector<unsigned> bound;
+    SymVec vals;
+    for (auto const &x : pattern) {
+        bound.emplace_back(x.first);
+        vals.emplace_back(x.second);
+    }
+    auto &dom = **it;
+    auto const &offsets = dom.lookup(bound, vals);
+    auto n = std::min(capacity, offsets.size());
+    for (size_t i = 0; i < n; ++i) {
+        iterators[i] = SymbolicAtomOffset(dom.domainOffset(), false, offsets[i], false).repr;
+    }
+    return offsets.size();
+}
+
 bool ClingoControl::beginAddBackend() {
     update();
     backend_prg_ = std::make_unique<Ground::Program>(prg_.toGround({}, out_->data, logger_));
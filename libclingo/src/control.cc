@@ -33,7 +33,10 @@
 #include <clingo/astv2.hh>
 #include <clingo/clingo_app.hh>
 #include <clingo/clingocontrol.hh>
+#include <cmath>
 #include <cstdarg>
+#include <cstdio>
+#include <cstring>
 #include <gringo/input/groundtermparser.hh>
 #include <gringo/input/nongroundparser.hh>
 #include <gringo/input/programbuilder.hh>
@@ -384,18 +387,24 @@ extern "C" clingo_symbol_type_t clingo_symbol_type(clingo_symbol_t val) {
 
 extern "C" bool clingo_symbol_to_string_size(clingo_symbol_t val, size_t *n) {
     GRINGO_CLINGO_TRY {
-        *n = print_size([&val](std::ostream &out) { Symbol(val).print(out); });
+        *n = std::strlen(Symbol(val).printCached()) + 1;
     }
     GRINGO_CLINGO_CATCH;
 }
 
 extern "C" bool clingo_symbol_to_string(clingo_symbol_t val, char *ret, size_t n) {
     GRINGO_CLINGO_TRY {
-        print(ret, n, [&val](std::ostream &out) { Symbol(val).print(out); });
+        auto const *str = Symbol(val).printCached();
+        print(ret, n, [str](std::ostream &out) { out << str; });
     }
     GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_symbol_to_cached_string(clingo_symbol_t val, char const **ret) {
+    GRINGO_CLINGO_TRY { *ret = Symbol(val).printCached(); }
+    GRINGO_CLINGO_CATCH;
+}
+
 extern "C" bool clingo_symbol_is_equal_to(clingo_symbol_t a, clingo_symbol_t b) { return Symbol(a) == Symbol(b); }
 
 extern "C" bool clingo_symbol_is_less_than(clingo_symbol_t a, clingo_symbol_t b) { return Symbol(a) < Symbol(b); }
@@ -457,6 +466,33 @@ extern "C" bool clingo_symbolic_atoms_size(clingo_symbolic_atoms_t const *dom, s
     GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_symbolic_atoms_signature_size(clingo_symbolic_atoms_t const *dom, clingo_signature_t sig,
+                                                     size_t *size) {
+    GRINGO_CLINGO_TRY { *size = dom->length(Sig(sig)); }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" bool clingo_symbolic_atoms_fetch(clingo_symbolic_atoms_t const *dom, clingo_signature_t sig, size_t offset,
+                                            clingo_symbol_t *symbols, clingo_literal_t *literals, bool *facts,
+                                            bool *externals, size_t size) {
+    GRINGO_CLINGO_TRY {
+        dom->fetch(Sig(sig), offset, reinterpret_cast<Symbol *>(symbols), literals, facts, externals, size); // NOLINT
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" bool clingo_symbolic_atoms_find_pattern(clingo_symbolic_atoms_t const *dom, clingo_signature_t sig,
+                                                   size_t const *positions, clingo_symbol_t const *values, size_t size,
+                                                   clingo_symbolic_atom_iterator_t *iterators, size_t capacity,
+                                                   size_t *matches) {
+    GRINGO_CLINGO_TRY {
+        *matches = dom->findPattern(Sig(sig), {positions, size},
+                                    {reinterpret_cast<Symbol const *>(values), size}, // NOLINT
+                                    iterators, capacity);
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
 extern "C" bool clingo_symbolic_atoms_symbol(clingo_symbolic_atoms_t const *dom, clingo_symbolic_atom_iterator_t atm,
                                              clingo_symbol_t *sym) {
     GRINGO_CLINGO_TRY { *sym = dom->atom(atm).rep(); }
@@ -590,6 +626,57 @@ extern "C" bool clingo_theory_atoms_size(clingo_theory_atoms_t const *atoms, siz
     GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_theory_atoms_terms_size(clingo_theory_atoms_t const *atoms, size_t *ret) {
+    GRINGO_CLINGO_TRY { *ret = atoms->numTerms(); }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" bool clingo_theory_atoms_elements_size(clingo_theory_atoms_t const *atoms, size_t *ret) {
+    GRINGO_CLINGO_TRY { *ret = atoms->numElems(); }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" bool clingo_theory_atoms_fetch_terms(clingo_theory_atoms_t const *atoms, clingo_id_t offset,
+                                                clingo_theory_term_type_t *types, int *values, size_t *argument_offsets,
+                                                size_t size) {
+    GRINGO_CLINGO_TRY { atoms->fetchTerms(offset, size, types, values, argument_offsets); }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" bool clingo_theory_atoms_fetch_term_arguments(clingo_theory_atoms_t const *atoms, clingo_id_t offset,
+                                                         size_t size, clingo_id_t *arguments, size_t capacity) {
+    GRINGO_CLINGO_TRY { atoms->fetchTermArgs(offset, size, arguments, capacity); }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" bool clingo_theory_atoms_fetch_elements(clingo_theory_atoms_t const *atoms, clingo_id_t offset,
+                                                   clingo_literal_t *conditions, size_t *tuple_offsets, size_t size) {
+    GRINGO_CLINGO_TRY { atoms->fetchElems(offset, size, conditions, tuple_offsets); }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" bool clingo_theory_atoms_fetch_element_tuples(clingo_theory_atoms_t const *atoms, clingo_id_t offset,
+                                                         size_t size, clingo_id_t *tuples, size_t capacity) {
+    GRINGO_CLINGO_TRY { atoms->fetchElemTuples(offset, size, tuples, capacity); }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" bool clingo_theory_atoms_fetch_atoms(clingo_theory_atoms_t const *atoms, clingo_id_t offset,
+                                                clingo_literal_t *literals, clingo_id_t *terms, bool *has_guard,
+                                                clingo_id_t *guard_connectives, clingo_id_t *guard_terms,
+                                                size_t *element_offsets, size_t size) {
+    GRINGO_CLINGO_TRY {
+        atoms->fetchAtoms(offset, size, literals, terms, has_guard, guard_connectives, guard_terms, element_offsets);
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" bool clingo_theory_atoms_fetch_atom_elements(clingo_theory_atoms_t const *atoms, clingo_id_t offset,
+                                                        size_t size, clingo_id_t *elements, size_t capacity) {
+    GRINGO_CLINGO_TRY { atoms->fetchAtomElems(offset, size, elements, capacity); }
+    GRINGO_CLINGO_CATCH;
+}
+
 extern "C" bool clingo_theory_atoms_term_to_string_size(clingo_theory_atoms_t const *atoms, clingo_id_t value,
                                                         size_t *n) {
     GRINGO_CLINGO_TRY {
@@ -726,6 +813,12 @@ extern "C" bool clingo_propagate_init_solver_literal(clingo_propagate_init_t con
     GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_propagate_init_solver_literals(clingo_propagate_init_t const *init, clingo_literal_t const *lits,
+                                                      size_t size, clingo_literal_t *ret) {
+    GRINGO_CLINGO_TRY { init->mapLits({lits, size}, ret); }
+    GRINGO_CLINGO_CATCH;
+}
+
 extern "C" bool clingo_propagate_init_add_watch(clingo_propagate_init_t *init, clingo_literal_t lit) {
     GRINGO_CLINGO_TRY { init->addWatch(lit); }
     GRINGO_CLINGO_CATCH;
@@ -737,6 +830,18 @@ extern "C" bool clingo_propagate_init_add_watch_to_thread(clingo_propagate_init_
     GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_propagate_init_add_watches(clingo_propagate_init_t *init, clingo_literal_t const *lits,
+                                                  size_t size) {
+    GRINGO_CLINGO_TRY { init->addWatches({lits, size}); }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" bool clingo_propagate_init_add_watches_to_thread(clingo_propagate_init_t *init, clingo_literal_t const *lits,
+                                                            size_t size, clingo_id_t thread_id) {
+    GRINGO_CLINGO_TRY { init->addWatches(thread_id, {lits, size}); }
+    GRINGO_CLINGO_CATCH;
+}
+
 extern "C" bool clingo_propagate_init_remove_watch(clingo_propagate_init_t *init, clingo_literal_t lit) {
     GRINGO_CLINGO_TRY { init->removeWatch(lit); }
     GRINGO_CLINGO_CATCH;
@@ -838,6 +943,18 @@ extern "C" bool clingo_propagate_control_add_clause(clingo_propagate_control_t *
     GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_propagate_control_add_clauses(clingo_propagate_control_t *ctl, clingo_literal_t const *literals,
+                                                     size_t const *offsets, size_t size, clingo_clause_type_t prop,
+                                                     bool *ret) {
+    GRINGO_CLINGO_TRY {
+        *ret = true;
+        for (size_t i = 0; i < size && *ret; ++i) {
+            *ret = ctl->addClause({literals + offsets[i], offsets[i + 1] - offsets[i]}, Potassco::Clause_t(prop));
+        }
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
 extern "C" bool clingo_propagate_control_propagate(clingo_propagate_control_t *ctl, bool *ret) {
     GRINGO_CLINGO_TRY { *ret = ctl->propagate(); }
     GRINGO_CLINGO_CATCH;
@@ -862,6 +979,23 @@ extern "C" void clingo_propagate_control_remove_watch(clingo_propagate_control_t
     control->removeWatch(literal);
 }
 
+extern "C" bool clingo_propagate_control_add_watches(clingo_propagate_control_t *control,
+                                                     clingo_literal_t const *literals, size_t size) {
+    GRINGO_CLINGO_TRY {
+        for (auto const *it = literals, *ie = literals + size; it != ie; ++it) {
+            control->addWatch(*it);
+        }
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" void clingo_propagate_control_remove_watches(clingo_propagate_control_t *control,
+                                                        clingo_literal_t const *literals, size_t size) {
+    for (auto const *it = literals, *ie = literals + size; it != ie; ++it) {
+        control->removeWatch(*it);
+    }
+}
+
 // {{{1 model
 
 struct clingo_solve_control : clingo_model {};
@@ -1107,6 +1241,83 @@ extern "C" bool clingo_configuration_value_is_assigned(clingo_configuration_t co
 
 struct clingo_statistic : public Potassco::AbstractStatistics {};
 
+namespace {
+
+void printJSONString(std::ostream &out, char const *str) {
+    out << '"';
+    for (; *str != '\0'; ++str) {
+        auto c = *str;
+        switch (c) {
+            case '"': {
+                out << "\\\"";
+                break;
+            }
+            case '\\': {
+                out << "\\\\";
+                break;
+            }
+            default: {
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+                    out << buf;
+                } else {
+                    out << c;
+                }
+            }
+        }
+    }
+    out << '"';
+}
+
+void printJSON(std::ostream &out, Potassco::AbstractStatistics const &stats, uint64_t key) {
+    switch (stats.type(key)) {
+        case Potassco::Statistics_t::Value: {
+            auto value = stats.value(key);
+            if (std::isfinite(value)) {
+                // 17 significant digits are enough to restore the double
+                char buf[32];
+                std::snprintf(buf, sizeof(buf), "%.17g", value);
+                out << buf;
+            } else {
+                out << "null";
+            }
+            break;
+        }
+        case Potassco::Statistics_t::Array: {
+            out << '[';
+            for (size_t i = 0, n = stats.size(key); i < n; ++i) {
+                if (i > 0) {
+                    out << ',';
+                }
+                printJSON(out, stats, stats.at(key, i));
+            }
+            out << ']';
+            break;
+        }
+        case Potassco::Statistics_t::Map: {
+            out << '{';
+            for (size_t i = 0, n = stats.size(key); i < n; ++i) {
+                if (i > 0) {
+                    out << ',';
+                }
+                auto const *name = stats.key(key, i);
+                printJSONString(out, name);
+                out << ':';
+                printJSON(out, stats, stats.get(key, name));
+            }
+            out << '}';
+            break;
+        }
+        default: {
+            out << "null";
+            break;
+        }
+    }
+}
+
+} // namespace
+
 extern "C" bool clingo_statistics_root(clingo_statistics_t const *stats, uint64_t *ret) {
     GRINGO_CLINGO_TRY { *ret = stats->root(); }
     GRINGO_CLINGO_CATCH;
@@ -1176,6 +1387,20 @@ extern "C" bool clingo_statistics_value_set(clingo_statistics_t *stats, uint64_t
     GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_statistics_to_json_size(clingo_statistics_t const *stats, uint64_t key, size_t *size) {
+    GRINGO_CLINGO_TRY {
+        *size = print_size([stats, key](std::ostream &out) { printJSON(out, *stats, key); });
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" bool clingo_statistics_to_json(clingo_statistics_t const *stats, uint64_t key, char *string, size_t size) {
+    GRINGO_CLINGO_TRY {
+        print(string, size, [stats, key](std::ostream &out) { printJSON(out, *stats, key); });
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
 // {{{1 global functions
 
 extern "C" bool clingo_parse_term(char const *str, clingo_logger_t logger, void *data, unsigned message_limit,
@@ -2265,7 +2490,7 @@ class Observer : public Backend {
         call(obs_.theory_atom_with_guard, atomOrZero, termId, elements.first, elements.size, op, rhs);
     }
 
-  private:
+  protected:
     template <class CB, class... Args> void call(CB *cb, Args &&...args) {
         if (cb && !(*cb)(std::forward<Args>(args)..., data_)) {
             throw ClingoError();
@@ -2277,6 +2502,216 @@ class Observer : public Backend {
     void *data_;
 };
 
+// Collects rules, weight rules, output atoms, and theory elements in flat
+// arrays and passes them in batches. To preserve the order of directives,
+// pending directives are passed whenever a directive of another kind is
+// observed.
+class BatchObserver : public Observer {
+  public:
+    BatchObserver(clingo_ground_program_observer_t obs, clingo_ground_program_batch_observer_t batch, size_t size,
+                  void *data)
+        : Observer(obs, data), batch_(batch), size_(std::max(size, size_t{1})),
+          choices_(std::make_unique<bool[]>(size_)) {}
+    ~BatchObserver() override = default;
+
+    void initProgram(bool incremental) override {
+        flush_();
+        Observer::initProgram(incremental);
+    }
+    void beginStep() override {
+        flush_();
+        Observer::beginStep();
+    }
+    void endStep() override {
+        flush_();
+        Observer::endStep();
+    }
+
+    void rule(Potassco::Head_t ht, Potassco::AtomSpan const &head, Potassco::LitSpan const &body) override {
+        if (batch_.rules == nullptr) {
+            flush_();
+            Observer::rule(ht, head, body);
+            return;
+        }
+        begin_(Kind::Rule);
+        choices_[count_++] = ht == Potassco::Head_t::Choice;
+        append_(headOffsets_, heads_, head);
+        append_(bodyOffsets_, lits_, body);
+        end_();
+    }
+    void rule(Potassco::Head_t ht, Potassco::AtomSpan const &head, Weight_t bound,
+              Potassco::WeightLitSpan const &body) override {
+        if (batch_.weight_rules == nullptr) {
+            flush_();
+            Observer::rule(ht, head, bound, body);
+            return;
+        }
+        begin_(Kind::WeightRule);
+        choices_[count_++] = ht == Potassco::Head_t::Choice;
+        append_(headOffsets_, heads_, head);
+        weights_.emplace_back(bound);
+        append_(bodyOffsets_, wlits_, body);
+        end_();
+    }
+    void minimize(Weight_t prio, Potassco::WeightLitSpan const &lits) override {
+        flush_();
+        Observer::minimize(prio, lits);
+    }
+    void project(Potassco::AtomSpan const &atoms) override {
+        flush_();
+        Observer::project(atoms);
+    }
+    void output(Symbol sym, Potassco::Atom_t atom) override {
+        if (batch_.output_atoms == nullptr) {
+            flush_();
+            Observer::output(sym, atom);
+            return;
+        }
+        begin_(Kind::OutputAtom);
+        ++count_;
+        symbols_.emplace_back(sym.rep());
+        heads_.emplace_back(atom);
+        end_();
+    }
+    void output(Symbol sym, Potassco::LitSpan const &condition) override {
+        flush_();
+        Observer::output(sym, condition);
+    }
+    void external(Atom_t a, Potassco::Value_t v) override {
+        flush_();
+        Observer::external(a, v);
+    }
+    void assume(Potassco::LitSpan const &lits) override {
+        flush_();
+        Observer::assume(lits);
+    }
+    void heuristic(Atom_t a, Potassco::Heuristic_t t, int bias, unsigned prio,
+                   Potassco::LitSpan const &condition) override {
+        flush_();
+        Observer::heuristic(a, t, bias, prio, condition);
+    }
+    void acycEdge(int s, int t, Potassco::LitSpan const &condition) override {
+        flush_();
+        Observer::acycEdge(s, t, condition);
+    }
+
+    void theoryTerm(Id_t termId, int number) override {
+        flush_();
+        Observer::theoryTerm(termId, number);
+    }
+    void theoryTerm(Id_t termId, StringSpan const &name) override {
+        flush_();
+        Observer::theoryTerm(termId, name);
+    }
+    void theoryTerm(Id_t termId, int cId, Potassco::IdSpan const &args) override {
+        flush_();
+        Observer::theoryTerm(termId, cId, args);
+    }
+    void theoryElement(Id_t elementId, Potassco::IdSpan const &terms, Potassco::LitSpan const &cond) override {
+        if (batch_.theory_elements == nullptr) {
+            flush_();
+            Observer::theoryElement(elementId, terms, cond);
+            return;
+        }
+        begin_(Kind::TheoryElement);
+        ++count_;
+        heads_.emplace_back(elementId);
+        append_(headOffsets_, ids_, terms);
+        append_(bodyOffsets_, lits_, cond);
+        end_();
+    }
+    void theoryAtom(Id_t atomOrZero, Id_t termId, Potassco::IdSpan const &elements) override {
+        flush_();
+        Observer::theoryAtom(atomOrZero, termId, elements);
+    }
+    void theoryAtom(Id_t atomOrZero, Id_t termId, Potassco::IdSpan const &elements, Id_t op, Id_t rhs) override {
+        flush_();
+        Observer::theoryAtom(atomOrZero, termId, elements, op, rhs);
+    }
+
+  private:
+    enum class Kind { None, Rule, WeightRule, OutputAtom, TheoryElement };
+
+    template <class T> static void append_(std::vector<size_t> &offsets, std::vector<T> &vec, Potassco::Span<T> span) {
+        if (offsets.empty()) {
+            offsets.emplace_back(0);
+        }
+        vec.insert(vec.end(), Potassco::begin(span), Potassco::end(span));
+        offsets.emplace_back(vec.size());
+    }
+
+    void begin_(Kind kind) {
+        if (kind_ != kind) {
+            flush_();
+            kind_ = kind;
+        }
+    }
+
+    void end_() {
+        if (count_ == size_) {
+            flush_();
+        }
+    }
+
+    void flush_() {
+        if (count_ > 0) {
+            switch (kind_) {
+                case Kind::Rule: {
+                    clingo_rule_batch_t batch{choices_.get(),      headOffsets_.data(), heads_.data(),
+                                              bodyOffsets_.data(), lits_.data(),        count_};
+                    call(batch_.rules, &batch);
+                    break;
+                }
+                case Kind::WeightRule: {
+                    clingo_weight_rule_batch_t batch{
+                        choices_.get(), headOffsets_.data(), heads_.data(), weights_.data(), bodyOffsets_.data(),
+                        reinterpret_cast<clingo_weighted_literal_t const *>(wlits_.data()), count_};
+                    call(batch_.weight_rules, &batch);
+                    break;
+                }
+                case Kind::OutputAtom: {
+                    clingo_output_atom_batch_t batch{symbols_.data(), heads_.data(), count_};
+                    call(batch_.output_atoms, &batch);
+                    break;
+                }
+                case Kind::TheoryElement: {
+                    clingo_theory_element_batch_t batch{heads_.data(),       headOffsets_.data(), ids_.data(),
+                                                        bodyOffsets_.data(), lits_.data(),        count_};
+                    call(batch_.theory_elements, &batch);
+                    break;
+                }
+                case Kind::None: {
+                    break;
+                }
+            }
+        }
+        count_ = 0;
+        kind_ = Kind::None;
+        headOffsets_.clear();
+        bodyOffsets_.clear();
+        heads_.clear();
+        ids_.clear();
+        lits_.clear();
+        wlits_.clear();
+        weights_.clear();
+        symbols_.clear();
+    }
+
+    clingo_ground_program_batch_observer_t batch_;
+    size_t size_;
+    size_t count_ = 0;
+    Kind kind_ = Kind::None;
+    std::unique_ptr<bool[]> choices_;
+    std::vector<size_t> headOffsets_;
+    std::vector<size_t> bodyOffsets_;
+    std::vector<Potassco::Atom_t> heads_;
+    std::vector<Potassco::Id_t> ids_;
+    std::vector<Potassco::Lit_t> lits_;
+    std::vector<Potassco::WeightLit_t> wlits_;
+    std::vector<Weight_t> weights_;
+    std::vector<clingo_symbol_t> symbols_;
+};
+
 } // namespace
 
 extern "C" bool clingo_control_register_observer(clingo_control_t *control,
@@ -2286,6 +2721,17 @@ extern "C" bool clingo_control_register_observer(clingo_control_t *control,
     GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_control_register_batch_observer(clingo_control_t *control,
+                                                       clingo_ground_program_observer_t const *observer,
+                                                       clingo_ground_program_batch_observer_t const *batch_observer,
+                                                       size_t batch_size, bool replace, void *data) {
+    GRINGO_CLINGO_TRY {
+        control->registerObserver(gringo_make_unique<BatchObserver>(*observer, *batch_observer, batch_size, data),
+                                  replace);
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
 extern "C" bool clingo_control_register_backend(clingo_control_t *control, clingo_backend_type_t type, char const *file,
                                                 bool replace) {
     GRINGO_CLINGO_TRY {
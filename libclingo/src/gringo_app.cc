@@ -23,7 +23,9 @@
 // }}}
 
 #include "clingo.h"
+#include <algorithm>
 #include <climits>
+#include <cstdio>
 #include <clingo/astv2.hh>
 #include <clingo/control.hh>
 #include <clingo/gringo_options.hh>
@@ -39,6 +41,7 @@
 #include <potassco/application.h>
 #include <potassco/program_opts/typed_value.h>
 #include <stdexcept>
+#include <vector>
 
 namespace Gringo {
 
@@ -52,6 +55,8 @@ struct IncrementalControl : Control, private Output::ASPIFOutBackend {
         using namespace Gringo;
         // TODO: should go where python script is once refactored
         out.keepFacts = opts.keepFacts;
+        out.retractableFacts.insert(opts.retractable.begin(), opts.retractable.end());
+        out.memoryLimit = static_cast<size_t>(opts.groundMemoryLimit) << 20U;
         logger_.enable(Warnings::OperationUndefined, !opts.wNoOperationUndefined);
         logger_.enable(Warnings::AtomUndefined, !opts.wNoAtomUndef);
         logger_.enable(Warnings::FileIncluded, !opts.wNoFileIncluded);
@@ -129,7 +134,12 @@ struct IncrementalControl : Control, private Output::ASPIFOutBackend {
                 params.add(x.first, SymVec(x.second));
                 sigs.emplace(x.first, numeric_cast<uint32_t>(x.second.size()), false);
             }
-            Ground::Program gPrg(prg.toGround(sigs, out.data, logger_));
+            std::function<bool(Sig)> demand;
+            // slicing the program is only sound if no further parts are grounded
+            if (opts.groundDemand && out.outPreds.active() && !incmode) {
+                demand = [this](Sig sig) { return out.outPreds.contains(sig); };
+            }
+            Ground::Program gPrg(prg.toGround(sigs, out.data, logger_, demand));
             LOG << "************* intermediate program *************" << std::endl << gPrg << std::endl;
             LOG << "*************** grounded program ***************" << std::endl;
             gPrg.prepare(params, out, logger_);
@@ -287,6 +297,53 @@ struct IncrementalControl : Control, private Output::ASPIFOutBackend {
 };
 #undef LOG
 
+// Buffers output in large chunks before writing it to stdout.
+class StdoutBuffer : public std::streambuf {
+  public:
+    explicit StdoutBuffer(size_t size = 1U << 20U) : buf_(size) { setp(buf_.data(), buf_.data() + buf_.size()); }
+    StdoutBuffer(StdoutBuffer const &other) = delete;
+    StdoutBuffer(StdoutBuffer &&other) noexcept = delete;
+    StdoutBuffer &operator=(StdoutBuffer const &other) = delete;
+    StdoutBuffer &operator=(StdoutBuffer &&other) noexcept = delete;
+    ~StdoutBuffer() noexcept override { sync(); }
+
+  protected:
+    int_type overflow(int_type ch) override {
+        if (!write_()) {
+            return traits_type::eof();
+        }
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(ch);
+            pbump(1);
+        }
+        return traits_type::not_eof(ch);
+    }
+    std::streamsize xsputn(char const *str, std::streamsize n) override {
+        auto size = static_cast<size_t>(n);
+        if (size > static_cast<size_t>(epptr() - pptr()) && !write_()) {
+            return 0;
+        }
+        // writes larger than the buffer bypass it
+        if (size > buf_.size()) {
+            return static_cast<std::streamsize>(std::fwrite(str, 1, size, stdout));
+        }
+        std::copy(str, str + size, pptr()); // NOLINT
+        pbump(static_cast<int>(n));
+        return n;
+    }
+    int sync() override { return write_() && std::fflush(stdout) == 0 ? 0 : -1; }
+
+  private:
+    bool write_() {
+        auto size = static_cast<size_t>(pptr() - pbase());
+        bool ret = size == 0 || std::fwrite(pbase(), 1, size, stdout) == size;
+        setp(buf_.data(), buf_.data() + buf_.size());
+        return ret;
+    }
+
+    std::vector<char> buf_;
+};
+
 struct GringoApp : public Potassco::Application {
     using StringSeq = std::vector<std::string>;
     const char *getName() const override { return "gringo"; }
@@ -361,8 +418,11 @@ struct GringoApp : public Potassco::Application {
             }
             Potassco::TheoryData data;
             data.update();
-            Output::OutputBase out(data, std::move(outPreds), std::cout, grOpts_.outputFormat, grOpts_.outputOptions);
+            StdoutBuffer buf;
+            std::ostream os(&buf);
+            Output::OutputBase out(data, std::move(outPreds), os, grOpts_.outputFormat, grOpts_.outputOptions);
             ground(out);
+            os.flush();
         } catch (GringoError const &e) {
             std::cerr << e.what() << std::endl;
             throw std::runtime_error("fatal error");
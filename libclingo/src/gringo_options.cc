@@ -230,8 +230,18 @@ void registerOptions(Potassco::ProgramOptions::OptionGroup &group, GringoOptions
              level(1));
         push(name("reify-steps"), flag(opts.outputOptions.reifySteps = false), "Add step numbers to reified output",
              level(1));
+        push(name("output-pipeline"), flag(opts.outputOptions.pipeline = false),
+             "Write non-text output in a separate thread while grounding", level(1));
     }
     push(name("show-preds"), storeTo(opts.sigvec, parseSigVec), "Show the given signatures", level(1));
     push(name("single-shot"), flag(opts.singleShot = false), "Force single-shot solving mode", level(2));
+    push(name("ground-memory-limit"), storeTo(opts.groundMemoryLimit = 0)->arg("<n>"),
+         "Stop grounding if domains use more than %A MB (0 = no limit)", level(1));
+    push(name("ground-demand"), flag(opts.groundDemand = false),
+         "Only ground rules needed for shown atoms (single-shot only)", level(1));
+    push(name("dedup-rules"), flag(opts.outputOptions.dedupRules = false),
+         "Drop duplicate ground rules before passing them to the backend", level(1));
+    push(name("retractable-facts"), storeTo(opts.retractable, parseSigVec)->arg("<sigs>"),
+         "Pass facts over the given signatures as externals assigned to true", level(1));
 }
 } // namespace Gringo
@@ -28,6 +28,7 @@
 #include <iostream>
 #include <iterator>
 #include <sstream>
+#include <thread>
 #ifdef _MSC_VER
 #pragma warning(disable : 4996) // 'tmpnam': may be unsafe.
 #endif
@@ -175,6 +176,9 @@ TEST_CASE("solving", "[clingo]") {
                     map = accu.add_subkey("map", StatisticsType::Map);
                     map.add_subkey("x", StatisticsType::Value).set_value(3);
                     map.add_subkey("y", StatisticsType::Value).set_value(4);
+                    auto arr = accu.add_subkey("arr", StatisticsType::Array);
+                    arr.push(StatisticsType::Value).set_value(0.5);
+                    arr.push(StatisticsType::Map);
                 }
             } handler;
             REQUIRE(test_solve(ctl.solve(Clingo::LiteralSpan{}, &handler), models).is_satisfiable());
@@ -189,6 +193,8 @@ TEST_CASE("solving", "[clingo]") {
             REQUIRE(stats["user_accu.map.y"].type() == StatisticsType::Value);
             REQUIRE(stats["user_accu.map.x"].value() == 3);
             REQUIRE(stats["user_accu.map.y"].value() == 4);
+            REQUIRE(stats["user_step.map"].to_json() == "{\"x\":1,\"y\":2}");
+            REQUIRE(stats["user_accu.arr"].to_json() == "[0.5,{}]");
         }
         SECTION("configuration") {
             auto conf = ctl.configuration();
@@ -493,6 +499,48 @@ TEST_CASE("solving", "[clingo]") {
                 }
             }
             REQUIRE(count == 2);
+            // bulk export
+            auto const *c_atoms = atoms.to_c();
+            size_t n_terms = 0;
+            size_t n_elems = 0;
+            Detail::handle_error(clingo_theory_atoms_terms_size(c_atoms, &n_terms));
+            Detail::handle_error(clingo_theory_atoms_elements_size(c_atoms, &n_elems));
+            REQUIRE(n_elems == 1);
+            std::vector<clingo_theory_term_type_t> types(n_terms);
+            std::vector<int> values(n_terms);
+            std::vector<size_t> offsets(n_terms + 1);
+            Detail::handle_error(
+                clingo_theory_atoms_fetch_terms(c_atoms, 0, types.data(), values.data(), offsets.data(), n_terms));
+            std::vector<clingo_id_t> ids(offsets.back());
+            Detail::handle_error(clingo_theory_atoms_fetch_term_arguments(c_atoms, 0, n_terms, ids.data(), ids.size()));
+            for (clingo_id_t i = 0; i < n_terms; ++i) {
+                TheoryTerm term{c_atoms, i};
+                REQUIRE(types[i] == static_cast<clingo_theory_term_type_t>(term.type()));
+                if (term.type() == TheoryTermType::Number) {
+                    REQUIRE(values[i] == term.number());
+                } else if (term.type() == TheoryTermType::Function) {
+                    REQUIRE(TheoryTerm{c_atoms, static_cast<clingo_id_t>(values[i])}.name() == S(term.name()));
+                }
+                std::vector<clingo_id_t> args;
+                for (auto arg : term.arguments()) {
+                    args.emplace_back(arg.to_c());
+                }
+                REQUIRE(std::vector<clingo_id_t>(ids.begin() + offsets[i], ids.begin() + offsets[i + 1]) == args);
+            }
+            clingo_literal_t cond = 0;
+            Detail::handle_error(clingo_theory_atoms_fetch_elements(c_atoms, 0, &cond, offsets.data(), 1));
+            REQUIRE(cond == atoms.begin()->elements().begin()->condition_id());
+            REQUIRE(offsets[1] == 3);
+            clingo_id_t elem = 1;
+            bool has_guard = true;
+            Detail::handle_error(clingo_theory_atoms_fetch_atoms(c_atoms, 0, nullptr, nullptr, &has_guard, nullptr,
+                                                                 nullptr, offsets.data(), 1));
+            Detail::handle_error(clingo_theory_atoms_fetch_atom_elements(c_atoms, 0, 1, &elem, 1));
+            REQUIRE(!has_guard);
+            REQUIRE(offsets[1] == 1);
+            REQUIRE(elem == 0);
+            REQUIRE_THROWS(Detail::handle_error(
+                clingo_theory_atoms_fetch_atoms(c_atoms, 1, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 1)));
             REQUIRE(test_solve(ctl.solve({{Id("p"), true}, {Id("q"), true}}), models).is_satisfiable());
             REQUIRE(models == ModelVec({{Id("p"), Id("q")}}));
             REQUIRE(atoms.size() == 0);
@@ -548,6 +596,54 @@ TEST_CASE("solving", "[clingo]") {
             }
             std::sort(symbols.begin(), symbols.end());
             REQUIRE(symbols == SymbolVector({p1, p2, p3}));
+
+            auto sig = Signature("p", 1);
+            REQUIRE(atoms.length(sig) == 3);
+            REQUIRE(atoms.length(Signature("r", 1)) == 0);
+            SymbolVector fetched(2, Number(0));
+            std::vector<literal_t> lits(2);
+            bool facts[2] = {false, false};
+            bool externals[2] = {false, false};
+            atoms.fetch(sig, 1, fetched.data(), lits.data(), facts, externals, 2);
+            size_t i = 0;
+            for (auto it = atoms.begin(sig); it; ++it, ++i) {
+                if (i >= 1) {
+                    REQUIRE(fetched[i - 1] == it->symbol());
+                    REQUIRE(lits[i - 1] == it->literal());
+                    REQUIRE(facts[i - 1] == it->is_fact());
+                    REQUIRE(externals[i - 1] == it->is_external());
+                }
+            }
+            atoms.fetch(sig, 0, nullptr, nullptr, nullptr, nullptr, 3);
+            REQUIRE_THROWS_AS(atoms.fetch(sig, 2, fetched.data(), nullptr, nullptr, nullptr, 2), std::runtime_error);
+        }
+        SECTION("pattern") {
+            ctl.add("base", {}, "e(1,2). e(1,3). e(2,3). {e(3,1)}.");
+            ctl.ground({{"base", {}}});
+            auto atoms = ctl.symbolic_atoms();
+            auto sig = Signature("e", 2);
+            auto find = [&](std::vector<size_t> positions, SymbolVector values) {
+                SymbolVector ret;
+                for (auto &atom : atoms.find_pattern(sig, positions, values)) {
+                    ret.emplace_back(atom.symbol());
+                }
+                std::sort(ret.begin(), ret.end());
+                return ret;
+            };
+            auto e = [](int a, int b) { return Function("e", {Number(a), Number(b)}); };
+            REQUIRE(find({0}, {Number(1)}) == SymbolVector({e(1, 2), e(1, 3)}));
+            REQUIRE(find({1}, {Number(3)}) == SymbolVector({e(1, 3), e(2, 3)}));
+            REQUIRE(find({1, 0}, {Number(3), Number(2)}) == SymbolVector({e(2, 3)}));
+            REQUIRE(find({0}, {Number(4)}).empty());
+            REQUIRE(find({}, {}).size() == 4);
+            REQUIRE(atoms.find_pattern(sig, std::vector<size_t>{1}, SymbolVector{Number(1)}).front().literal() ==
+                    atoms.find(e(3, 1))->literal());
+            REQUIRE_THROWS_AS(find({2}, {Number(1)}), std::runtime_error);
+            REQUIRE_THROWS_AS(find({0, 0}, {Number(1), Number(1)}), std::runtime_error);
+
+            ctl.add("step", {}, "e(1,4).");
+            ctl.ground({{"step", {}}});
+            REQUIRE(find({0}, {Number(1)}) == SymbolVector({e(1, 2), e(1, 3), e(1, 4)}));
         }
         SECTION("incremental") {
             ctl.add("base", {}, "#external query(0).");
@@ -565,6 +661,19 @@ TEST_CASE("solving", "[clingo]") {
             REQUIRE(models == (ModelVec{{}, {Function("query", {Number(1)})}}));
             REQUIRE(messages.empty());
         }
+        SECTION("retractable facts") {
+            Control rctl{{"0", "--retractable-facts=p/1"}};
+            rctl.add("base", {}, "p(1). p(2). q(X) :- p(X).");
+            rctl.ground({{"base", {}}});
+            auto p1 = Function("p", {Number(1)});
+            auto p2 = Function("p", {Number(2)});
+            auto q2 = Function("q", {Number(2)});
+            REQUIRE(test_solve(rctl.solve(), models).is_satisfiable());
+            REQUIRE(models == (ModelVec{{p1, p2, Function("q", {Number(1)}), q2}}));
+            rctl.assign_external(p1, TruthValue::False);
+            REQUIRE(test_solve(rctl.solve(), models).is_satisfiable());
+            REQUIRE(models == (ModelVec{{p2, q2}}));
+        }
         SECTION("solve_iter") {
             static int n = 0;
             if (++n < 3) { // workaround for some bug with catch
@@ -661,6 +770,25 @@ TEST_CASE("solving", "[clingo]") {
             itB = sas.find(Clingo::Id("b"));
             REQUIRE((itA == sas.end() && itB == sas.end()));
         }
+        SECTION("cleanup incremental") {
+            ctl.add("base", {}, "{a}. :- a.");
+            ctl.add("acid", {}, "{b}. c :- a.");
+            ctl.ground({{"base", {}}});
+            auto dom = ctl.symbolic_atoms();
+            REQUIRE(test_solve(ctl.solve(), models).is_satisfiable());
+            ctl.cleanup();
+            REQUIRE(dom.find(Id("a")) == dom.end());
+            ctl.ground({{"acid", {}}});
+            REQUIRE(dom.find(Id("c")) == dom.end());
+            REQUIRE(test_solve(ctl.solve(), models).is_satisfiable());
+            REQUIRE(models.size() == 2);
+            // no further atoms are fixed, only the atoms of the last step are inspected
+            ctl.cleanup();
+            REQUIRE(dom.find(Id("a")) == dom.end());
+            REQUIRE(dom.find(Id("b")) != dom.end());
+            REQUIRE(test_solve(ctl.solve(), models).is_satisfiable());
+            REQUIRE(models.size() == 2);
+        }
         SECTION("const") {
             ctl.add("base", {}, "#const a=10.");
             REQUIRE(ctl.has_const("a"));
@@ -695,6 +823,23 @@ TEST_CASE("solving", "[clingo]") {
                                                             SymbolSpanCallback) { throw std::runtime_error("fail"); }),
                               std::runtime_error);
         }
+        SECTION("interrupt ground") {
+            ctl.add("base", {}, "a(@f()). b(X) :- a(X).");
+            ctl.add("next", {}, "c.");
+            REQUIRE_THROWS_AS(ctl.ground({{"base", {}}},
+                                         [&ctl](Location, char const *, SymbolSpan, SymbolSpanCallback report) {
+                                             std::thread thread([&ctl]() { ctl.interrupt(); });
+                                             thread.join();
+                                             report({Number(1)});
+                                         }),
+                              std::runtime_error);
+            ctl.ground({{"next", {}}});
+            // the pending interrupt also cancels the next solve call
+            REQUIRE(ctl.solve().get().is_interrupted());
+            REQUIRE(test_solve(ctl.solve(), models).is_satisfiable());
+            REQUIRE(models.size() == 1);
+            REQUIRE(std::find(models.front().begin(), models.front().end(), Id("c")) != models.front().end());
+        }
         SECTION("ground program observer") {
             std::vector<std::string> trail;
             Observer obs(trail);
@@ -705,6 +850,113 @@ TEST_CASE("solving", "[clingo]") {
             REQUIRE(models == ModelVec({}));
             REQUIRE(trail == std::vector<std::string>({"IP: incremental", "BS", "R: 1:-~1", "ES"}));
         }
+        SECTION("ground program batch observer") {
+            struct Data {
+                std::vector<std::string> trail;
+                std::vector<size_t> sizes;
+            } data;
+            clingo_ground_program_observer_t obs{};
+            obs.end_step = [](void *data) {
+                static_cast<Data *>(data)->trail.emplace_back("ES");
+                return true;
+            };
+            clingo_ground_program_batch_observer_t batch{};
+            batch.rules = [](clingo_rule_batch_t const *batch, void *data) {
+                auto &d = *static_cast<Data *>(data);
+                d.sizes.emplace_back(batch->size);
+                for (size_t i = 0; i < batch->size; ++i) {
+                    std::ostringstream oss;
+                    oss << "R: " << (batch->choices[i] ? "{" : "");
+                    for (auto j = batch->head_offsets[i]; j < batch->head_offsets[i + 1]; ++j) {
+                        oss << (j > batch->head_offsets[i] ? ";" : "") << batch->heads[j];
+                    }
+                    oss << (batch->choices[i] ? "}" : "") << ":-";
+                    for (auto j = batch->body_offsets[i]; j < batch->body_offsets[i + 1]; ++j) {
+                        oss << (j > batch->body_offsets[i] ? "," : "") << batch->bodies[j];
+                    }
+                    d.trail.emplace_back(oss.str());
+                }
+                return true;
+            };
+            Detail::handle_error(clingo_control_register_batch_observer(ctl.to_c(), &obs, &batch, 2, false, &data));
+            ctl.add("base", {}, "{a;b}. c :- a, b. d :- not c.");
+            ctl.ground({{"base", {}}});
+            ctl.solve().get();
+            REQUIRE(data.trail == std::vector<std::string>({"R: {1;2}:-", "R: 3:-1,2", "R: 4:--3", "ES"}));
+            REQUIRE(data.sizes == std::vector<size_t>({2, 1}));
+        }
+        SECTION("ground program batch observer kinds") {
+            struct Data {
+                std::vector<std::string> trail;
+            } data;
+            clingo_ground_program_observer_t obs{};
+            clingo_ground_program_batch_observer_t batch{};
+            batch.weight_rules = [](clingo_weight_rule_batch_t const *batch, void *data) {
+                auto &d = *static_cast<Data *>(data);
+                for (size_t i = 0; i < batch->size; ++i) {
+                    std::ostringstream oss;
+                    oss << "W: " << (batch->choices[i] ? "{" : "");
+                    for (auto j = batch->head_offsets[i]; j < batch->head_offsets[i + 1]; ++j) {
+                        oss << (j > batch->head_offsets[i] ? ";" : "") << batch->heads[j];
+                    }
+                    oss << (batch->choices[i] ? "}" : "") << ":-" << batch->lower_bounds[i] << "{";
+                    for (auto j = batch->body_offsets[i]; j < batch->body_offsets[i + 1]; ++j) {
+                        oss << (j > batch->body_offsets[i] ? "," : "") << batch->bodies[j].literal << "="
+                            << batch->bodies[j].weight;
+                    }
+                    oss << "}";
+                    d.trail.emplace_back(oss.str());
+                }
+                return true;
+            };
+            batch.output_atoms = [](clingo_output_atom_batch_t const *batch, void *data) {
+                auto &d = *static_cast<Data *>(data);
+                for (size_t i = 0; i < batch->size; ++i) {
+                    std::ostringstream oss;
+                    oss << "O: " << Symbol{batch->symbols[i]} << "=" << batch->atoms[i];
+                    d.trail.emplace_back(oss.str());
+                }
+                return true;
+            };
+            batch.theory_elements = [](clingo_theory_element_batch_t const *batch, void *data) {
+                auto &d = *static_cast<Data *>(data);
+                for (size_t i = 0; i < batch->size; ++i) {
+                    std::ostringstream oss;
+                    oss << "E: " << batch->element_ids[i] << ":";
+                    for (auto j = batch->term_offsets[i]; j < batch->term_offsets[i + 1]; ++j) {
+                        oss << (j > batch->term_offsets[i] ? "," : "") << batch->terms[j];
+                    }
+                    oss << ":";
+                    for (auto j = batch->condition_offsets[i]; j < batch->condition_offsets[i + 1]; ++j) {
+                        oss << (j > batch->condition_offsets[i] ? "," : "") << batch->conditions[j];
+                    }
+                    d.trail.emplace_back(oss.str());
+                }
+                return true;
+            };
+            Detail::handle_error(clingo_control_register_batch_observer(ctl.to_c(), &obs, &batch, 2, false, &data));
+            id_t num = 0;
+            id_t elem = 0;
+            ctl.with_backend([&](Backend &backend) {
+                atom_t a = backend.add_atom(Function("a", {}));
+                atom_t b = backend.add_atom(Function("b", {}));
+                backend.rule(true, {a, b}, {});
+                backend.weight_rule(false, {a}, 1, {{literal_t(b), 2}});
+                backend.weight_rule(true, {b}, 2, {{literal_t(a), 1}, {-literal_t(b), 3}});
+                num = backend.add_theory_term_number(1);
+                elem = backend.add_theory_element({num}, {literal_t(a), -literal_t(b)});
+                backend.theory_atom(0, backend.add_theory_term_string("t"), {elem});
+            });
+            ctl.solve().get();
+            auto has = [&data](std::string const &entry) {
+                return std::find(data.trail.begin(), data.trail.end(), entry) != data.trail.end();
+            };
+            REQUIRE(has("W: 1:-1{2=2}"));
+            REQUIRE(has("W: {2}:-2{1=1,-2=3}"));
+            REQUIRE(has("O: a=1"));
+            REQUIRE(has("O: b=2"));
+            REQUIRE(has("E: " + std::to_string(elem) + ":" + std::to_string(num) + ":1,-2"));
+        }
         SECTION("theory data bug") {
             struct Observer : Clingo::GroundProgramObserver {
                 Observer(std::vector<id_t> &atoms) : atoms_{atoms} {}
@@ -517,6 +517,42 @@ class TestAddClause : public Propagator {
     size_t count_ = 0;
 };
 
+class TestAddClauses : public Propagator {
+  public:
+    void init(PropagateInit &init) override {
+        auto atoms = init.symbolic_atoms();
+        auto lits = init.solver_literals(
+            {atoms.find(Id("a"))->literal(), atoms.find(Id("b"))->literal(), atoms.find(Id("c"))->literal()});
+        REQUIRE(lits.size() == 3);
+        a_ = lits[0];
+        b_ = lits[1];
+        c_ = lits[2];
+        REQUIRE(a_ == init.solver_literal(atoms.find(Id("a"))->literal()));
+        init.add_watches({a_, b_});
+    }
+    void propagate(PropagateControl &ctl, LiteralSpan changes) override {
+        ctl.add_watches({c_, -c_});
+        REQUIRE(ctl.has_watch(c_));
+        REQUIRE(ctl.has_watch(-c_));
+        ctl.remove_watches({c_, -c_});
+        REQUIRE_FALSE(ctl.has_watch(c_));
+        REQUIRE_FALSE(ctl.has_watch(-c_));
+        count_ += changes.size();
+        if (count_ == 2) {
+            std::vector<literal_t> lits{-a_, -b_, c_, -a_, -b_, -c_};
+            std::vector<size_t> offsets{0, 3, 6};
+            REQUIRE_FALSE((ctl.add_clauses(lits, offsets) && ctl.propagate()));
+        }
+    }
+    void undo(PropagateControl const &, LiteralSpan undo) noexcept override { count_ -= undo.size(); }
+
+  private:
+    literal_t a_;
+    literal_t b_;
+    literal_t c_;
+    size_t count_ = 0;
+};
+
 class TestAddWatch : public Propagator {
   public:
     void init(PropagateInit &init) override {
@@ -724,6 +760,14 @@ TEST_CASE("propagator", "[clingo][propagator]") {
             REQUIRE(models.size() == 4);
         }
     }
+    SECTION("add_clauses") {
+        TestAddClauses p;
+        ctl.register_propagator(p, false);
+        ctl.add("base", {}, "{a; b; c}.");
+        ctl.ground({{"base", {}}}, nullptr);
+        test_solve(ctl.solve(), models);
+        REQUIRE(models.size() == 6);
+    }
     SECTION("add_clause_init") {
         // NOTE: some of the tests would fail if sat preprocessing were activated
         //       because propagation has no effect in this case
@@ -31,6 +31,7 @@
 #include <gringo/base.hh>
 #include <gringo/hash_set.hh>
 #include <gringo/types.hh>
+#include <map>
 #include <stdexcept>
 
 namespace Gringo {
@@ -134,6 +135,7 @@ template <class Domain> class BindIndexEntry {
         begin_[end_++] = x;
     }
     size_t hash() const { return hash_range(data_, asUint64_()); }
+    size_t memoryUsage() const { return sizeof(uint64_t) * (asUint64_() - data_) + sizeof(SizeType) * reserved_; }
     friend bool operator==(BindIndexEntry const &x, BindIndexEntry const &y) {
         return std::equal(x.data_, x.asUint64_(), y.data_, [](uint64_t a, uint64_t b) { return a == b; });
     }
@@ -235,6 +237,9 @@ template <class Domain> class BindIndex : public IndexUpdater {
 
     size_t hash() const { return repr_->hash(); }
 
+    // Estimates the number of bytes allocated by the index.
+    size_t memoryUsage() const { return ordered_memory_usage(data_) + entryBytes_; }
+
   private:
     // Adds an atom given by its offset to the index.
     // Assumes that the atom matches and has not been added previously.
@@ -243,8 +248,11 @@ template <class Domain> class BindIndex : public IndexUpdater {
         for (auto &y : bound_) {
             boundVals_.emplace_back(*y);
         }
-        auto jt = data_.insert(boundVals_).first;
-        const_cast<Entry &>(*jt).push(offset);
+        auto ret = data_.insert(boundVals_);
+        auto &entry = const_cast<Entry &>(*ret.first);
+        size_t bytes = ret.second ? 0 : entry.memoryUsage();
+        entry.push(offset);
+        entryBytes_ += entry.memoryUsage() - bytes;
     }
 
     UTerm const repr_;
@@ -252,6 +260,7 @@ template <class Domain> class BindIndex : public IndexUpdater {
     SValVec bound_;
     SymVec boundVals_;
     Index data_;
+    size_t entryBytes_ = 0; // bytes allocated by the entries
     Id_t imported_ = 0;
     Id_t importedDelayed_ = 0;
 };
@@ -369,6 +378,9 @@ template <class Domain> class FullIndex : public IndexUpdater {
 
     size_t hash() const { return get_value_hash(repr_, initialImport_); }
 
+    // Estimates the number of bytes allocated by the index.
+    size_t memoryUsage() const { return index_.capacity() * sizeof(typename IntervalVec::value_type); }
+
   private:
     // Adds an atom offset to the index.
     // The offset is merged into the last interval if possible.
@@ -401,6 +413,189 @@ template <class Domain> struct hash<Gringo::FullIndex<Domain>> {
 
 namespace Gringo {
 
+// }}}
+// {{{ declaration of RangeIndex
+
+// A bound on the value of an argument imposed by a comparison.
+// The relation is oriented such that the argument is on its left-hand side.
+struct RangeBound {
+    Relation rel;
+    UTerm term;
+};
+using RangeBoundVec = std::vector<RangeBound>;
+
+// An index for a positive literal occurrence with all variables unbound
+// where the argument at a given position is bounded by comparisons.
+// The offsets are sorted by the value of the argument so that a lookup
+// only has to visit atoms within the bounds.
+template <class Domain> class RangeIndex : public IndexUpdater {
+  public:
+    using SizeType = typename Domain::SizeType;
+    using Entry = std::pair<Symbol, SizeType>;
+    using EntryVec = std::vector<Entry>;
+    using Iterator = typename EntryVec::const_iterator;
+
+    struct OffsetRange {
+        bool next(SizeType &offset, Term const &repr, RangeIndex &idx) {
+            // The entries are not ordered by generation.
+            // Hence, atoms of the wrong generation have to be skipped.
+            while (current != end) {
+                offset = current++->second;
+                auto &atom = idx.domain_[offset];
+                if ((type == BinderType::NEW && atom.generation() < idx.domain_.generation()) ||
+                    (type == BinderType::OLD && atom.generation() >= idx.domain_.generation())) {
+                    continue;
+                }
+                repr.match(atom);
+                return true;
+            }
+            return false;
+        }
+        BinderType type;
+        Iterator current;
+        Iterator end;
+    };
+
+    RangeIndex(Domain &domain, UTerm &&repr, unsigned position)
+        : repr_(std::move(repr)), domain_(domain), position_(position) {}
+
+    RangeIndex(RangeIndex const &other) = default;
+    RangeIndex(RangeIndex &&other) noexcept = default;
+    RangeIndex &operator=(RangeIndex const &other) = default;
+    RangeIndex &operator=(RangeIndex &&other) noexcept = default;
+    ~RangeIndex() noexcept override = default;
+
+    // Returns a range of offsets corresponding to atoms whose argument satisfies the given bounds.
+    OffsetRange lookup(RangeBoundVec const &bounds, BinderType type, Logger &log) {
+        auto cmpLower = [](Entry const &a, Symbol const &b) { return a.first < b; };
+        auto cmpUpper = [](Symbol const &a, Entry const &b) { return a < b.first; };
+        Iterator lower = entries_.begin();
+        Iterator upper = entries_.end();
+        for (auto const &bound : bounds) {
+            bool undefined = false;
+            Symbol val = bound.term->eval(undefined, log);
+            if (undefined) {
+                return {type, upper, upper};
+            }
+            switch (bound.rel) {
+                case Relation::LT: {
+                    upper = std::lower_bound(lower, upper, val, cmpLower);
+                    break;
+                }
+                case Relation::LEQ: {
+                    upper = std::upper_bound(lower, upper, val, cmpUpper);
+                    break;
+                }
+                case Relation::GT: {
+                    lower = std::upper_bound(lower, upper, val, cmpUpper);
+                    break;
+                }
+                case Relation::GEQ: {
+                    lower = std::lower_bound(lower, upper, val, cmpLower);
+                    break;
+                }
+                case Relation::EQ:
+                case Relation::NEQ: {
+                    break;
+                }
+            }
+        }
+        return {type, lower, upper};
+    }
+
+    bool update() override {
+        auto size = entries_.size();
+        bool ret = domain_.update(
+            [this](SizeType offset) {
+                entries_.emplace_back(static_cast<Symbol>(domain_[offset]).args()[position_], offset);
+            },
+            *repr_, imported_, importedDelayed_);
+        // Sort the fresh entries and merge them with the existing ones.
+        auto mid = entries_.begin() + static_cast<std::ptrdiff_t>(size);
+        std::sort(mid, entries_.end());
+        std::inplace_merge(entries_.begin(), mid, entries_.end());
+        return ret;
+    }
+
+    bool operator==(RangeIndex const &x) const { return *repr_ == *x.repr_ && position_ == x.position_; }
+
+    size_t hash() const { return get_value_hash(repr_, position_); }
+
+    // Estimates the number of bytes allocated by the index.
+    size_t memoryUsage() const { return entries_.capacity() * sizeof(Entry); }
+
+  private:
+    UTerm repr_;
+    Domain &domain_;
+    EntryVec entries_;
+    unsigned position_;
+    SizeType imported_ = 0;
+    SizeType importedDelayed_ = 0;
+};
+
+} // namespace Gringo
+
+namespace std {
+
+template <class Domain> struct hash<Gringo::RangeIndex<Domain>> {
+    size_t operator()(Gringo::RangeIndex<Domain> const &entry) const { return entry.hash(); }
+};
+
+} // namespace std
+
+namespace Gringo {
+
+// }}}
+// {{{ declaration of PatternIndex
+
+// An index for queries from outside of the grounder mapping the values of
+// the arguments at some positions to the offsets of the matching atoms.
+// In contrast to the indices above, it does not take generations into
+// account and is only updated when queried.
+class PatternIndex {
+  public:
+    using SizeType = uint32_t;
+    using OffsetVec = std::vector<SizeType>;
+    using Positions = std::vector<unsigned>;
+
+    explicit PatternIndex(Positions positions) : positions_(std::move(positions)) {}
+
+    // Returns the offsets of the atoms whose arguments at the positions of
+    // the index have the given values.
+    template <class Domain> OffsetVec const &lookup(Domain &domain, SymVec const &values) {
+        update_(domain);
+        auto it = data_.find(values);
+        return it != data_.end() ? it->second : empty_;
+    }
+
+    // Estimates the number of bytes allocated by the index.
+    size_t memoryUsage() const {
+        size_t ret = hash_memory_usage(data_);
+        for (auto const &x : data_) {
+            ret += x.first.capacity() * sizeof(Symbol) + x.second.capacity() * sizeof(SizeType);
+        }
+        return ret;
+    }
+
+  private:
+    template <class Domain> void update_(Domain &domain) {
+        for (; imported_ < domain.size(); ++imported_) {
+            auto args = static_cast<Symbol>(domain[imported_]).args();
+            key_.clear();
+            for (auto pos : positions_) {
+                key_.emplace_back(args[pos]);
+            }
+            data_[key_].emplace_back(imported_);
+        }
+    }
+
+    Positions positions_;
+    hash_map<SymVec, OffsetVec, mix_value_hash<SymVec>> data_;
+    OffsetVec empty_;
+    SymVec key_;
+    SizeType imported_ = 0;
+};
+
 // }}}
 // {{{ declaration of Domain
 
@@ -422,6 +617,8 @@ class Domain {
     virtual void nextGeneration() = 0;
     virtual void setDomainOffset(Id_t offset) = 0;
     virtual Id_t domainOffset() const = 0;
+    // Estimates the number of bytes allocated by the domain and its indices.
+    virtual size_t memoryUsage() const = 0;
 };
 using UDom = std::unique_ptr<Domain>;
 using UDomVec = std::vector<UDom>;
@@ -438,6 +635,9 @@ template <class T> class AbstractDomain : public Domain {
     using FullIndex = Gringo::FullIndex<AbstractDomain>;
     using BindIndices = std::unordered_set<BindIndex, mix_value_hash<BindIndex>>;
     using FullIndices = std::unordered_set<FullIndex, mix_value_hash<FullIndex>>;
+    using RangeIndex = Gringo::RangeIndex<AbstractDomain>;
+    using RangeIndices = std::unordered_set<RangeIndex, mix_value_hash<RangeIndex>>;
+    using PatternIndices = std::map<PatternIndex::Positions, PatternIndex>;
     using AtomVec = typename Atoms::values_container_type;
     using Iterator = typename AtomVec::iterator;
     using ConstIterator = typename AtomVec::const_iterator;
@@ -468,6 +668,14 @@ template <class T> class AbstractDomain : public Domain {
         return idx;
     }
 
+    RangeIndex &addRange(UTerm &&repr, unsigned position) {
+        auto ret(rangeIndices_.emplace(*this, std::move(repr), position));
+        // NOLINTNEXTLINE
+        auto &idx = const_cast<RangeIndex &>(*ret.first);
+        idx.update();
+        return idx;
+    }
+
     // Function to lookup negative literals or non-recursive atoms.
     bool lookup(SizeType &offset, Term const &repr, RECNAF naf, Logger &log) {
         bool undefined = false;
@@ -597,11 +805,26 @@ template <class T> class AbstractDomain : public Domain {
         atoms_.clear();
         indices_.clear();
         fullIndices_.clear();
+        rangeIndices_.clear();
+        patternIndices_.clear();
         generation_ = 0;
     }
     void reset() {
         indices_.clear();
         fullIndices_.clear();
+        rangeIndices_.clear();
+        patternIndices_.clear();
+    }
+
+    // Returns the offsets of the atoms whose arguments at the given sorted
+    // positions have the given values.
+    // An index is created for each set of positions on first use.
+    OffsetVec const &lookup(PatternIndex::Positions const &positions, SymVec const &values) {
+        auto it = patternIndices_.find(positions);
+        if (it == patternIndices_.end()) {
+            it = patternIndices_.emplace(positions, PatternIndex{positions}).first;
+        }
+        return it->second.lookup(*this, values);
     }
 
     std::vector<Atom> &container() { return const_cast<AtomVec &>(atoms_.values_container()); }
@@ -665,6 +888,23 @@ template <class T> class AbstractDomain : public Domain {
     }
     bool isEnqueued() const override { return enqueued_ > 0; }
     void nextGeneration() override { ++generation_; }
+    // Note: memory owned by the atoms themselves is not taken into account.
+    size_t memoryUsage() const override {
+        size_t ret = ordered_memory_usage(atoms_) + delayed_.capacity() * sizeof(SizeType);
+        for (auto const &idx : indices_) {
+            ret += idx.memoryUsage();
+        }
+        for (auto const &idx : fullIndices_) {
+            ret += idx.memoryUsage();
+        }
+        for (auto const &idx : rangeIndices_) {
+            ret += idx.memoryUsage();
+        }
+        for (auto const &idx : patternIndices_) {
+            ret += idx.second.memoryUsage();
+        }
+        return ret;
+    }
     OffsetVec &delayed() { return delayed_; }
     Iterator find(Symbol x) { return convert_(atoms_.find(x)); }
     ConstIterator find(Symbol x) const { return atoms_.find(x); }
@@ -681,15 +921,18 @@ template <class T> class AbstractDomain : public Domain {
     // Assumes that cleanup sets the generation back to 1 and removes delayed
     // atoms. The given function is simply passed as argument to the erase
     // function of the vector holding the domain elements.
-    template <class F> void cleanup_(F f) {
-        reset();
-        Id_t offset = 0;
+    // Atoms before the start offset are assumed to be unchanged and are not
+    // passed to the function.
+    template <class F> void cleanup_(F f, Id_t start = 0) {
+        bool erased = false;
+        Id_t offset = start;
         Id_t revOffset = atoms_.size();
-        Id_t oldOffset = 0;
-        for (auto it = atoms_.begin(); it != atoms_.end();) {
+        Id_t oldOffset = start;
+        for (auto it = atoms_.begin() + start; it != atoms_.end();) {
             assert(it - atoms_.begin() == offset);
             if (f(const_cast<Atom &>(*it), oldOffset, offset)) {
                 it = atoms_.unordered_erase(it);
+                erased = true;
                 --revOffset;
                 oldOffset = revOffset;
             } else {
@@ -698,6 +941,11 @@ template <class T> class AbstractDomain : public Domain {
                 oldOffset = offset;
             }
         }
+        // The indices only have to be rebuilt if atoms have been moved or
+        // delayed atoms have been imported.
+        if (erased || !delayed_.empty()) {
+            reset();
+        }
         delayed_.clear();
         generation_ = 1;
         initOffset_ = atoms_.size();
@@ -710,6 +958,8 @@ template <class T> class AbstractDomain : public Domain {
 
     BindIndices indices_;
     FullIndices fullIndices_;
+    RangeIndices rangeIndices_;
+    PatternIndices patternIndices_;
     Atoms atoms_;
     OffsetVec delayed_;
     Id_t enqueued_ = 0;
@@ -134,6 +134,60 @@ template <class Atom> struct PosMatcher : Binder, IndexUpdater {
     bool firstMatch = false;
 };
 
+// }}}
+// {{{ definition of make_range_binder
+
+// Creates a binder for a positive literal whose variables are all unbound
+// and where one argument is a variable restricted by the given bounds.
+// The bounds used by the binder are moved out of the vector.
+// Returns a null pointer if no such binder can be created.
+template <class Atom>
+inline UIdx make_range_binder(AbstractDomain<Atom> &domain, Term const &repr,
+                              typename AbstractDomain<Atom>::SizeType &elem, BinderType type, Term::VarSet &bound,
+                              VarBoundVec &bounds) {
+    using DomainType = AbstractDomain<Atom>;
+    using RangePredicateBinder = PosBinder<typename DomainType::RangeIndex &, RangeBoundVec>;
+    UTerm predClone(repr.clone());
+    auto *fun = dynamic_cast<FunctionTerm *>(predClone.get());
+    if (fun == nullptr) {
+        return nullptr;
+    }
+    VarTermBoundVec occs;
+    predClone->collect(occs, false);
+    for (auto &x : occs) {
+        if (bound.find(x.first->name) != bound.end()) {
+            return nullptr;
+        }
+    }
+    RangeBoundVec rangeBounds;
+    unsigned position = 0;
+    for (auto const &arg : fun->arguments()) {
+        if (auto const *var = dynamic_cast<VarTerm const *>(arg.get())) {
+            for (auto &x : bounds) {
+                if (x.first == var->name && x.second.term != nullptr) {
+                    rangeBounds.emplace_back(RangeBound{x.second.rel, std::move(x.second.term)});
+                }
+            }
+            if (!rangeBounds.empty()) {
+                break;
+            }
+        }
+        ++position;
+    }
+    if (rangeBounds.empty()) {
+        return nullptr;
+    }
+    for (auto &x : occs) {
+        x.first->bindRef = bound.emplace(x.first->name).second;
+    }
+    Term::RenameMap rename;
+    UTerm idxClone(predClone->renameVars(rename));
+    Term::VarSet empty;
+    idxClone->bind(empty);
+    auto &idx(domain.addRange(std::move(idxClone), position));
+    return gringo_make_unique<RangePredicateBinder>(std::move(predClone), elem, idx, type, std::move(rangeBounds));
+}
+
 // }}}
 // {{{ definition of make_binder
 
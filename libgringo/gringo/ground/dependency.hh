@@ -28,17 +28,52 @@
 #include <gringo/graph.hh>
 #include <gringo/hash_set.hh>
 #include <gringo/term.hh>
+#include <functional>
 #include <gringo/utility.hh>
 #include <iterator>
 
 namespace Gringo {
 namespace Ground {
 
+// {{{ declaration of TermIndex
+
+//! Index of terms by signature and by the values of their ground arguments.
+//!
+//! For each argument position, terms with a ground argument are bucketed by
+//! its value while the remaining terms are kept in a separate list. A query
+//! only visits the terms of the position with the fewest candidates among
+//! the positions where the queried term is ground. This prunes terms that
+//! cannot unify because of a differing constant argument.
+class TermIndex {
+  public:
+    void add(GTerm &term);
+    //! Calls the callback for all terms with the given signature that might
+    //! unify with a term whose ground arguments are given by the arg
+    //! function.
+    //!
+    //! The terms are visited in reverse insertion order.
+    template <class Arg, class Callback> void find(Sig sig, Arg const &arg, Callback const &c) const;
+
+  private:
+    using TermVec = std::vector<std::pair<size_t, GTerm *>>;
+    struct ArgIndex {
+        hash_map<Symbol, TermVec> bound;
+        TermVec unbound;
+    };
+    struct SigIndex {
+        TermVec all;
+        std::vector<ArgIndex> args;
+    };
+
+    std::unordered_map<Sig, SigIndex> index_;
+    size_t size_ = 0;
+};
+
+// }}}
 // {{{ declaration of Lookup
 
 template <class Occ> class Lookup {
   public:
-    using SigLookup = std::unordered_multimap<Sig, GTerm *>;
     using Occurrences = std::unordered_multimap<GTerm *, Occ, value_hash<GTerm *>, value_equal_to<GTerm *>>;
     using iterator = typename Occurrences::iterator;
     using const_iterator = typename Occurrences::const_iterator;
@@ -54,10 +89,10 @@ template <class Occ> class Lookup {
     const_iterator end() const { return occs.end(); }
 
   private:
-    template <class Callback> void unify(GTerm &x, SigLookup &y, Callback const &c);
+    template <class Callback> void unify(GTerm &x, TermIndex &y, Callback const &c);
 
-    SigLookup terms;
-    SigLookup constTerms;
+    TermIndex terms;
+    TermIndex constTerms;
     Occurrences occs;
 };
 
@@ -110,12 +145,26 @@ template <class Stm, class HeadOcc> struct Dependency {
         typename G::Node *graphNode = nullptr;
         unsigned negSCC = 0;
         unsigned posSCC = 0;
+        bool relevant = true;
     };
+    using Demand = std::function<bool(Node const &)>;
 
     Node &add(Stm stm, bool normal);
     void depends(Node &n, BodyOccurrence<HeadOcc> &occ, bool forceNegative = false);
     void provides(Node &n, HeadOcc &occ, UGTerm term);
-    std::tuple<ComponentVec, UGTermVec, UGTermVec> analyze();
+    //! Computes the components of the program in topological order.
+    //!
+    //! If a demand callback is given, only nodes it selects and nodes they
+    //! depend on are kept. Nodes in components that are not stratified and
+    //! normal are always kept. Dropping the remaining nodes does not change
+    //! the answer sets restricted to the kept nodes because the dropped part
+    //! has exactly one answer set on top of them.
+    std::tuple<ComponentVec, UGTermVec, UGTermVec> analyze(Demand const &demand = nullptr);
+
+  private:
+    void slice_(typename G::SCCVec const &sccs, Demand const &demand);
+
+  public:
 
     UGTermVec terms;
     Lookup depend;
@@ -124,15 +173,65 @@ template <class Stm, class HeadOcc> struct Dependency {
 
 // }}}
 
+// {{{ definition of TermIndex
+
+inline void TermIndex::add(GTerm &term) {
+    auto sig = term.sig();
+    auto &idx = index_[sig];
+    idx.all.emplace_back(size_, &term);
+    idx.args.resize(sig.arity());
+    for (unsigned i = 0; i < sig.arity(); ++i) {
+        auto val = term.evalArg(i);
+        if (val.first) {
+            idx.args[i].bound[val.second].emplace_back(size_, &term);
+        } else {
+            idx.args[i].unbound.emplace_back(size_, &term);
+        }
+    }
+    ++size_;
+}
+
+template <class Arg, class Callback> void TermIndex::find(Sig sig, Arg const &arg, Callback const &c) const {
+    static TermVec const empty;
+    auto it = index_.find(sig);
+    if (it == index_.end()) {
+        return;
+    }
+    auto const &idx = it->second;
+    TermVec const *a = &idx.all;
+    TermVec const *b = &empty;
+    for (unsigned i = 0; i < idx.args.size() && !a->empty(); ++i) {
+        auto val = arg(i);
+        if (val.first) {
+            auto const &argIdx = idx.args[i];
+            auto jt = argIdx.bound.find(val.second);
+            auto const *bound = jt != argIdx.bound.end() ? &jt->second : &empty;
+            if (bound->size() + argIdx.unbound.size() < a->size() + b->size()) {
+                a = bound;
+                b = &argIdx.unbound;
+            }
+        }
+    }
+    // merge the two candidate lists visiting terms in reverse insertion order
+    for (auto ia = a->rbegin(), ea = a->rend(), ib = b->rbegin(), eb = b->rend(); ia != ea || ib != eb;) {
+        if (ib == eb || (ia != ea && ia->first > ib->first)) {
+            c(*ia++->second);
+        } else {
+            c(*ib++->second);
+        }
+    }
+}
+
+// }}}
 // {{{ definition of Lookup
 
 template <class Occ> bool Lookup<Occ>::add(GTerm &term, Occ occ) {
     auto it = occs.find(&term);
     if (it == occs.end()) {
         if (term.eval().first) {
-            constTerms.emplace(term.sig(), &term);
+            constTerms.add(term);
         } else {
-            terms.emplace(term.sig(), &term);
+            terms.add(term);
         }
         occs.emplace(&term, std::forward<Occ>(occ));
         return true;
@@ -143,15 +242,16 @@ template <class Occ> bool Lookup<Occ>::add(GTerm &term, Occ occ) {
 
 template <class Occ> template <class Callback> void Lookup<Occ>::match(Symbol x, Callback const &c) {
     if (x.type() == SymbolType::Fun) {
-        auto ir(terms.equal_range(x.sig()));
-        for (auto it = ir.first; it != ir.second; ++it) {
-            if (it->second->match(x)) {
-                auto rng(occs.equal_range(it->second));
+        auto args = x.args();
+        auto arg = [&args](unsigned i) { return GTerm::EvalResult{true, args[i]}; };
+        terms.find(x.sig(), arg, [&](GTerm &term) {
+            if (term.match(x)) {
+                auto rng(occs.equal_range(&term));
                 assert(rng.first != rng.second);
                 c(rng.first, rng.second);
             }
-            it->second->reset();
-        }
+            term.reset();
+        });
         GValTerm y(x);
         auto rng(occs.equal_range(&y));
         if (rng.first != rng.second) {
@@ -160,17 +260,17 @@ template <class Occ> template <class Callback> void Lookup<Occ>::match(Symbol x,
     }
 }
 
-template <class Occ> template <class Callback> void Lookup<Occ>::unify(GTerm &x, SigLookup &y, Callback const &c) {
-    auto ir(y.equal_range(x.sig()));
-    for (auto it = ir.first; it != ir.second; ++it) {
-        if (it->second->unify(x)) {
-            auto rng(occs.equal_range(it->second));
+template <class Occ> template <class Callback> void Lookup<Occ>::unify(GTerm &x, TermIndex &y, Callback const &c) {
+    auto arg = [&x](unsigned i) { return x.evalArg(i); };
+    y.find(x.sig(), arg, [&](GTerm &term) {
+        if (term.unify(x)) {
+            auto rng(occs.equal_range(&term));
             assert(rng.first != rng.second);
             c(rng.first, rng.second);
         }
-        it->second->reset();
+        term.reset();
         x.reset();
-    }
+    });
 }
 
 template <class Occ> template <class Callback> void Lookup<Occ>::unify(GTerm &x, Callback const &c) {
@@ -208,7 +308,51 @@ template <class Stm, class HeadOcc> void Dependency<Stm, HeadOcc>::provides(Node
 }
 
 template <class Stm, class HeadOcc>
-std::tuple<typename Dependency<Stm, HeadOcc>::ComponentVec, UGTermVec, UGTermVec> Dependency<Stm, HeadOcc>::analyze() {
+void Dependency<Stm, HeadOcc>::slice_(typename G::SCCVec const &sccs, Demand const &demand) {
+    std::vector<Node *> stack;
+    unsigned idx = 0;
+    for (auto const &scc : sccs) {
+        ++idx;
+        bool stratified = true;
+        for (auto const &graphNode : scc) {
+            graphNode->data->negSCC = idx;
+        }
+        for (auto const &graphNode : scc) {
+            auto &node = *graphNode->data;
+            stratified = stratified && node.normal;
+            for (auto const &x : node.depend) {
+                for (auto const &y : std::get<1>(x)) {
+                    if (y->negSCC == idx && (!std::get<0>(x)->isPositive() || std::get<2>(x))) {
+                        stratified = false;
+                    }
+                }
+            }
+        }
+        for (auto const &graphNode : scc) {
+            auto &node = *graphNode->data;
+            node.relevant = !stratified || demand(node);
+            if (node.relevant) {
+                stack.emplace_back(&node);
+            }
+        }
+    }
+    while (!stack.empty()) {
+        auto &node = *stack.back();
+        stack.pop_back();
+        for (auto const &x : node.depend) {
+            for (auto const &y : std::get<1>(x)) {
+                if (!y->relevant) {
+                    y->relevant = true;
+                    stack.emplace_back(y);
+                }
+            }
+        }
+    }
+}
+
+template <class Stm, class HeadOcc>
+std::tuple<typename Dependency<Stm, HeadOcc>::ComponentVec, UGTermVec, UGTermVec>
+Dependency<Stm, HeadOcc>::analyze(Demand const &demand) {
     // initialize nodes
     for (auto &node : nodes) {
         for (auto &x : node->provide) {
@@ -239,7 +383,14 @@ std::tuple<typename Dependency<Stm, HeadOcc>::ComponentVec, UGTermVec, UGTermVec
     ordered_set<UGTerm, mix_value_hash<UGTerm>, value_equal_to<UGTerm>> phead;
     ordered_set<UGTerm, mix_value_hash<UGTerm>, value_equal_to<UGTerm>> nhead;
     positive.push_back(true);
-    for (auto &scc : g.tarjan()) {
+    auto sccs = g.tarjan();
+    if (demand) {
+        slice_(sccs, demand);
+    }
+    for (auto &scc : sccs) {
+        if (!scc.front()->data->relevant) {
+            continue;
+        }
         // dependency analysis
         auto negSCC = numeric_cast<unsigned>(positive.size());
         for (auto &graphNode : scc) {
@@ -27,6 +27,8 @@
 
 #include <gringo/output/output.hh>
 
+#include <atomic>
+
 namespace Gringo {
 namespace Ground {
 
@@ -34,6 +36,13 @@ namespace Ground {
 
 struct Instantiator;
 struct Queue {
+    // Processes the queue until a fixpoint is reached.
+    // If the interrupted flag is set, a runtime_error is thrown after the
+    // queue and the enqueued domains have been reset.
+    //
+    // Rounds are processed by the calling thread only: binders bind the
+    // variables of their rule in place and reported solutions modify the
+    // domains and the output directly.
     void process(Output::OutputBase &out, Logger &log);
     void enqueue(Instantiator &inst);
     void enqueue(Domain &dom);
@@ -43,6 +52,10 @@ struct Queue {
     QueueVec current;
     std::array<QueueVec, 2> queues;
     DomainVec domains;
+    std::atomic<bool> const *interrupted = nullptr;
+
+  private:
+    void abort_();
 };
 
 // }}}
@@ -113,7 +126,7 @@ struct Instantiator {
     void add(UIdx &&index, DependVec &&depends);
     void finalize(DependVec &&depends);
     void enqueue(Queue &queue);
-    void instantiate(Output::OutputBase &out, Logger &log);
+    void instantiate(Output::OutputBase &out, Logger &log, std::atomic<bool> const *interrupted = nullptr);
     void print(std::ostream &out) const;
     unsigned priority() const;
 
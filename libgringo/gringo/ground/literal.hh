@@ -58,6 +58,7 @@ using BodyOcc = BodyOccurrence<HeadOccurrence>;
 class Literal;
 using ULit = std::unique_ptr<Literal>;
 using ULitVec = std::vector<ULit>;
+using VarBoundVec = std::vector<std::pair<String, RangeBound>>;
 
 class Literal : public Printable {
   public:
@@ -65,6 +66,10 @@ class Literal : public Printable {
     virtual bool auxiliary() const = 0;
     virtual bool isRecursive() const = 0;
     virtual UIdx index(Context &context, BinderType type, Term::VarSet &bound) = 0;
+    // Creates an index that can use the given bounds on unbound variables to restrict matches.
+    virtual UIdx index(Context &context, BinderType type, Term::VarSet &bound, VarBoundVec &bounds);
+    // Adds bounds on unbound variables that can be evaluated given the bound variables.
+    virtual void collectBounds(Term::VarSet const &bound, VarBoundVec &bounds) const;
     virtual BodyOcc *occurrence() = 0;
     virtual void collect(VarTermBoundVec &vars) const = 0;
     virtual void collectImportant(Term::VarSet &vars);
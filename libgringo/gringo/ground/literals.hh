@@ -65,6 +65,27 @@ class RangeLiteral : public Literal {
     RangeLiteralShared range_;
 };
 
+// }}}
+// {{{ declaration of PoolLiteral
+
+class PoolLiteral : public Literal {
+  public:
+    PoolLiteral(UTerm assign, SymVec values);
+    void print(std::ostream &out) const override;
+    bool isRecursive() const override;
+    BodyOcc *occurrence() override;
+    void collect(VarTermBoundVec &vars) const override;
+    UIdx index(Context &context, BinderType type, Term::VarSet &bound) override;
+    std::pair<Output::LiteralId, bool> toOutput(Logger &log) override;
+    Score score(Term::VarSet const &bound, Logger &log) override;
+    bool auxiliary() const override { return true; }
+
+  private:
+    UTerm assign_;
+    SymVec values_;
+    SymVec sorted_;
+};
+
 // }}}
 // {{{ declaration of ScriptLiteral
 
@@ -98,6 +119,8 @@ class RelationLiteral : public Literal {
     BodyOcc *occurrence() override;
     void collect(VarTermBoundVec &vars) const override;
     UIdx index(Context &context, BinderType type, Term::VarSet &bound) override;
+    using Literal::index;
+    void collectBounds(Term::VarSet const &bound, VarBoundVec &bounds) const override;
     std::pair<Output::LiteralId, bool> toOutput(Logger &log) override;
     Score score(Term::VarSet const &bound, Logger &log) override;
     bool auxiliary() const override { return true; }
@@ -123,6 +146,7 @@ class PredicateLiteral : public Literal, public BodyOcc {
     void collect(VarTermBoundVec &vars) const override;
     DefinedBy &definedBy() override;
     UIdx index(Context &context, BinderType type, Term::VarSet &bound) override;
+    UIdx index(Context &context, BinderType type, Term::VarSet &bound, VarBoundVec &bounds) override;
     std::pair<Output::LiteralId, bool> toOutput(Logger &log) override;
     Score score(Term::VarSet const &bound, Logger &log) override;
     void checkDefined(LocSet &done, SigSet const &edb, UndefVec &undef) const override;
@@ -148,6 +172,7 @@ class ProjectionLiteral : public PredicateLiteral {
   public:
     ProjectionLiteral(bool auxiliary, PredicateDomain &dom, UTerm repr, bool initialized);
     UIdx index(Context &context, BinderType type, Term::VarSet &bound) override;
+    UIdx index(Context &context, BinderType type, Term::VarSet &bound, VarBoundVec &bounds) override;
 
   private:
     bool initialized_;
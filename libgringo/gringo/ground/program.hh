@@ -60,7 +60,9 @@ class Program {
     //! Prepare the ground program before grounding.
     void prepare(Parameters const &params, Output::OutputBase &out, Logger &log);
     //! Ground a prepared program.
-    void ground(Context &context, Output::OutputBase &out, Logger &log);
+    //! Grounding stops with a runtime_error as soon as the interrupted flag is set.
+    void ground(Context &context, Output::OutputBase &out, Logger &log,
+                std::atomic<bool> const *interrupted = nullptr);
     const_iterator begin() const { return stms_.begin(); }
     const_iterator end() const { return stms_.end(); }
 
@@ -81,6 +81,16 @@ using hash_map = tsl::sparse_map<Key, Value, Hash, KeyEqual, Allocator>;
 
 #endif
 
+// Estimates the number of bytes allocated by an ordered set or map.
+template <class T> size_t ordered_memory_usage(T const &x) {
+    return x.values_container().capacity() * sizeof(typename T::value_type) + x.bucket_count() * sizeof(uint64_t);
+}
+
+// Estimates the number of bytes allocated by a hash set or map.
+template <class T> size_t hash_memory_usage(T const &x) {
+    return x.bucket_count() * (sizeof(typename T::value_type) + sizeof(uint64_t));
+}
+
 struct CallHash {
     template <typename T> size_t operator()(T const &x) const { return x.hash(); }
 };
@@ -169,6 +179,14 @@ template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std:
     }
     void clear() { impl_.clear(); }
     bool empty() const { return impl_.empty(); }
+    // Estimates the number of bytes allocated by the set.
+    size_t memoryUsage() const {
+        size_t ret = 0;
+        for (auto const &x : impl_) {
+            ret += x.second.values.capacity() * sizeof(Key) + hash_memory_usage(x.second.data);
+        }
+        return ret;
+    }
 
   private:
     struct Impl : private Hash, private KeyEqual {
@@ -177,6 +177,9 @@ class BodyAggregate : public Printable,
     virtual unsigned projectScore() const { return 2; }
     //! Check if the aggregate needs unpooling.
     virtual bool hasPool() const = 0;
+    //! Replace pools of values by fresh variables bound by the given literals.
+    //! \see Literal::extractPools
+    virtual void extractPools(ULitVec &pools, AuxGen &auxGen);
     //! Unpool the aggregate and aggregate elements.
     virtual void unpool(UBodyAggrVec &x) = 0;
     //! Check if the aggregate needs unpooling.
@@ -235,6 +238,9 @@ class HeadAggregate : public Printable,
     virtual bool isPredicate() const { return false; }
     //! Check if the aggregate needs unpooling.
     virtual bool hasPool() const = 0;
+    //! Replace pools of values by fresh variables bound by the given body literals.
+    //! \see Literal::extractPools
+    virtual void extractPools(ULitVec &pools, AuxGen &auxGen);
     //! Unpool the aggregate and aggregate elements.
     virtual void unpool(UHeadAggrVec &x) = 0;
     //! Unpool comparisons within the aggregate.
@@ -223,6 +223,7 @@ class SimpleBodyLiteral : public BodyAggregate {
     size_t hash() const override;
     SimpleBodyLiteral *clone() const override;
     bool hasPool() const override;
+    void extractPools(ULitVec &pools, AuxGen &auxGen) override;
     void unpool(UBodyAggrVec &x) override;
     bool hasUnpoolComparison() const override;
     UBodyAggrVecVec unpoolComparison() const override;
@@ -425,6 +426,7 @@ class SimpleHeadLiteral : public HeadAggregate {
     size_t hash() const override;
     SimpleHeadLiteral *clone() const override;
     bool hasPool() const override;
+    void extractPools(ULitVec &pools, AuxGen &auxGen) override;
     void unpool(UHeadAggrVec &x) override;
     UHeadAggr unpoolComparison(UBodyAggrVec &body) override;
     bool simplify(Projections &project, SimplifyState &state, Logger &log) override;
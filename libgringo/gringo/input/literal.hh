@@ -95,6 +95,11 @@ class Literal : public Printable,
     virtual ULitVec unpool(bool head) const = 0;
     //! Check if the literal has occurrences of pool terms.
     virtual bool hasPool(bool head) const = 0;
+    //! Replaces pools of values that can be kept in a single rule by fresh variables.
+    //!
+    //! Literals binding the variables to the values of the pools are added to
+    //! the given vector. Pools with variables are left for unpooling.
+    virtual void extractPools(ULitVec &pools, AuxGen &auxGen);
     //! Unpool a comparision.
     //!
     //! Comparisons with more than one relation have to be unpooled after the
@@ -55,6 +55,7 @@ class PredicateLiteral : public Literal {
     ULitVec unpool(bool head) const override;
     Symbol isEDB() const override;
     bool hasPool(bool head) const override;
+    void extractPools(ULitVec &pools, AuxGen &auxGen) override;
     void replace(Defines &dx) override;
     Ground::ULit toGround(DomainData &x, bool auxiliary) const override;
     ULit shift(bool negate) override;
@@ -122,6 +123,7 @@ class RelationLiteral : public Literal {
     ULitVecVec unpoolComparison() const override;
     bool hasUnpoolComparison() const override;
     bool hasPool(bool head) const override;
+    void extractPools(ULitVec &pools, AuxGen &auxGen) override;
     void replace(Defines &dx) override;
     Ground::ULit toGround(DomainData &x, bool auxiliary) const override;
     UTerm headRepr() const override;
@@ -176,6 +178,46 @@ class RangeLiteral : public Literal {
     UTerm upper_;
 };
 
+// }}}
+// {{{ declaration of PoolLiteral
+
+//! Literal binding a term to the values of a pool.
+//!
+//! Pools of values in literals are replaced by variables bound by this literal
+//! instead of unpooling the whole rule.
+class PoolLiteral : public Literal {
+  public:
+    PoolLiteral(UTerm &&assign, SymVec &&values);
+    PoolLiteral(PoolLiteral const &other) = delete;
+    PoolLiteral(PoolLiteral &&other) noexcept = default;
+    PoolLiteral &operator=(PoolLiteral const &other) = delete;
+    PoolLiteral &operator=(PoolLiteral &&other) noexcept = delete;
+    ~PoolLiteral() noexcept override = default;
+
+    unsigned projectScore() const override { return 0; }
+    void collect(VarTermBoundVec &vars, bool bound) const override;
+    void toTuple(UTermVec &tuple, int &id) const override;
+    PoolLiteral *clone() const override;
+    void print(std::ostream &out) const override;
+    bool operator==(Literal const &other) const override;
+    size_t hash() const override;
+    bool simplify(Logger &log, Projections &project, SimplifyState &state, bool positional = true,
+                  bool singleton = false) override;
+    void rewriteArithmetics(Term::ArithmeticsMap &arith, RelationVec &assign, AuxGen &auxGen) override;
+    ULitVec unpool(bool head) const override;
+    bool hasPool(bool head) const override;
+    void replace(Defines &dx) override;
+    Ground::ULit toGround(DomainData &x, bool auxiliary) const override;
+    ULit shift(bool negate) override;
+    UTerm headRepr() const override;
+    bool auxiliary() const override;
+    void auxiliary(bool aux) override;
+
+  private:
+    UTerm assign_;
+    SymVec values_;
+};
+
 // }}}
 // {{{ declaration of ScriptLiteral
 
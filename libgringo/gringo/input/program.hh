@@ -72,12 +72,23 @@ class Program {
     void begin(Location const &loc, String name, IdVec &&params);
     void add(UStm &&stm);
     void add(TheoryDef &&def, Logger &log);
+    //! Rewrite the program in place.
+    //!
+    //! The rewritten program refers to auxiliary predicates and variables
+    //! introduced here. It has no serialized form and its printed form cannot
+    //! be parsed again.
     void rewrite(Defines &defs, Logger &log);
     void check(Logger &log);
     void print(std::ostream &out) const;
     void addInput(Sig sig);
     bool empty() const;
-    Ground::Program toGround(std::set<Sig> const &sigs, DomainData &domains, Logger &log);
+    //! Translate the program into a ground program.
+    //!
+    //! If a demand callback is given, only statements needed to derive atoms
+    //! over the signatures it accepts are kept; see Ground::Dependency::analyze().
+    //! This must only be used if no further program parts are grounded.
+    Ground::Program toGround(std::set<Sig> const &sigs, DomainData &domains, Logger &log,
+                             std::function<bool(Sig)> const &demand = nullptr);
 
   private:
     void rewriteDots();
@@ -46,6 +46,9 @@ class Statement : public Printable, public Locatable, private IEContext {
     Statement &operator=(Statement &&other) noexcept = default;
     ~Statement() noexcept override = default;
 
+    //! Replace pools of values in the body and, if the statement has a body, in the head by fresh variables.
+    //! This keeps the statement in one piece instead of unpooling it into one statement per alternative.
+    void extractPools(AuxGen &auxGen);
     UStmVec unpool();
     bool hasPool() const;
     UStmVec unpoolComparison();
@@ -0,0 +1,95 @@
+// {{{ MIT License
+
+// Copyright 2024 Roland Kaminski
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// }}}
+
+#ifndef GRINGO_OUTPUT_DEDUP_HH
+#define GRINGO_OUTPUT_DEDUP_HH
+
+#include <gringo/backend.hh>
+#include <gringo/hash_set.hh>
+#include <vector>
+
+namespace Gringo {
+namespace Output {
+
+// {{{1 declaration of BackendDedup
+
+// Drops rules that have already been passed to the wrapped backend.
+//
+// Rules are compared after sorting their heads and bodies, so rules that
+// differ only in the order or repetition of literals are considered equal.
+// Since the wrapped backend accumulates rules over all steps, the set of seen
+// rules is never cleared.
+class BackendDedup : public Backend {
+  public:
+    explicit BackendDedup(UBackend out) : out_(std::move(out)) {}
+
+    // The number of rules that have been dropped so far.
+    size_t dropped() const { return dropped_; }
+    // Estimates the number of bytes allocated by the filter.
+    size_t memoryUsage() const {
+        return seen_.memoryUsage() + key_.capacity() * sizeof(int32_t) +
+               wlits_.capacity() * sizeof(Potassco::WeightLit_t);
+    }
+
+    void initProgram(bool incremental) override;
+    void beginStep() override;
+
+    void rule(Head_t ht, AtomSpan const &head, LitSpan const &body) override;
+    void rule(Head_t ht, AtomSpan const &head, Weight_t bound, WeightLitSpan const &body) override;
+    void minimize(Weight_t prio, WeightLitSpan const &lits) override;
+
+    void project(AtomSpan const &atoms) override;
+    void output(Symbol sym, Atom_t atom) override;
+    void output(Symbol sym, LitSpan const &condition) override;
+    void external(Atom_t a, Value_t v) override;
+    void assume(LitSpan const &lits) override;
+    void heuristic(Atom_t a, Heuristic_t t, int bias, unsigned prio, LitSpan const &condition) override;
+    void acycEdge(int s, int t, LitSpan const &condition) override;
+
+    void theoryTerm(Id_t termId, int number) override;
+    void theoryTerm(Id_t termId, StringSpan const &name) override;
+    void theoryTerm(Id_t termId, int cId, IdSpan const &args) override;
+    void theoryElement(Id_t elementId, IdSpan const &terms, LitSpan const &cond) override;
+    void theoryAtom(Id_t atomOrZero, Id_t termId, IdSpan const &elements) override;
+    void theoryAtom(Id_t atomOrZero, Id_t termId, IdSpan const &elements, Id_t op, Id_t rhs) override;
+
+    void endStep() override;
+
+  private:
+    void head_(Head_t ht, bool weight, AtomSpan const &head);
+    bool insert_();
+
+    UBackend out_;
+    array_set<int32_t> seen_;
+    std::vector<int32_t> key_;
+    std::vector<Potassco::WeightLit_t> wlits_;
+    size_t dropped_ = 0;
+};
+
+// }}}1
+
+} // namespace Output
+} // namespace Gringo
+
+#endif // GRINGO_OUTPUT_DEDUP_HH
@@ -58,6 +58,14 @@ class Mapping {
             map_.emplace(oldOffset, newOffset);
         }
     }
+    // Maps all offsets in the range [0, size) to themselves.
+    // Note: this has to be called before any other offsets are added.
+    void addIdentity(Id_t size) {
+        assert(id_.empty() && map_.empty());
+        if (size > 0) {
+            id_.emplace_back(0, size - 1);
+        }
+    }
     Id_t get(Id_t oldOffset) const {
         auto it = map_.find(oldOffset);
         if (it != map_.end()) {
@@ -185,18 +193,25 @@ class PredicateDomain : public AbstractDomain<PredicateAtom> {
         AbstractDomain<PredicateAtom>::clear();
         incOffset_ = 0;
         showOffset_ = 0;
+        cleanOffset_ = 0;
     }
 
     Sig const &sig() const { return sig_; }
 
     operator Sig const &() const { return sig_; }
 
-    std::pair<Id_t, Id_t> cleanup(AssignmentLookup assignment, Mapping &map);
+    // Removes false and undefined atoms and marks true atoms as facts.
+    // If the assignment did not change since the last cleanup, only atoms
+    // added in between are inspected.
+    // Returns the number of atoms that became facts and the number of deleted atoms.
+    std::pair<Id_t, Id_t> cleanup(AssignmentLookup assignment, Mapping &map, bool assignmentChanged = true);
 
   private:
     Sig sig_;
     SizeType incOffset_ = 0;
     SizeType showOffset_ = 0;
+    // This offset keeps track of atoms already inspected by cleanup.
+    SizeType cleanOffset_ = 0;
 };
 using UPredDom = std::unique_ptr<PredicateDomain>;
 
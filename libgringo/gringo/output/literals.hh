@@ -954,6 +954,9 @@ class DomainData {
         return wb_;
     }
     bool empty() const { return atoms_ == 0 && theory_.empty(); }
+    // Estimates the number of bytes allocated for the domains and the
+    // clause, tuple, and formula tables.
+    size_t memoryUsage() const;
 
     TheoryTermType termType(Id_t) const;
     int termNum(Id_t value) const;
@@ -968,6 +971,20 @@ class DomainData {
     Potassco::Lit_t atomLit(Id_t value) const;
     std::pair<char const *, Id_t> atomGuard(Id_t value) const;
     Potassco::Id_t numAtoms() const;
+    Potassco::Id_t numTerms() const;
+    Potassco::Id_t numElems() const;
+    // Bulk access to ranges of theory terms, elements, and atoms.
+    //
+    // Output arrays that are null are not filled. The offset arrays receive
+    // size + 1 entries delimiting the arguments, tuples, or elements of each
+    // entry, which can then be fetched in one go with the second function.
+    void fetchTerms(Id_t offset, size_t size, int *types, int *values, size_t *argOffsets) const;
+    void fetchTermArgs(Id_t offset, size_t size, Id_t *args, size_t capacity) const;
+    void fetchElems(Id_t offset, size_t size, Potassco::Lit_t *conds, size_t *tupleOffsets) const;
+    void fetchElemTuples(Id_t offset, size_t size, Id_t *tuples, size_t capacity) const;
+    void fetchAtoms(Id_t offset, size_t size, Potassco::Lit_t *lits, Id_t *terms, bool *hasGuard, Id_t *guardOps,
+                    Id_t *guardTerms, size_t *elemOffsets) const;
+    void fetchAtomElems(Id_t offset, size_t size, Id_t *elems, size_t capacity) const;
     std::string termStr(Id_t value) const;
     std::string elemStr(Id_t value) const;
     std::string atomStr(Id_t value) const;
@@ -68,6 +68,12 @@ struct OutputOptions {
     bool reifySCCs = false;
     bool reifySteps = false;
     bool preserveFacts = false;
+    // Write output in a separate thread while grounding.
+    //
+    // This only applies to the stream based output formats.
+    bool pipeline = false;
+    // Drop ground rules that have already been passed to the backend.
+    bool dedupRules = false;
 };
 
 class OutputPredicates {
@@ -98,6 +104,9 @@ class OutputPredicates {
     bool active_ = false;
 };
 
+class BackendPipeline;
+class BackendDedup;
+
 using Assumptions = Potassco::LitSpan;
 class OutputBase {
   public:
@@ -107,7 +116,10 @@ class OutputBase {
                OutputOptions opts = OutputOptions());
     OutputBase(Potassco::TheoryData &data, OutputPredicates outPreds, UAbstractOutput out);
 
-    std::pair<Id_t, Id_t> simplify(AssignmentLookup assignment);
+    // Simplifies the domains and output tables w.r.t. the given assignment.
+    // If the assignment did not change since the last call, only atoms added
+    // in between are inspected.
+    std::pair<Id_t, Id_t> simplify(AssignmentLookup assignment, bool assignmentChanged = true);
     void incremental();
     void output(Statement &x);
     void init(bool incremental);
@@ -115,6 +127,25 @@ class OutputBase {
     void endGround(Logger &log);
     void endStep(Assumptions const &ass);
     void checkOutPreds(Logger &log);
+    // Estimates the number of bytes allocated for grounding including
+    // interned function symbols.
+    size_t memoryUsage() const;
+    bool memoryLimitExceeded() const { return memoryLimit > 0 && memoryUsage() > memoryLimit; }
+    // Counts an instantiation step and checks the memory limit every few
+    // thousand steps.
+    //
+    // The steps are counted across all instantiators and ground calls.
+    bool checkMemoryLimit() {
+        return memoryLimit > 0 && ++memorySteps_ % memoryCheckInterval == 0 && memoryLimitExceeded();
+    }
+    // Prints the given number of predicate domains using the most memory.
+    void printLargestDomains(std::ostream &out, size_t n) const;
+    // Whether duplicate rules are filtered, the number of dropped rules, and
+    // the estimated number of bytes allocated by the filter.
+    bool dedupActive() const { return dedup_ != nullptr; }
+    size_t dedupDropped() const;
+    size_t dedupMemoryUsage() const;
+    Translator::MinimizeStats minimizeStats() const;
     SymVec atoms(unsigned atomset, IsTrueLookup lookup) const;
     std::pair<PredicateDomain::Iterator, PredicateDomain *> find(Symbol val);
     std::pair<PredicateDomain::ConstIterator, PredicateDomain const *> find(Symbol val) const;
@@ -159,8 +190,17 @@ class OutputBase {
     void removeMinimize();
 
   private:
-    static UAbstractOutput fromFormat(std::ostream &out, OutputFormat format, OutputOptions opts);
-    static UAbstractOutput fromBackend(UBackend out, OutputOptions opts);
+    static UAbstractOutput fromFormat(std::ostream &out, OutputFormat format, OutputOptions opts,
+                                      BackendPipeline *&pipeline, BackendDedup *&dedup);
+    static UAbstractOutput fromBackend(UBackend out, OutputOptions opts, BackendDedup *&dedup);
+    void flush_();
+
+    // The number of steps between two checks of the grounding memory limit.
+    static constexpr unsigned memoryCheckInterval = 1U << 12U;
+
+    BackendPipeline *pipeline_ = nullptr;
+    BackendDedup *dedup_ = nullptr;
+    unsigned memorySteps_ = 0;
 
   public:
     SymVec tempVals_;
@@ -171,6 +211,10 @@ class OutputBase {
     DomainData data;
     UAbstractOutput out_;
     bool keepFacts = false;
+    // facts over these signatures are passed as externals assigned to true
+    // so that they can be retracted later by assigning them to false
+    std::set<Sig> retractableFacts;
+    size_t memoryLimit = 0; // in bytes, zero means no limit
 };
 
 class ASPIFOutBackend : public Backend, private Potassco::TheoryData::Visitor {
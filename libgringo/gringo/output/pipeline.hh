@@ -0,0 +1,130 @@
+// {{{ MIT License
+
+// Copyright 2024 Roland Kaminski
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// }}}
+
+#ifndef GRINGO_OUTPUT_PIPELINE_HH
+#define GRINGO_OUTPUT_PIPELINE_HH
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <gringo/backend.hh>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Gringo {
+namespace Output {
+
+// {{{1 declaration of BackendPipeline
+
+// Passes backend calls to another backend running in a separate thread.
+//
+// Once started, calls are serialized into chunks, which are handed over to
+// the consumer thread via a bounded single-producer/single-consumer ring.
+// The producer only blocks if all chunks are in use. After a flush, all
+// pending calls have been passed on and subsequent calls are passed on
+// directly in the calling thread until the pipeline is started again.
+class BackendPipeline : public Backend {
+  public:
+    static constexpr size_t defaultChunkSize = 1U << 14U; // in words
+    static constexpr size_t defaultNumChunks = 8;
+
+    BackendPipeline(UBackend out, size_t chunkSize = defaultChunkSize, size_t numChunks = defaultNumChunks);
+    BackendPipeline(BackendPipeline const &other) = delete;
+    BackendPipeline(BackendPipeline &&other) noexcept = delete;
+    BackendPipeline &operator=(BackendPipeline const &other) = delete;
+    BackendPipeline &operator=(BackendPipeline &&other) noexcept = delete;
+    ~BackendPipeline() noexcept override;
+
+    // Queue subsequent calls instead of passing them on directly.
+    void start();
+    // Wait until all queued calls have been passed on and stop queuing.
+    //
+    // Exceptions thrown by the wrapped backend are rethrown here.
+    void flush();
+    bool active() const { return active_; }
+
+    void initProgram(bool incremental) override;
+    void beginStep() override;
+
+    void rule(Head_t ht, AtomSpan const &head, LitSpan const &body) override;
+    void rule(Head_t ht, AtomSpan const &head, Weight_t bound, WeightLitSpan const &body) override;
+    void minimize(Weight_t prio, WeightLitSpan const &lits) override;
+
+    void project(AtomSpan const &atoms) override;
+    void output(Symbol sym, Atom_t atom) override;
+    void output(Symbol sym, LitSpan const &condition) override;
+    void external(Atom_t a, Value_t v) override;
+    void assume(LitSpan const &lits) override;
+    void heuristic(Atom_t a, Heuristic_t t, int bias, unsigned prio, LitSpan const &condition) override;
+    void acycEdge(int s, int t, LitSpan const &condition) override;
+
+    void theoryTerm(Id_t termId, int number) override;
+    void theoryTerm(Id_t termId, StringSpan const &name) override;
+    void theoryTerm(Id_t termId, int cId, IdSpan const &args) override;
+    void theoryElement(Id_t elementId, IdSpan const &terms, LitSpan const &cond) override;
+    void theoryAtom(Id_t atomOrZero, Id_t termId, IdSpan const &elements) override;
+    void theoryAtom(Id_t atomOrZero, Id_t termId, IdSpan const &elements, Id_t op, Id_t rhs) override;
+
+    void endStep() override;
+
+  private:
+    using Chunk = std::vector<uint32_t>;
+    enum class Call : uint32_t;
+
+    void push_(uint32_t word) { chunks_[head_ % chunks_.size()].push_back(word); }
+    void push_(int word) { push_(static_cast<uint32_t>(word)); }
+    void push_(char c) { push_(static_cast<uint32_t>(static_cast<unsigned char>(c))); }
+    void push_(Potassco::WeightLit_t const &wlit);
+    void push_(Symbol sym);
+    template <class T> void push_(Potassco::Span<T> const &span);
+    template <class... Args> void call_(Call call, Args const &...args);
+    void publish_();
+    template <class P> void wait_(P pred);
+    void run_();
+    void replay_(Chunk const &chunk);
+
+    UBackend out_;
+    std::vector<Chunk> chunks_;
+    size_t chunkSize_;
+    // the chunk currently filled by the producer; chunks in the range
+    // [consumed_, published_) are owned by the consumer
+    size_t head_ = 0;
+    std::atomic<size_t> published_{0};
+    std::atomic<size_t> consumed_{0};
+    std::atomic<bool> failed_{false};
+    std::exception_ptr exc_;
+    std::mutex mut_;
+    std::condition_variable cv_;
+    std::thread thread_;
+    bool stop_ = false;
+    bool active_ = false;
+};
+
+// }}}1
+
+} // namespace Output
+} // namespace Gringo
+
+#endif // GRINGO_OUTPUT_PIPELINE_HH
@@ -198,6 +198,8 @@ class TheoryDirective : public Statement {
 
 enum class ShowType : unsigned { Shown = 2, Atoms = 4, Terms = 8, Theory = 16, All = 31, Complement = 32 };
 
+class Minimize;
+
 class Translator {
   private:
     struct OutputTable {
@@ -212,6 +214,12 @@ class Translator {
     using MinimizeList = std::vector<TupleLit>;
     using ProjectionVec = std::vector<std::pair<Potassco::Id_t, Potassco::Id_t>>;
     using TupleLitMap = ordered_map<TupleId, LiteralId>;
+    // Statistics about the minimize constraint passed to the backend.
+    struct MinimizeStats {
+        size_t tuples = 0;     // number of tuples in the minimize constraint
+        size_t literals = 0;   // number of weighted literals passed so far
+        size_t extensions = 0; // number of times a tuple was extended in a later step
+    };
 
     Translator(UAbstractOutput out, bool preserveFacts);
 
@@ -231,6 +239,7 @@ class Translator {
     LiteralId clause(ClauseId id, bool conjunctive, bool equivalence);
     void clause(LiteralId lit, ClauseId id, bool conjunctive, bool equivalence);
     void reset() { clauses_.clear(); }
+    MinimizeStats const &minimizeStats() const { return minimizeStats_; }
 
   private:
     LitVec updateCond(DomainData &data, OutputTable::Todo::value_type const &todo);
@@ -238,11 +247,15 @@ class Translator {
     void showValue(DomainData &data, Symbol value, LitVec const &cond);
     void showValue(DomainData &data, Bound const &bound, LitVec const &cond);
     void translateMinimize(DomainData &data);
+    void extendMinimize(DomainData &data, Minimize &lm, LiteralId &lit, TupleId tuple, LitVec const &cond,
+                        int weight);
     void outputSymbols(DomainData &data, OutputPredicates const &outPreds, Logger &log);
 
     OutputTable termOutput_;
     MinimizeList minimize_; // stores minimize constraint for current step
-    TupleLitMap tuples_;    // to incrementally extend minimize constraint
+    TupleLitMap tuples_;     // to incrementally extend minimize constraint
+    TupleLitMap openTuples_; // open atoms of tuples extended in later steps
+    MinimizeStats minimizeStats_;
     UAbstractOutput out_;
     hash_map<Symbol, uint32_t> nodeUids_;
     struct ClauseKey {
@@ -180,6 +180,9 @@ class Symbol {
     static Symbol createFun(String name, SymVec const &args, bool sign = false) {
         return createFun(name, Potassco::toSpan(args), sign);
     }
+    // Estimates the number of bytes allocated for interned function symbols
+    // and cached renderings.
+    static size_t memoryUsage();
 
     // value retrieval
     SymbolType type() const;
@@ -207,6 +210,14 @@ class Symbol {
 
     // ouput
     void print(std::ostream &out) const;
+    // Appends the textual representation of the symbol to the given string.
+    void print(std::string &out) const;
+    // Returns the textual representation of the symbol.
+    //
+    // Renderings of functions and strings are cached up to a memory limit so
+    // that printing the same symbol again does not have to format it again.
+    // The returned string is valid until the next call in the same thread.
+    char const *printCached() const;
 
     uint64_t const &rep() const { return rep_; }
 
@@ -110,6 +110,9 @@ class GTerm : public Clonable<GTerm>, public Printable, public Hashable, public
 
     virtual Sig sig() const = 0;
     virtual EvalResult eval() const = 0;
+    // Evaluates the argument at the given position of a function term.
+    // Returns false if there is no such argument or it is not ground.
+    virtual EvalResult evalArg(unsigned idx) const = 0;
     virtual bool occurs(GRef &x) const = 0;
     virtual void reset() = 0;
     virtual bool match(Symbol const &x) = 0;
@@ -480,6 +483,7 @@ class GValTerm : public GTerm {
     void print(std::ostream &out) const override;
     Sig sig() const override;
     EvalResult eval() const override;
+    EvalResult evalArg(unsigned idx) const override;
     bool occurs(GRef &x) const override;
     void reset() override;
     bool match(Symbol const &x) override;
@@ -515,6 +519,7 @@ class GFunctionTerm : public GTerm {
     void print(std::ostream &out) const override;
     Sig sig() const override;
     EvalResult eval() const override;
+    EvalResult evalArg(unsigned idx) const override;
     bool occurs(GRef &x) const override;
     void reset() override;
     bool match(Symbol const &x) override;
@@ -551,6 +556,7 @@ class GLinearTerm : public GTerm {
     void print(std::ostream &out) const override;
     Sig sig() const override;
     EvalResult eval() const override;
+    EvalResult evalArg(unsigned idx) const override;
     bool occurs(GRef &x) const override;
     void reset() override;
     bool match(Symbol const &x) override;
@@ -585,6 +591,7 @@ class GVarTerm : public GTerm {
     void print(std::ostream &out) const override;
     Sig sig() const override;
     EvalResult eval() const override;
+    EvalResult evalArg(unsigned idx) const override;
     bool occurs(GRef &x) const override;
     void reset() override;
     bool match(Symbol const &x) override;
@@ -25,6 +25,8 @@
 #include <gringo/ground/instantiation.hh>
 #include <gringo/output/output.hh>
 
+#include <sstream>
+
 #define DEBUG_INSTANTIATION 0
 
 namespace Gringo {
@@ -77,7 +79,7 @@ void Instantiator::finalize(DependVec &&depends) {
 
 void Instantiator::enqueue(Queue &queue) { queue.enqueue(*this); }
 
-void Instantiator::instantiate(Output::OutputBase &out, Logger &log) {
+void Instantiator::instantiate(Output::OutputBase &out, Logger &log, std::atomic<bool> const *interrupted) {
 #if DEBUG_INSTANTIATION > 0
     std::cerr << "  instantiate: " << *this << std::endl;
 #endif
@@ -89,6 +91,18 @@ void Instantiator::instantiate(Output::OutputBase &out, Logger &log) {
 #if DEBUG_INSTANTIATION > 1
         std::cerr << "    start at: " << *it << std::endl;
 #endif
+        if (interrupted != nullptr && interrupted->load(std::memory_order_relaxed)) {
+            throw std::runtime_error("grounding interrupted");
+        }
+        if (out.checkMemoryLimit()) {
+            std::ostringstream oss;
+            oss << "grounding memory limit of " << (out.memoryLimit >> 20U) << "MB exceeded\n"
+                << "  while grounding rule with head: ";
+            callback->printHead(oss);
+            oss << "\n  largest domains:\n";
+            out.printLargestDomains(oss, 3);
+            throw std::runtime_error(oss.str());
+        }
         it->backjumpable = true;
         if (it->next()) {
             for (--it; it->first(log); --it) {
@@ -142,9 +156,14 @@ void Queue::process(Output::OutputBase &out, Logger &log) {
                 std::cerr << "************start step" << std::endl;
 #endif
                 queue.swap(current);
-                for (Instantiator &x : current) {
-                    x.instantiate(out, log);
-                    x.enqueued = false;
+                try {
+                    for (Instantiator &x : current) {
+                        x.instantiate(out, log, interrupted);
+                        x.enqueued = false;
+                    }
+                } catch (...) {
+                    abort_();
+                    throw;
                 }
                 for (Instantiator &x : current) {
                     x.callback->propagate(*this);
@@ -170,6 +189,22 @@ void Queue::process(Output::OutputBase &out, Logger &log) {
     }
     domains.clear();
 }
+
+void Queue::abort_() {
+    for (auto *queue : {&current, &queues[0], &queues[1]}) {
+        for (Instantiator &x : *queue) {
+            x.enqueued = false;
+        }
+        queue->clear();
+    }
+    // advance all domains as if instantiation had finished
+    for (Domain &x : domains) {
+        do {
+            x.nextGeneration();
+        } while (x.dequeue());
+    }
+    domains.clear();
+}
 void Queue::enqueue(Instantiator &inst) {
     if (!inst.enqueued) {
         // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
@@ -27,6 +27,16 @@
 namespace Gringo {
 namespace Ground {
 
+UIdx Literal::index(Context &context, BinderType type, Term::VarSet &bound, VarBoundVec &bounds) {
+    static_cast<void>(bounds);
+    return index(context, type, bound);
+}
+
+void Literal::collectBounds(Term::VarSet const &bound, VarBoundVec &bounds) const {
+    static_cast<void>(bound);
+    static_cast<void>(bounds);
+}
+
 void Literal::collectImportant(Term::VarSet &vars) {
     auto *occ(occurrence());
     if (occ != nullptr && occ->getType() != OccurrenceType::POSITIVELY_STRATIFIED) {
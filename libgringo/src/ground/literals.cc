@@ -117,6 +117,75 @@ class RangeMatcher : public Binder {
 
 // }}}
 
+// {{{ declaration of PoolBinder
+
+class PoolBinder : public Binder {
+  public:
+    PoolBinder(UTerm assign, SymVec const &values) : assign_(std::move(assign)), values_(values) {}
+
+    IndexUpdater *getUpdater() override { return nullptr; }
+
+    void match(Logger &log) override {
+        static_cast<void>(log);
+        current_ = values_.begin();
+    }
+
+    bool next() override {
+        while (current_ != values_.end()) {
+            if (assign_->match(*current_++)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void print(std::ostream &out) const override {
+        out << *assign_ << "=(";
+        print_comma(out, values_, ";");
+        out << ")";
+    }
+
+  private:
+    UTerm assign_;
+    SymVec const &values_;
+    SymVec::const_iterator current_;
+};
+
+// }}}
+// {{{ declaration of PoolMatcher
+
+class PoolMatcher : public Binder {
+  public:
+    PoolMatcher(Term &assign, SymVec const &sorted) : assign_(assign), sorted_(sorted) {}
+
+    IndexUpdater *getUpdater() override { return nullptr; }
+
+    void match(Logger &log) override {
+        bool undefined = false;
+        Symbol a{assign_.eval(undefined, log)};
+        firstMatch_ = !undefined && std::binary_search(sorted_.begin(), sorted_.end(), a);
+    }
+
+    bool next() override {
+        bool m = firstMatch_;
+        firstMatch_ = false;
+        return m;
+    }
+
+    void print(std::ostream &out) const override {
+        out << assign_ << "=(";
+        print_comma(out, sorted_, ";");
+        out << ")";
+    }
+
+  private:
+    Term &assign_;
+    SymVec const &sorted_;
+    bool firstMatch_ = false;
+};
+
+// }}}
+
 // {{{ declaration of ScriptBinder
 
 class ScriptBinder : public Binder {
@@ -303,6 +372,45 @@ Literal::Score RangeLiteral::score(Term::VarSet const &bound, Logger &log) {
 }
 std::pair<Output::LiteralId, bool> RangeLiteral::toOutput(Logger &log) { return {Output::LiteralId(), true}; }
 
+// {{{1 definition of PoolLiteral
+
+PoolLiteral::PoolLiteral(UTerm assign, SymVec values)
+    : assign_(std::move(assign)), values_(std::move(values)), sorted_(values_) {
+    std::sort(sorted_.begin(), sorted_.end());
+}
+
+void PoolLiteral::print(std::ostream &out) const {
+    out << *assign_ << "=(";
+    print_comma(out, values_, ";");
+    out << ")";
+}
+
+bool PoolLiteral::isRecursive() const { return false; }
+
+BodyOcc *PoolLiteral::occurrence() { return nullptr; }
+
+void PoolLiteral::collect(VarTermBoundVec &vars) const { assign_->collect(vars, true); }
+
+UIdx PoolLiteral::index(Context &context, BinderType type, Term::VarSet &bound) {
+    static_cast<void>(context);
+    static_cast<void>(type);
+    if (assign_->bind(bound)) {
+        return gringo_make_unique<PoolBinder>(get_clone(assign_), values_);
+    }
+    return gringo_make_unique<PoolMatcher>(*assign_, sorted_);
+}
+
+Literal::Score PoolLiteral::score(Term::VarSet const &bound, Logger &log) {
+    static_cast<void>(bound);
+    static_cast<void>(log);
+    return static_cast<double>(values_.size());
+}
+
+std::pair<Output::LiteralId, bool> PoolLiteral::toOutput(Logger &log) {
+    static_cast<void>(log);
+    return {Output::LiteralId(), true};
+}
+
 // {{{1 definition of ScriptLiteral
 
 ScriptLiteral::ScriptLiteral(UTerm assign, String name, UTermVec args)
@@ -374,6 +482,29 @@ UIdx RelationLiteral::index(Context &context, BinderType type, Term::VarSet &bou
     return gringo_make_unique<RelationMatcher>(shared_);
 }
 
+void RelationLiteral::collectBounds(Term::VarSet const &bound, VarBoundVec &bounds) const {
+    auto cmp = std::get<0>(shared_);
+    if (cmp == Relation::EQ || cmp == Relation::NEQ) {
+        return;
+    }
+    auto add = [&bound, &bounds](Relation rel, Term const &lhs, Term const &rhs) {
+        auto const *var = dynamic_cast<VarTerm const *>(&lhs);
+        if (var == nullptr || bound.find(var->name) != bound.end()) {
+            return;
+        }
+        VarTermBoundVec vars;
+        rhs.collect(vars, false);
+        for (auto &occ : vars) {
+            if (bound.find(occ.first->name) == bound.end()) {
+                return;
+            }
+        }
+        bounds.emplace_back(var->name, RangeBound{rel, UTerm{rhs.clone()}});
+    };
+    add(cmp, *std::get<1>(shared_), *std::get<2>(shared_));
+    add(inv(cmp), *std::get<2>(shared_), *std::get<1>(shared_));
+}
+
 Literal::Score RelationLiteral::score(Term::VarSet const &bound, Logger &log) {
     static_cast<void>(bound);
     static_cast<void>(log);
@@ -458,6 +589,15 @@ UIdx PredicateLiteral::index(Context &context, BinderType type, Term::VarSet &bo
     return make_index(type, bound, false);
 }
 
+UIdx PredicateLiteral::index(Context &context, BinderType type, Term::VarSet &bound, VarBoundVec &bounds) {
+    if (naf_ == NAF::POS && !bounds.empty()) {
+        if (auto ret = make_range_binder(domain_, *repr_, offset_, type, bound, bounds)) {
+            return ret;
+        }
+    }
+    return index(context, type, bound);
+}
+
 BodyOcc *PredicateLiteral::occurrence() { return this; }
 
 UGTerm PredicateLiteral::getRepr() const { return repr_->gterm(); }
@@ -496,6 +636,11 @@ UIdx ProjectionLiteral::index(Context &context, BinderType type, Term::VarSet &b
     return make_index(type, bound, initialized_);
 }
 
+UIdx ProjectionLiteral::index(Context &context, BinderType type, Term::VarSet &bound, VarBoundVec &bounds) {
+    static_cast<void>(bounds);
+    return index(context, type, bound);
+}
+
 // }}}1
 
 } // namespace Ground
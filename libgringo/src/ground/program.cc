@@ -118,6 +118,16 @@ void Program::prepare(Parameters const &params, Output::OutputBase &out, Logger
             for (auto &z : std::get<1>(*x)) {
                 auto it(doms.find(z.sig()));
                 assert(it != doms.end());
+                if (out.retractableFacts.find(z.sig()) != out.retractableFacts.end()) {
+                    auto ret((*it)->define(z, false));
+                    std::get<0>(ret)->setExternal(true);
+                    Potassco::Id_t offset = static_cast<Id_t>(std::get<0>(ret) - (*it)->begin());
+                    Potassco::Id_t domain = static_cast<Id_t>(it - doms.begin());
+                    Output::External external({NAF::POS, Output::AtomType::Predicate, offset, domain},
+                                              Potassco::Value_t::True);
+                    out.output(external);
+                    continue;
+                }
                 auto ret((*it)->define(z, true));
                 if (!std::get<2>(ret)) {
                     Potassco::Id_t offset = static_cast<Id_t>(std::get<0>(ret) - (*it)->begin());
@@ -144,8 +154,9 @@ void Program::prepare(Parameters const &params, Output::OutputBase &out, Logger
     }
 }
 
-void Program::ground(Context &context, Output::OutputBase &out, Logger &log) {
+void Program::ground(Context &context, Output::OutputBase &out, Logger &log, std::atomic<bool> const *interrupted) {
     Queue q;
+    q.interrupted = interrupted;
     for (auto &x : stms_) {
         if (!linearized_) {
             for (auto &y : x.first) {
@@ -181,7 +181,29 @@ InstVec _linearize(Logger &log, Context &context, bool positive, SolutionCallbac
                     y->data.depends.insert(y->data.depends.end(), bb.second.begin(), bb.second.end());
                 }
             }
-            auto index(y->data.lit.index(context, y->data.type, bound));
+            // Comparisons bounding the unbound variables of the literal can restrict the atoms to visit.
+            // If a bound is used, the literal also depends on the literals binding the variables in the bound.
+            VarBoundVec bounds;
+            for (auto &lit : x) {
+                lit.second->collectBounds(bound, bounds);
+            }
+            std::vector<VarTermBoundVec> boundVars;
+            for (auto &b : bounds) {
+                boundVars.emplace_back();
+                b.second.term->collect(boundVars.back(), false);
+            }
+            auto index(y->data.lit.index(context, y->data.type, bound, bounds));
+            for (size_t j = 0; j < bounds.size(); ++j) {
+                if (bounds[j].second.term == nullptr) {
+                    for (auto &occ : boundVars[j]) {
+                        auto it = varMap.find(occ.first->name);
+                        if (it != varMap.end()) {
+                            auto &bb(boundBy[it->second->data]);
+                            y->data.depends.insert(y->data.depends.end(), bb.second.begin(), bb.second.end());
+                        }
+                    }
+                }
+            }
             if (auto *update = index->getUpdater()) {
                 if (BodyOcc *occ = y->data.lit.occurrence()) {
                     for (HeadOccurrence &x : occ->definedBy()) {
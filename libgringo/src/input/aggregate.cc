@@ -160,11 +160,21 @@ UTerm ToGroundArg::newId(UTermVec &&global, Location const &loc, bool increment)
 
 void BodyAggregate::addToSolver(IESolver &solver) { static_cast<void>(solver); }
 
+void BodyAggregate::extractPools(ULitVec &pools, AuxGen &auxGen) {
+    static_cast<void>(pools);
+    static_cast<void>(auxGen);
+}
+
 // }}}
 // {{{ definition of HeadAggregate
 
 void HeadAggregate::addToSolver(IESolver &solver) { static_cast<void>(solver); }
 
+void HeadAggregate::extractPools(ULitVec &pools, AuxGen &auxGen) {
+    static_cast<void>(pools);
+    static_cast<void>(auxGen);
+}
+
 void HeadAggregate::initTheory(TheoryDefs &def, bool hasBody, Logger &log) {
     static_cast<void>(def);
     static_cast<void>(hasBody);
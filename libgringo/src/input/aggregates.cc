@@ -1189,6 +1189,8 @@ void SimpleBodyLiteral::check(ChkLvlVec &levels, Logger &log) const {
 
 bool SimpleBodyLiteral::hasPool() const { return lit_->hasPool(false); }
 
+void SimpleBodyLiteral::extractPools(ULitVec &pools, AuxGen &auxGen) { lit_->extractPools(pools, auxGen); }
+
 void SimpleBodyLiteral::replace(Defines &x) { lit_->replace(x); }
 
 CreateBody SimpleBodyLiteral::toGround(ToGroundArg &x, Ground::UStmVec &stms) const {
@@ -2239,6 +2241,8 @@ SimpleHeadLiteral *SimpleHeadLiteral::clone() const {
 
 bool SimpleHeadLiteral::hasPool() const { return lit_->hasPool(true); }
 
+void SimpleHeadLiteral::extractPools(ULitVec &pools, AuxGen &auxGen) { lit_->extractPools(pools, auxGen); }
+
 void SimpleHeadLiteral::unpool(UHeadAggrVec &x) {
     for (auto &y : lit_->unpool(true)) {
         x.emplace_back(gringo_make_unique<SimpleHeadLiteral>(std::move(y)));
@@ -58,6 +58,11 @@ ULitVecVec Literal::unpoolComparison() const {
 
 bool Literal::hasUnpoolComparison() const { return false; }
 
+void Literal::extractPools(ULitVec &pools, AuxGen &auxGen) {
+    static_cast<void>(pools);
+    static_cast<void>(auxGen);
+}
+
 // }}}
 //
 } // namespace Input
@@ -30,6 +30,39 @@
 namespace Gringo {
 namespace Input {
 
+namespace {
+
+// Collects the values of a term with pools.
+// Returns false if one of the unpooled terms is not a value.
+bool poolValues_(UTerm const &term, SymVec &values) {
+    std::unordered_set<Symbol> seen;
+    for (auto &alt : Gringo::unpool(term)) {
+        Symbol val = alt->isEDB();
+        if (val.type() == SymbolType::Special) {
+            return false;
+        }
+        if (seen.emplace(val).second) {
+            values.emplace_back(val);
+        }
+    }
+    return true;
+}
+
+// Replaces a term with pools of values by a fresh variable bound by a pool literal.
+bool extractPool_(UTerm &term, ULitVec &pools, AuxGen &auxGen) {
+    SymVec values;
+    if (!term->hasPool() || !poolValues_(term, values)) {
+        return false;
+    }
+    auto loc = term->loc();
+    UTerm var = auxGen.uniqueVar(loc, 0, "#Pool");
+    pools.emplace_back(make_locatable<PoolLiteral>(loc, get_clone(var), std::move(values)));
+    term = std::move(var);
+    return true;
+}
+
+} // namespace
+
 // {{{ definition of Literal::
 
 Symbol Literal::isEDB() const { return {}; }
@@ -127,6 +160,43 @@ Symbol PredicateLiteral::isEDB() const { return naf_ == NAF::POS ? repr_->isEDB(
 
 bool PredicateLiteral::hasPool(bool head) const { return repr_->hasPool(); }
 
+void PredicateLiteral::extractPools(ULitVec &pools, AuxGen &auxGen) {
+    if (!repr_->hasPool()) {
+        return;
+    }
+    auto loc = repr_->loc();
+    // pools in arguments like p((1;2),(a;b))
+    if (auto *fun = dynamic_cast<FunctionTerm *>(repr_.get())) {
+        UTermVec args;
+        bool extracted = false;
+        for (auto const &arg : fun->arguments()) {
+            args.emplace_back(get_clone(arg));
+            extracted = extractPool_(args.back(), pools, auxGen) || extracted;
+        }
+        if (extracted) {
+            repr_ = make_locatable<FunctionTerm>(loc, fun->getSig().name(), std::move(args));
+        }
+        return;
+    }
+    // pools of atoms like p(1,a;2,b) with the same signature
+    SymVec values;
+    if (!poolValues_(repr_, values)) {
+        return;
+    }
+    auto sig = values.front().sig();
+    if (sig.arity() == 0 || sig.sign() ||
+        !std::all_of(values.begin(), values.end(), [sig](Symbol const &val) { return val.sig() == sig; })) {
+        return;
+    }
+    UTermVec vars;
+    for (uint32_t i = 0; i < sig.arity(); ++i) {
+        vars.emplace_back(auxGen.uniqueVar(loc, 0, "#Pool"));
+    }
+    UTerm assign = make_locatable<FunctionTerm>(loc, sig.name(), get_clone(vars));
+    pools.emplace_back(make_locatable<PoolLiteral>(loc, std::move(assign), std::move(values)));
+    repr_ = make_locatable<FunctionTerm>(loc, sig.name(), std::move(vars));
+}
+
 void PredicateLiteral::replace(Defines &x) { Term::replace(repr_, repr_->replace(x, false)); }
 
 Ground::ULit PredicateLiteral::toGround(DomainData &x, bool auxiliary) const {
@@ -423,6 +493,13 @@ void RelationLiteral::toTuple(UTermVec &tuple, int &id) const {
     ++id;
 }
 
+void RelationLiteral::extractPools(ULitVec &pools, AuxGen &auxGen) {
+    extractPool_(left_, pools, auxGen);
+    for (auto &term : right_) {
+        extractPool_(term.second, pools, auxGen);
+    }
+}
+
 bool RelationLiteral::hasPool(bool head) const {
     static_cast<void>(head);
     if (left_->hasPool()) {
@@ -582,6 +659,68 @@ bool RangeLiteral::auxiliary() const { return true; }
 
 void RangeLiteral::auxiliary(bool aux) { static_cast<void>(aux); }
 
+// }}}
+// {{{ definition of PoolLiteral
+
+PoolLiteral::PoolLiteral(UTerm &&assign, SymVec &&values) : assign_(std::move(assign)), values_(std::move(values)) {}
+
+void PoolLiteral::print(std::ostream &out) const {
+    out << "#pool(" << *assign_ << ",(";
+    print_comma(out, values_, ";");
+    out << "))";
+}
+
+PoolLiteral *PoolLiteral::clone() const {
+    return make_locatable<PoolLiteral>(loc(), get_clone(assign_), SymVec{values_}).release();
+}
+
+bool PoolLiteral::simplify(Logger &log, Projections &project, SimplifyState &state, bool positional, bool singleton) {
+    return true;
+}
+
+void PoolLiteral::collect(VarTermBoundVec &vars, bool bound) const { assign_->collect(vars, bound); }
+
+bool PoolLiteral::operator==(Literal const &other) const {
+    const auto *t = dynamic_cast<PoolLiteral const *>(&other);
+    return t != nullptr && is_value_equal_to(assign_, t->assign_) && values_ == t->values_;
+}
+
+void PoolLiteral::rewriteArithmetics(Term::ArithmeticsMap &arith, RelationVec &assign, AuxGen &auxGen) {
+    Term::replace(this->assign_, this->assign_->rewriteArithmetics(arith, auxGen));
+}
+
+size_t PoolLiteral::hash() const { return get_value_hash(typeid(PoolLiteral).hash_code(), assign_, values_); }
+
+ULitVec PoolLiteral::unpool(bool head) const {
+    ULitVec value;
+    value.emplace_back(ULit(clone()));
+    return value;
+}
+
+void PoolLiteral::toTuple(UTermVec &tuple, int &id) const {
+    throw std::logic_error("PoolLiteral::toTuple should never be called if used properly");
+}
+
+bool PoolLiteral::hasPool(bool head) const { return false; }
+
+void PoolLiteral::replace(Defines &x) { Term::replace(assign_, assign_->replace(x, true)); }
+
+Ground::ULit PoolLiteral::toGround(DomainData &x, bool auxiliary) const {
+    return gringo_make_unique<Ground::PoolLiteral>(get_clone(assign_), values_);
+}
+
+ULit PoolLiteral::shift(bool negate) {
+    throw std::logic_error("PoolLiteral::shift should never be called  if used properly");
+}
+
+UTerm PoolLiteral::headRepr() const {
+    throw std::logic_error("PoolLiteral::headRepr should never be called if used properly");
+}
+
+bool PoolLiteral::auxiliary() const { return true; }
+
+void PoolLiteral::auxiliary(bool aux) { static_cast<void>(aux); }
+
 // }}}
 // {{{ definition of ScriptLiteral
 
@@ -144,6 +144,7 @@ void Program::rewrite(Defines &defs, Logger &log) {
         }
         // rewriting
         // steps:
+        // 0. extract pools of values
         // 1. unpool
         // 2. initialize theory
         // 3. simplify
@@ -172,6 +173,7 @@ void Program::rewrite(Defines &defs, Logger &log) {
         for (auto &x : block.addedStms) {
             x->replace(defs);
             x->replace(incDefs);
+            x->extractPools(gen);
             x->assignLevels(blockBound);
             if (x->hasPool()) {
                 for (auto &y : x->unpool()) {
@@ -282,7 +284,8 @@ class DummyStatement : public Ground::Statement, private Ground::HeadOccurrence
     bool normal_;
 };
 
-Ground::Program Program::toGround(std::set<Sig> const &sigs, DomainData &domains, Logger &log) {
+Ground::Program Program::toGround(std::set<Sig> const &sigs, DomainData &domains, Logger &log,
+                                  std::function<bool(Sig)> const &demand) {
     Ground::UStmVec stms;
     if (!pheads.empty()) {
         stms.emplace_back(gringo_make_unique<DummyStatement>(std::move(pheads), true));
@@ -311,7 +314,15 @@ Ground::Program Program::toGround(std::set<Sig> const &sigs, DomainData &domains
         auto &node(dep.add(std::move(x), normal));
         node.stm->analyze(node, dep);
     }
-    auto ret = dep.analyze();
+    Ground::Statement::Dep::Demand isDemanded;
+    if (demand) {
+        isDemanded = [&demand](Ground::Statement::Dep::Node const &node) {
+            return node.provide.empty() ||
+                   std::any_of(node.provide.begin(), node.provide.end(),
+                               [&demand](auto const &provide) { return demand(provide.second->sig()); });
+        };
+    }
+    auto ret = dep.analyze(isDemanded);
     Ground::Program prg(std::move(edb), std::move(std::get<0>(ret)));
     pheads = std::move(std::get<1>(ret));
     nheads = std::move(std::get<2>(ret));
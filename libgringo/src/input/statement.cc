@@ -53,6 +53,19 @@ void Statement::print(std::ostream &out) const { head_->printWithCondition(out,
 
 Symbol Statement::isEDB() const { return body_.empty() ? head_->isEDB() : Symbol(); }
 
+void Statement::extractPools(AuxGen &auxGen) {
+    ULitVec pools;
+    if (!body_.empty()) {
+        head_->extractPools(pools, auxGen);
+    }
+    for (auto &lit : body_) {
+        lit->extractPools(pools, auxGen);
+    }
+    for (auto &lit : pools) {
+        add(std::move(lit));
+    }
+}
+
 UStmVec Statement::unpool() {
     std::vector<UBodyAggrVec> bodies;
     Term::unpool(
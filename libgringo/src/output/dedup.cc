@@ -0,0 +1,129 @@
+// {{{ MIT License
+
+// Copyright 2024 Roland Kaminski
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// }}}
+
+#include "gringo/output/dedup.hh"
+#include <algorithm>
+
+namespace Gringo {
+namespace Output {
+
+// {{{1 definition of BackendDedup
+
+void BackendDedup::initProgram(bool incremental) { out_->initProgram(incremental); }
+
+void BackendDedup::beginStep() { out_->beginStep(); }
+
+void BackendDedup::head_(Head_t ht, bool weight, AtomSpan const &head) {
+    // the key starts with the type of the rule followed by the sorted and
+    // deduplicated head atoms
+    key_.clear();
+    key_.emplace_back((weight ? 2 : 0) + (ht == Head_t::Choice ? 1 : 0));
+    key_.emplace_back(0);
+    for (auto const &atom : head) {
+        key_.emplace_back(static_cast<int32_t>(atom));
+    }
+    std::sort(key_.begin() + 2, key_.end());
+    key_.erase(std::unique(key_.begin() + 2, key_.end()), key_.end());
+    key_[1] = static_cast<int32_t>(key_.size() - 2);
+}
+
+bool BackendDedup::insert_() {
+    if (seen_.insert(make_span(key_)).second) {
+        return true;
+    }
+    ++dropped_;
+    return false;
+}
+
+void BackendDedup::rule(Head_t ht, AtomSpan const &head, LitSpan const &body) {
+    head_(ht, false, head);
+    auto offset = key_.size();
+    key_.insert(key_.end(), begin(body), end(body));
+    std::sort(key_.begin() + offset, key_.end());
+    key_.erase(std::unique(key_.begin() + offset, key_.end()), key_.end());
+    if (insert_()) {
+        out_->rule(ht, head, body);
+    }
+}
+
+void BackendDedup::rule(Head_t ht, AtomSpan const &head, Weight_t bound, WeightLitSpan const &body) {
+    head_(ht, true, head);
+    key_.emplace_back(bound);
+    // weighted literals are sorted but not deduplicated because repeated
+    // literals contribute their weight multiple times
+    wlits_.assign(begin(body), end(body));
+    std::sort(wlits_.begin(), wlits_.end(), [](Potassco::WeightLit_t const &a, Potassco::WeightLit_t const &b) {
+        return std::make_pair(a.lit, a.weight) < std::make_pair(b.lit, b.weight);
+    });
+    for (auto const &wlit : wlits_) {
+        key_.emplace_back(wlit.lit);
+        key_.emplace_back(wlit.weight);
+    }
+    if (insert_()) {
+        out_->rule(ht, head, bound, body);
+    }
+}
+
+void BackendDedup::minimize(Weight_t prio, WeightLitSpan const &lits) { out_->minimize(prio, lits); }
+
+void BackendDedup::project(AtomSpan const &atoms) { out_->project(atoms); }
+
+void BackendDedup::output(Symbol sym, Atom_t atom) { out_->output(sym, atom); }
+
+void BackendDedup::output(Symbol sym, LitSpan const &condition) { out_->output(sym, condition); }
+
+void BackendDedup::external(Atom_t a, Value_t v) { out_->external(a, v); }
+
+void BackendDedup::assume(LitSpan const &lits) { out_->assume(lits); }
+
+void BackendDedup::heuristic(Atom_t a, Heuristic_t t, int bias, unsigned prio, LitSpan const &condition) {
+    out_->heuristic(a, t, bias, prio, condition);
+}
+
+void BackendDedup::acycEdge(int s, int t, LitSpan const &condition) { out_->acycEdge(s, t, condition); }
+
+void BackendDedup::theoryTerm(Id_t termId, int number) { out_->theoryTerm(termId, number); }
+
+void BackendDedup::theoryTerm(Id_t termId, StringSpan const &name) { out_->theoryTerm(termId, name); }
+
+void BackendDedup::theoryTerm(Id_t termId, int cId, IdSpan const &args) { out_->theoryTerm(termId, cId, args); }
+
+void BackendDedup::theoryElement(Id_t elementId, IdSpan const &terms, LitSpan const &cond) {
+    out_->theoryElement(elementId, terms, cond);
+}
+
+void BackendDedup::theoryAtom(Id_t atomOrZero, Id_t termId, IdSpan const &elements) {
+    out_->theoryAtom(atomOrZero, termId, elements);
+}
+
+void BackendDedup::theoryAtom(Id_t atomOrZero, Id_t termId, IdSpan const &elements, Id_t op, Id_t rhs) {
+    out_->theoryAtom(atomOrZero, termId, elements, op, rhs);
+}
+
+void BackendDedup::endStep() { out_->endStep(); }
+
+// }}}1
+
+} // namespace Output
+} // namespace Gringo
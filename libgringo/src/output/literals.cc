@@ -796,48 +796,55 @@ void HeadAggregateAtom::accumulate(DomainData &data, Location const &loc, SymVec
 
 // {{{1 definition of PredicateDomain
 
-std::pair<Id_t, Id_t> PredicateDomain::cleanup(AssignmentLookup assignment, Mapping &map) {
+std::pair<Id_t, Id_t> PredicateDomain::cleanup(AssignmentLookup assignment, Mapping &map, bool assignmentChanged) {
     Id_t facts = 0;
     Id_t deleted = 0;
+    // Atoms inspected by a previous cleanup are already defined, have
+    // generation zero, and are not marked delayed. They only have to be
+    // inspected again if their truth values might have changed.
+    SizeType start = assignmentChanged ? 0 : std::min(cleanOffset_, size());
+    map.addIdentity(start);
     // std::cerr << "cleaning " << sig_ << std::endl;
-    cleanup_([&](PredicateAtom &atom, Id_t oldOffset, Id_t newOffset) {
-        if (!atom.defined()) {
-            ++deleted;
-            return true;
-        }
-        if (atom.hasUid()) {
-            auto value = assignment(atom.uid());
-            if (!value.first) {
-                switch (value.second) {
-                    case Potassco::Value_t::True: {
-                        // NOTE: externals cannot become facts here
-                        //       because they might get new definitions while grounding
-                        //       because there is no distinction between true and weak true
-                        //       these definitions might be skipped if a weak true external
-                        //       is made a fact here
-                        if (!atom.fact()) {
-                            ++facts;
+    cleanup_(
+        [&](PredicateAtom &atom, Id_t oldOffset, Id_t newOffset) {
+            if (!atom.defined()) {
+                ++deleted;
+                return true;
+            }
+            if (atom.hasUid()) {
+                auto value = assignment(atom.uid());
+                if (!value.first) {
+                    switch (value.second) {
+                        case Potassco::Value_t::True: {
+                            // NOTE: externals cannot become facts here
+                            //       because they might get new definitions while grounding
+                            //       because there is no distinction between true and weak true
+                            //       these definitions might be skipped if a weak true external
+                            //       is made a fact here
+                            if (!atom.fact()) {
+                                ++facts;
+                            }
+                            atom.setFact(true);
+                            break;
+                        }
+                        case Potassco::Value_t::False: {
+                            ++deleted;
+                            return true;
+                        }
+                        default: {
+                            break;
                         }
-                        atom.setFact(true);
-                        break;
-                    }
-                    case Potassco::Value_t::False: {
-                        ++deleted;
-                        return true;
-                    }
-                    default: {
-                        break;
                     }
                 }
             }
-        }
-        // std::cerr << "  mapping " << static_cast<Symbol>(atom) << " from " << oldOffset << " to " << newOffset <<
-        // std::endl;
-        atom.setGeneration(0);
-        atom.unmarkDelayed();
-        map.add(oldOffset, newOffset);
-        return false;
-    });
+            // std::cerr << "  mapping " << static_cast<Symbol>(atom) << " from " << oldOffset << " to " << newOffset <<
+            // std::endl;
+            atom.setGeneration(0);
+            atom.unmarkDelayed();
+            map.add(oldOffset, newOffset);
+            return false;
+        },
+        start);
     // std::cerr << "remaining atoms: ";
     // for (auto &atom : atoms_) {
     //     std::cerr << "  " << static_cast<Symbol>(atom) << "=" << (atoms_.find(static_cast<Symbol>(atom)) !=
@@ -845,6 +852,7 @@ std::pair<Id_t, Id_t> PredicateDomain::cleanup(AssignmentLookup assignment, Mapp
     // }
     incOffset_ = size();
     showOffset_ = size();
+    cleanOffset_ = size();
     return {facts, deleted};
 }
 
@@ -1507,6 +1515,38 @@ std::pair<LiteralId, bool> HeadAggregateLiteral::delayedLit() {
 
 // {{{1 definition of DomainData
 
+namespace {
+
+void checkRange(Id_t offset, size_t size, Id_t total) {
+    if (offset > total || size > total - offset) {
+        throw std::runtime_error("range exceeds number of theory terms, elements, or atoms");
+    }
+}
+
+// Writes the offsets of the spans of the entries in the given range.
+template <class F> void fetchOffsets(Id_t offset, size_t size, size_t *offsets, F const &span) {
+    if (offsets != nullptr) {
+        *offsets = 0;
+        for (Id_t i = offset, e = offset + static_cast<Id_t>(size); i != e; ++i, ++offsets) {
+            offsets[1] = offsets[0] + span(i).size;
+        }
+    }
+}
+
+// Writes the concatenated spans of the entries in the given range.
+template <class F> void fetchSpans(Id_t offset, size_t size, Id_t *out, size_t capacity, F const &span) {
+    for (Id_t i = offset, e = offset + static_cast<Id_t>(size); i != e; ++i) {
+        auto ids = span(i);
+        if (ids.size > capacity) {
+            throw std::runtime_error("capacity too small");
+        }
+        out = std::copy(Potassco::begin(ids), Potassco::end(ids), out);
+        capacity -= ids.size;
+    }
+}
+
+} // namespace
+
 TheoryTermType DomainData::termType(Id_t value) const {
     auto const &term = theory_.data().getTerm(value);
     switch (term.type()) {
@@ -1580,6 +1620,87 @@ std::pair<char const *, Id_t> DomainData::atomGuard(Id_t value) const {
 
 Potassco::Id_t DomainData::numAtoms() const { return theory_.data().numAtoms(); }
 
+Potassco::Id_t DomainData::numTerms() const { return theory_.data().numTerms(); }
+
+Potassco::Id_t DomainData::numElems() const { return theory_.data().numElems(); }
+
+void DomainData::fetchTerms(Id_t offset, size_t size, int *types, int *values, size_t *argOffsets) const {
+    checkRange(offset, size, numTerms());
+    for (Id_t i = offset, e = offset + static_cast<Id_t>(size); i != e; ++i) {
+        auto type = termType(i);
+        if (types != nullptr) {
+            *types++ = static_cast<int>(type);
+        }
+        if (values != nullptr) {
+            auto const &term = theory_.data().getTerm(i);
+            switch (type) {
+                case TheoryTermType::Number: {
+                    *values++ = term.number();
+                    break;
+                }
+                case TheoryTermType::Function: {
+                    *values++ = static_cast<int>(term.function());
+                    break;
+                }
+                default: {
+                    *values++ = 0;
+                    break;
+                }
+            }
+        }
+    }
+    fetchOffsets(offset, size, argOffsets, [this](Id_t i) { return termArgs(i); });
+}
+
+void DomainData::fetchTermArgs(Id_t offset, size_t size, Id_t *args, size_t capacity) const {
+    checkRange(offset, size, numTerms());
+    fetchSpans(offset, size, args, capacity, [this](Id_t i) { return termArgs(i); });
+}
+
+void DomainData::fetchElems(Id_t offset, size_t size, Potassco::Lit_t *conds, size_t *tupleOffsets) const {
+    checkRange(offset, size, numElems());
+    if (conds != nullptr) {
+        for (Id_t i = offset, e = offset + static_cast<Id_t>(size); i != e; ++i) {
+            *conds++ = elemCondLit(i);
+        }
+    }
+    fetchOffsets(offset, size, tupleOffsets, [this](Id_t i) { return elemTuple(i); });
+}
+
+void DomainData::fetchElemTuples(Id_t offset, size_t size, Id_t *tuples, size_t capacity) const {
+    checkRange(offset, size, numElems());
+    fetchSpans(offset, size, tuples, capacity, [this](Id_t i) { return elemTuple(i); });
+}
+
+void DomainData::fetchAtoms(Id_t offset, size_t size, Potassco::Lit_t *lits, Id_t *terms, bool *hasGuard,
+                            Id_t *guardOps, Id_t *guardTerms, size_t *elemOffsets) const {
+    checkRange(offset, size, numAtoms());
+    for (Id_t i = offset, e = offset + static_cast<Id_t>(size); i != e; ++i) {
+        auto const &atom = theory_.getAtom(i);
+        if (lits != nullptr) {
+            *lits++ = static_cast<Potassco::Lit_t>(atom.atom());
+        }
+        if (terms != nullptr) {
+            *terms++ = atom.term();
+        }
+        if (hasGuard != nullptr) {
+            *hasGuard++ = atom.guard() != nullptr;
+        }
+        if (guardOps != nullptr) {
+            *guardOps++ = atom.guard() != nullptr ? *atom.guard() : 0;
+        }
+        if (guardTerms != nullptr) {
+            *guardTerms++ = atom.guard() != nullptr ? *atom.rhs() : 0;
+        }
+    }
+    fetchOffsets(offset, size, elemOffsets, [this](Id_t i) { return atomElems(i); });
+}
+
+void DomainData::fetchAtomElems(Id_t offset, size_t size, Id_t *elems, size_t capacity) const {
+    checkRange(offset, size, numAtoms());
+    fetchSpans(offset, size, elems, capacity, [this](Id_t i) { return atomElems(i); });
+}
+
 std::string DomainData::termStr(Id_t value) const {
     std::ostringstream oss;
     theory_.printTerm(oss, value);
@@ -1623,6 +1744,17 @@ std::string DomainData::atomStr(Id_t value) const {
     return oss.str();
 }
 
+size_t DomainData::memoryUsage() const {
+    size_t ret = clauses_.memoryUsage() + tuples_.memoryUsage() + formulas_.memoryUsage();
+    for (auto const &dom : predDomains_) {
+        ret += dom->memoryUsage();
+    }
+    for (auto const &dom : domains_) {
+        ret += dom->memoryUsage();
+    }
+    return ret;
+}
+
 // }}}1
 
 } // namespace Output
@@ -25,6 +25,8 @@
 #include "gringo/output/output.hh"
 #include "gringo/logger.hh"
 #include "gringo/output/backends.hh"
+#include "gringo/output/dedup.hh"
+#include "gringo/output/pipeline.hh"
 #include "reify/program.hh"
 #include <cstring>
 #include <stdexcept>
@@ -390,15 +392,16 @@ void BackendOutput::output(DomainData &data, Statement &stm) { stm.output(data,
 
 OutputBase::OutputBase(Potassco::TheoryData &data, OutputPredicates outPreds, std::ostream &out, OutputFormat format,
                        OutputOptions opts)
-    : outPreds(std::move(outPreds)), data(data), out_(fromFormat(out, format, opts)) {}
+    : outPreds(std::move(outPreds)), data(data), out_(fromFormat(out, format, opts, pipeline_, dedup_)) {}
 
 OutputBase::OutputBase(Potassco::TheoryData &data, OutputPredicates outPreds, UBackend out, OutputOptions opts)
-    : outPreds(std::move(outPreds)), data(data), out_(fromBackend(std::move(out), opts)) {}
+    : outPreds(std::move(outPreds)), data(data), out_(fromBackend(std::move(out), opts, dedup_)) {}
 
 OutputBase::OutputBase(Potassco::TheoryData &data, OutputPredicates outPreds, UAbstractOutput out)
     : outPreds(std::move(outPreds)), data(data), out_(std::move(out)) {}
 
-UAbstractOutput OutputBase::fromFormat(std::ostream &out, OutputFormat format, OutputOptions opts) {
+UAbstractOutput OutputBase::fromFormat(std::ostream &out, OutputFormat format, OutputOptions opts,
+                                       BackendPipeline *&pipeline, BackendDedup *&dedup) {
     if (format == OutputFormat::TEXT) {
         UAbstractOutput output;
         output = gringo_make_unique<TextOutput>("", out);
@@ -425,10 +428,20 @@ UAbstractOutput OutputBase::fromFormat(std::ostream &out, OutputFormat format, O
             throw std::logic_error("cannot happen");
         }
     }
-    return fromBackend(std::move(backend), opts);
+    if (opts.pipeline) {
+        auto pipe = gringo_make_unique<BackendPipeline>(std::move(backend));
+        pipeline = pipe.get();
+        backend = std::move(pipe);
+    }
+    return fromBackend(std::move(backend), opts, dedup);
 }
 
-UAbstractOutput OutputBase::fromBackend(UBackend out, OutputOptions opts) {
+UAbstractOutput OutputBase::fromBackend(UBackend out, OutputOptions opts, BackendDedup *&dedup) {
+    if (opts.dedupRules) {
+        auto filter = gringo_make_unique<BackendDedup>(std::move(out));
+        dedup = filter.get();
+        out = std::move(filter);
+    }
     UAbstractOutput output;
     output = gringo_make_unique<BackendOutput>(std::move(out));
     if (opts.debug == OutputDebug::TRANSLATE || opts.debug == OutputDebug::ALL) {
@@ -446,6 +459,9 @@ void OutputBase::init(bool incremental) {
 }
 
 void OutputBase::output(Statement &x) {
+    if (pipeline_ != nullptr && !pipeline_->active()) {
+        pipeline_->start();
+    }
     x.replaceDelayed(data, delayed_);
     out_->output(data, x);
 }
@@ -496,9 +512,11 @@ void OutputBase::endGround(Logger &log) {
     data.theory().output(bto);
 
     EndGroundStatement(outPreds, log).passTo(data, *out_);
+    flush_();
 }
 
 void OutputBase::endStep(Assumptions const &ass) {
+    flush_();
     if (ass.size > 0) {
         auto *b = backend();
         if (b != nullptr) {
@@ -509,6 +527,7 @@ void OutputBase::endStep(Assumptions const &ass) {
 }
 
 void OutputBase::reset(bool resetData) {
+    flush_();
     data.reset(resetData);
     translateLambda(data, *out_, [](DomainData &, Translator &x) { x.reset(); });
 }
@@ -526,6 +545,25 @@ void OutputBase::checkOutPreds(Logger &log) {
     }
 }
 
+size_t OutputBase::memoryUsage() const { return data.memoryUsage() + Symbol::memoryUsage(); }
+
+size_t OutputBase::dedupDropped() const { return dedup_ != nullptr ? dedup_->dropped() : 0; }
+
+size_t OutputBase::dedupMemoryUsage() const { return dedup_ != nullptr ? dedup_->memoryUsage() : 0; }
+
+void OutputBase::printLargestDomains(std::ostream &out, size_t n) const {
+    std::vector<std::pair<size_t, Sig>> doms;
+    for (auto const &dom : predDoms()) {
+        doms.emplace_back(dom->memoryUsage(), dom->sig());
+    }
+    n = std::min(n, doms.size());
+    std::partial_sort(doms.begin(), doms.begin() + n, doms.end(),
+                      [](auto const &a, auto const &b) { return a.first > b.first; });
+    for (auto it = doms.begin(), ie = doms.begin() + n; it != ie; ++it) {
+        out << "  " << it->second << ": " << (it->first >> 20U) << "MB\n";
+    }
+}
+
 SymVec OutputBase::atoms(unsigned atomset, IsTrueLookup lookup) const {
     SymVec atoms;
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
@@ -534,6 +572,14 @@ SymVec OutputBase::atoms(unsigned atomset, IsTrueLookup lookup) const {
     return atoms;
 }
 
+Translator::MinimizeStats OutputBase::minimizeStats() const {
+    Translator::MinimizeStats stats;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    translateLambda(const_cast<DomainData &>(data), *out_,
+                    [&stats](DomainData &, Translator &trans) { stats = trans.minimizeStats(); });
+    return stats;
+}
+
 std::pair<PredicateDomain::ConstIterator, PredicateDomain const *> OutputBase::find(Symbol val) const {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
     return const_cast<OutputBase *>(this)->find(val);
@@ -552,24 +598,37 @@ std::pair<PredicateDomain::Iterator, PredicateDomain *> OutputBase::find(Symbol
     return {PredicateDomain::Iterator(), nullptr};
 }
 
-std::pair<Id_t, Id_t> OutputBase::simplify(AssignmentLookup assignment) {
+std::pair<Id_t, Id_t> OutputBase::simplify(AssignmentLookup assignment, bool assignmentChanged) {
     Id_t facts = 0;
     Id_t deleted = 0;
     if (data.canSimplify()) {
         std::vector<Mapping> mappings;
         for (auto const &dom : data.predDoms()) {
             mappings.emplace_back();
-            auto ret = dom->cleanup(assignment, mappings.back());
+            auto ret = dom->cleanup(assignment, mappings.back(), assignmentChanged);
             facts += ret.first;
             deleted += ret.second;
         }
-        translateLambda(data, *out_,
-                        [&](DomainData &data, Translator &trans) { trans.simplify(data, mappings, assignment); });
+        // If no atoms have been deleted, the mappings are the identity and,
+        // unless the assignment changed, the literals in the tables are
+        // already simplified.
+        if (assignmentChanged || deleted > 0) {
+            translateLambda(data, *out_,
+                            [&](DomainData &data, Translator &trans) { trans.simplify(data, mappings, assignment); });
+        }
     }
     return {facts, deleted};
 }
 
+void OutputBase::flush_() {
+    if (pipeline_ != nullptr) {
+        pipeline_->flush();
+    }
+}
+
 Backend *OutputBase::backend() {
+    // direct access to the backend requires that all pending output has been written
+    flush_();
     Backend *backend = nullptr;
     backendLambda(data, *out_, [&backend](DomainData &, UBackend &out) { backend = out.get(); });
     return backend;
@@ -581,6 +640,11 @@ void OutputBase::removeMinimize() {
 namespace {} // namespace
 
 void OutputBase::registerObserver(UBackend prg, bool replace) {
+    flush_();
+    if (prg && replace) {
+        pipeline_ = nullptr;
+        dedup_ = nullptr;
+    }
     backendLambda(data, *out_, [&prg, replace](DomainData &, UBackend &out) {
         if (prg) {
             if (replace) {
@@ -0,0 +1,490 @@
+// {{{ MIT License
+
+// Copyright 2024 Roland Kaminski
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// }}}
+
+#include "gringo/output/pipeline.hh"
+#include <algorithm>
+#include <initializer_list>
+
+namespace Gringo {
+namespace Output {
+
+// {{{1 definition of BackendPipeline
+
+enum class BackendPipeline::Call : uint32_t {
+    InitProgram,
+    BeginStep,
+    Rule,
+    WeightRule,
+    Minimize,
+    Project,
+    OutputAtom,
+    OutputCondition,
+    External,
+    Assume,
+    Heuristic,
+    AcycEdge,
+    TheoryNumber,
+    TheoryString,
+    TheoryCompound,
+    TheoryElement,
+    TheoryAtom,
+    TheoryAtomGuard,
+    EndStep
+};
+
+namespace {
+
+// Reads back the calls serialized by the pipeline.
+class ChunkReader {
+  public:
+    ChunkReader(std::vector<uint32_t> const &chunk) : chunk_{chunk} {}
+
+    bool done() const { return pos_ == chunk_.size(); }
+    uint32_t word() { return chunk_[pos_++]; }
+    int num() { return static_cast<int>(word()); }
+    Symbol sym() {
+        uint64_t rep = word();
+        rep |= static_cast<uint64_t>(word()) << 32U;
+        return Symbol{rep};
+    }
+    template <class T, class F> Potassco::Span<T> span(std::vector<T> &buf, F read) {
+        buf.clear();
+        for (uint32_t i = 0, n = word(); i < n; ++i) {
+            buf.emplace_back(read());
+        }
+        return Potassco::toSpan(buf);
+    }
+    Potassco::AtomSpan atoms() {
+        return span(atoms_, [this]() { return word(); });
+    }
+    Potassco::IdSpan ids() {
+        return span(ids_, [this]() { return word(); });
+    }
+    Potassco::LitSpan lits() {
+        return span(lits_, [this]() { return num(); });
+    }
+    Potassco::WeightLitSpan wlits() {
+        return span(wlits_, [this]() {
+            auto lit = num();
+            return Potassco::WeightLit_t{lit, num()};
+        });
+    }
+    Potassco::StringSpan str() {
+        return span(str_, [this]() { return static_cast<char>(word()); });
+    }
+
+  private:
+    std::vector<uint32_t> const &chunk_;
+    size_t pos_ = 0;
+    std::vector<Potassco::Atom_t> atoms_;
+    std::vector<Potassco::Id_t> ids_;
+    std::vector<Potassco::Lit_t> lits_;
+    std::vector<Potassco::WeightLit_t> wlits_;
+    std::vector<char> str_;
+};
+
+} // namespace
+
+BackendPipeline::BackendPipeline(UBackend out, size_t chunkSize, size_t numChunks)
+    : out_{std::move(out)}, chunks_(std::max(numChunks, size_t{2})), chunkSize_{chunkSize} {
+    for (auto &chunk : chunks_) {
+        chunk.reserve(chunkSize_);
+    }
+}
+
+BackendPipeline::~BackendPipeline() noexcept {
+    if (thread_.joinable()) {
+        try {
+            flush();
+        } catch (...) {
+        }
+        {
+            std::lock_guard<std::mutex> lock{mut_};
+            stop_ = true;
+        }
+        cv_.notify_all();
+        thread_.join();
+    }
+}
+
+void BackendPipeline::start() {
+    if (!thread_.joinable()) {
+        thread_ = std::thread([this]() { run_(); });
+    }
+    active_ = true;
+}
+
+void BackendPipeline::flush() {
+    if (!active_) {
+        return;
+    }
+    publish_();
+    wait_([this]() { return consumed_.load(std::memory_order_acquire) == head_; });
+    active_ = false;
+    if (failed_.load(std::memory_order_acquire)) {
+        failed_ = false;
+        std::rethrow_exception(std::move(exc_));
+    }
+}
+
+void BackendPipeline::push_(Potassco::WeightLit_t const &wlit) {
+    push_(wlit.lit);
+    push_(wlit.weight);
+}
+
+void BackendPipeline::push_(Symbol sym) {
+    push_(static_cast<uint32_t>(sym.rep()));
+    push_(static_cast<uint32_t>(sym.rep() >> 32U));
+}
+
+template <class T> void BackendPipeline::push_(Potassco::Span<T> const &span) {
+    push_(static_cast<uint32_t>(span.size));
+    for (size_t i = 0; i < span.size; ++i) {
+        push_(span.first[i]); // NOLINT
+    }
+}
+
+template <class... Args> void BackendPipeline::call_(Call call, Args const &...args) {
+    push_(static_cast<uint32_t>(call));
+    static_cast<void>(std::initializer_list<int>{(push_(args), 0)...});
+    if (chunks_[head_ % chunks_.size()].size() >= chunkSize_) {
+        publish_();
+    }
+}
+
+template <class P> void BackendPipeline::wait_(P pred) {
+    if (!pred()) {
+        std::unique_lock<std::mutex> lock{mut_};
+        cv_.wait(lock, pred);
+    }
+}
+
+void BackendPipeline::publish_() {
+    if (chunks_[head_ % chunks_.size()].empty()) {
+        return;
+    }
+    // the next chunk has to be released by the consumer before it can be filled
+    wait_([this]() { return head_ + 1 - consumed_.load(std::memory_order_acquire) < chunks_.size(); });
+    ++head_;
+    {
+        std::lock_guard<std::mutex> lock{mut_};
+        published_.store(head_, std::memory_order_release);
+    }
+    cv_.notify_all();
+    chunks_[head_ % chunks_.size()].clear();
+    if (failed_.load(std::memory_order_acquire)) {
+        flush();
+    }
+}
+
+void BackendPipeline::run_() {
+    std::unique_lock<std::mutex> lock{mut_};
+    for (;;) {
+        auto tail = consumed_.load(std::memory_order_relaxed);
+        cv_.wait(lock, [&]() { return stop_ || published_.load(std::memory_order_acquire) != tail; });
+        if (published_.load(std::memory_order_acquire) == tail) {
+            return;
+        }
+        lock.unlock();
+        if (!failed_.load(std::memory_order_relaxed)) {
+            try {
+                replay_(chunks_[tail % chunks_.size()]);
+            } catch (...) {
+                exc_ = std::current_exception();
+                failed_.store(true, std::memory_order_release);
+            }
+        }
+        lock.lock();
+        consumed_.store(tail + 1, std::memory_order_release);
+        cv_.notify_all();
+    }
+}
+
+void BackendPipeline::replay_(Chunk const &chunk) {
+    ChunkReader in{chunk};
+    while (!in.done()) {
+        switch (static_cast<Call>(in.word())) {
+            case Call::InitProgram: {
+                out_->initProgram(in.word() != 0);
+                break;
+            }
+            case Call::BeginStep: {
+                out_->beginStep();
+                break;
+            }
+            case Call::Rule: {
+                auto ht = static_cast<Head_t>(in.word());
+                auto head = in.atoms();
+                out_->rule(ht, head, in.lits());
+                break;
+            }
+            case Call::WeightRule: {
+                auto ht = static_cast<Head_t>(in.word());
+                auto head = in.atoms();
+                auto bound = in.num();
+                out_->rule(ht, head, bound, in.wlits());
+                break;
+            }
+            case Call::Minimize: {
+                auto prio = in.num();
+                out_->minimize(prio, in.wlits());
+                break;
+            }
+            case Call::Project: {
+                out_->project(in.atoms());
+                break;
+            }
+            case Call::OutputAtom: {
+                auto sym = in.sym();
+                out_->output(sym, in.word());
+                break;
+            }
+            case Call::OutputCondition: {
+                auto sym = in.sym();
+                out_->output(sym, in.lits());
+                break;
+            }
+            case Call::External: {
+                auto atom = in.word();
+                out_->external(atom, static_cast<Value_t>(in.word()));
+                break;
+            }
+            case Call::Assume: {
+                out_->assume(in.lits());
+                break;
+            }
+            case Call::Heuristic: {
+                auto atom = in.word();
+                auto type = static_cast<Heuristic_t>(in.word());
+                auto bias = in.num();
+                auto prio = in.word();
+                out_->heuristic(atom, type, bias, prio, in.lits());
+                break;
+            }
+            case Call::AcycEdge: {
+                auto s = in.num();
+                auto t = in.num();
+                out_->acycEdge(s, t, in.lits());
+                break;
+            }
+            case Call::TheoryNumber: {
+                auto termId = in.word();
+                out_->theoryTerm(termId, in.num());
+                break;
+            }
+            case Call::TheoryString: {
+                auto termId = in.word();
+                out_->theoryTerm(termId, in.str());
+                break;
+            }
+            case Call::TheoryCompound: {
+                auto termId = in.word();
+                auto cId = in.num();
+                out_->theoryTerm(termId, cId, in.ids());
+                break;
+            }
+            case Call::TheoryElement: {
+                auto elementId = in.word();
+                auto terms = in.ids();
+                out_->theoryElement(elementId, terms, in.lits());
+                break;
+            }
+            case Call::TheoryAtom: {
+                auto atomOrZero = in.word();
+                auto termId = in.word();
+                out_->theoryAtom(atomOrZero, termId, in.ids());
+                break;
+            }
+            case Call::TheoryAtomGuard: {
+                auto atomOrZero = in.word();
+                auto termId = in.word();
+                auto elements = in.ids();
+                auto op = in.word();
+                out_->theoryAtom(atomOrZero, termId, elements, op, in.word());
+                break;
+            }
+            case Call::EndStep: {
+                out_->endStep();
+                break;
+            }
+        }
+    }
+}
+
+void BackendPipeline::initProgram(bool incremental) {
+    if (!active_) {
+        out_->initProgram(incremental);
+        return;
+    }
+    call_(Call::InitProgram, static_cast<uint32_t>(incremental));
+}
+
+void BackendPipeline::beginStep() {
+    if (!active_) {
+        out_->beginStep();
+        return;
+    }
+    call_(Call::BeginStep);
+}
+
+void BackendPipeline::rule(Head_t ht, AtomSpan const &head, LitSpan const &body) {
+    if (!active_) {
+        out_->rule(ht, head, body);
+        return;
+    }
+    call_(Call::Rule, static_cast<uint32_t>(ht), head, body);
+}
+
+void BackendPipeline::rule(Head_t ht, AtomSpan const &head, Weight_t bound, WeightLitSpan const &body) {
+    if (!active_) {
+        out_->rule(ht, head, bound, body);
+        return;
+    }
+    call_(Call::WeightRule, static_cast<uint32_t>(ht), head, bound, body);
+}
+
+void BackendPipeline::minimize(Weight_t prio, WeightLitSpan const &lits) {
+    if (!active_) {
+        out_->minimize(prio, lits);
+        return;
+    }
+    call_(Call::Minimize, prio, lits);
+}
+
+void BackendPipeline::project(AtomSpan const &atoms) {
+    if (!active_) {
+        out_->project(atoms);
+        return;
+    }
+    call_(Call::Project, atoms);
+}
+
+void BackendPipeline::output(Symbol sym, Atom_t atom) {
+    if (!active_) {
+        out_->output(sym, atom);
+        return;
+    }
+    call_(Call::OutputAtom, sym, atom);
+}
+
+void BackendPipeline::output(Symbol sym, LitSpan const &condition) {
+    if (!active_) {
+        out_->output(sym, condition);
+        return;
+    }
+    call_(Call::OutputCondition, sym, condition);
+}
+
+void BackendPipeline::external(Atom_t a, Value_t v) {
+    if (!active_) {
+        out_->external(a, v);
+        return;
+    }
+    call_(Call::External, a, static_cast<uint32_t>(v));
+}
+
+void BackendPipeline::assume(LitSpan const &lits) {
+    if (!active_) {
+        out_->assume(lits);
+        return;
+    }
+    call_(Call::Assume, lits);
+}
+
+void BackendPipeline::heuristic(Atom_t a, Heuristic_t t, int bias, unsigned prio, LitSpan const &condition) {
+    if (!active_) {
+        out_->heuristic(a, t, bias, prio, condition);
+        return;
+    }
+    call_(Call::Heuristic, a, static_cast<uint32_t>(t), bias, prio, condition);
+}
+
+void BackendPipeline::acycEdge(int s, int t, LitSpan const &condition) {
+    if (!active_) {
+        out_->acycEdge(s, t, condition);
+        return;
+    }
+    call_(Call::AcycEdge, s, t, condition);
+}
+
+void BackendPipeline::theoryTerm(Id_t termId, int number) {
+    if (!active_) {
+        out_->theoryTerm(termId, number);
+        return;
+    }
+    call_(Call::TheoryNumber, termId, number);
+}
+
+void BackendPipeline::theoryTerm(Id_t termId, StringSpan const &name) {
+    if (!active_) {
+        out_->theoryTerm(termId, name);
+        return;
+    }
+    call_(Call::TheoryString, termId, name);
+}
+
+void BackendPipeline::theoryTerm(Id_t termId, int cId, IdSpan const &args) {
+    if (!active_) {
+        out_->theoryTerm(termId, cId, args);
+        return;
+    }
+    call_(Call::TheoryCompound, termId, cId, args);
+}
+
+void BackendPipeline::theoryElement(Id_t elementId, IdSpan const &terms, LitSpan const &cond) {
+    if (!active_) {
+        out_->theoryElement(elementId, terms, cond);
+        return;
+    }
+    call_(Call::TheoryElement, elementId, terms, cond);
+}
+
+void BackendPipeline::theoryAtom(Id_t atomOrZero, Id_t termId, IdSpan const &elements) {
+    if (!active_) {
+        out_->theoryAtom(atomOrZero, termId, elements);
+        return;
+    }
+    call_(Call::TheoryAtom, atomOrZero, termId, elements);
+}
+
+void BackendPipeline::theoryAtom(Id_t atomOrZero, Id_t termId, IdSpan const &elements, Id_t op, Id_t rhs) {
+    if (!active_) {
+        out_->theoryAtom(atomOrZero, termId, elements, op, rhs);
+        return;
+    }
+    call_(Call::TheoryAtomGuard, atomOrZero, termId, elements, op, rhs);
+}
+
+void BackendPipeline::endStep() {
+    if (!active_) {
+        out_->endStep();
+        return;
+    }
+    call_(Call::EndStep);
+}
+
+// }}}1
+
+} // namespace Output
+} // namespace Gringo
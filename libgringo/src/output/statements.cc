@@ -416,6 +416,8 @@ void Translator::addMinimize(TupleId tuple, LiteralId cond) { minimize_.emplace_
 void Translator::removeMinimize() {
     minimize_.clear();
     tuples_.clear();
+    openTuples_.clear();
+    minimizeStats_.tuples = 0;
 }
 
 void Translator::translate(DomainData &data, OutputPredicates const &outPreds, Logger &log) {
@@ -510,6 +512,7 @@ void Translator::simplify(DomainData &data, Mappings &mappings, AssignmentLookup
     for (auto it = tuples_.begin(); it != tuples_.end();) {
         it.value() = call(data, it.value(), &Literal::simplify, mappings, assignment);
         if (it.value() == data.getTrueLit().negate()) {
+            openTuples_.unordered_erase(it.key());
             it = tuples_.unordered_erase(it);
         } else {
             ++it;
@@ -597,21 +600,53 @@ void Translator::translateMinimize(DomainData &data) {
                 condLits.emplace_back(it++->second);
             } while (it != iE && it->first == tuple);
             int weight(data.tuple(tuple).first->num());
-            // Note: extends the minimize constraint incrementally
             auto ret = tuples_.try_emplace(tuple);
-            if (!ret.second) {
-                lm.add(ret.first->second, -weight);
-                condLits.emplace_back(ret.first->second);
+            if (ret.second) {
+                LiteralId lit = getEqualClause(data, *this, data.clause(std::move(condLits)), false, false);
+                ret.first.value() = lit;
+                lm.add(lit, weight);
+                minimizeStats_.literals += 1;
+            } else {
+                extendMinimize(data, lm, ret.first.value(), tuple, condLits, weight);
             }
-            LiteralId lit = getEqualClause(data, *this, data.clause(std::move(condLits)), false, false);
-            ret.first.value() = lit;
-            lm.add(lit, weight);
         } while (it != iE && data.tuple(it->first)[1].num() == priority);
         out_->output(data, lm);
     }
+    minimizeStats_.tuples = tuples_.size();
     minimize_.clear();
 }
 
+void Translator::extendMinimize(DomainData &data, Minimize &lm, LiteralId &lit, TupleId tuple, LitVec const &cond,
+                                int weight) {
+    // Note: a tuple added in a previous step cannot get further conditions
+    // because its literal is already defined. On the first extension, the
+    // literal is replaced by an auxiliary atom in the minimize constraint.
+    // This atom is defined by the old literal, the new conditions, and an
+    // open external atom. Subsequent extensions only define the open atom
+    // adding a new one. This keeps the minimize constraint at a constant
+    // size per tuple.
+    LiteralId head;
+    auto ret = openTuples_.try_emplace(tuple);
+    if (ret.second) {
+        head = data.newAux();
+        Rule().addHead(head).addBody(lit).translate(data, *this);
+        lm.add(lit, -weight);
+        lm.add(head, weight);
+        minimizeStats_.literals += 2;
+        lit = head;
+    } else {
+        head = ret.first->second;
+    }
+    for (auto const &x : cond) {
+        Rule().addHead(head).addBody(x).translate(data, *this);
+    }
+    LiteralId open = data.newAux();
+    External(open, Potassco::Value_t::False).translate(data, *this);
+    Rule().addHead(head).addBody(open).translate(data, *this);
+    ret.first.value() = open;
+    minimizeStats_.extensions += 1;
+}
+
 void Translator::showTerm(DomainData &data, Symbol term, LitVec cond) {
     termOutput_.todo.try_emplace(term, Formula{}).first.value().emplace_back(data.clause(std::move(cond)));
 }
@@ -23,11 +23,14 @@
 // }}}
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <gringo/hash_set.hh>
 #include <gringo/symbol.hh>
-#include <iterator>
+#include <memory>
+#include <string>
 #include <mutex>
+#include <type_traits>
 
 #ifdef _MSC_VER
 #pragma warning(disable : 4200) // nonstandard extension used: zero-sized array in struct/union
@@ -92,6 +95,11 @@ template <class T> struct UniqueConstruct {
         return *set_.insert(T{std::forward<U>(x), hash}).first;
     }
 
+    static size_t memoryUsage() {
+        std::lock_guard<std::mutex> g(mutex_);
+        return hash_memory_usage(set_);
+    }
+
   private:
     static Set set_;          // NOLINT
     static std::mutex mutex_; // NOLINT
@@ -148,6 +156,137 @@ uint64_t encodeSig(String name, uint32_t arity, bool sign) {
                                       isign);
 }
 
+// {{{1 definition of FunStore
+
+// Stores function symbols grouped by arity in large blocks.
+//
+// Function symbols are never deleted once they have been interned. Hence,
+// they can be allocated contiguously, which avoids the per object overhead
+// of the general purpose allocator and keeps symbols of the same arity
+// close to each other in memory.
+//
+// Note: allocation is synchronized by the lock of the unique construction.
+class FunStore {
+  public:
+    FunStore() = default;
+    FunStore(FunStore const &other) = delete;
+    FunStore(FunStore &&other) noexcept = delete;
+    FunStore &operator=(FunStore const &other) = delete;
+    FunStore &operator=(FunStore &&other) noexcept = delete;
+    ~FunStore() noexcept {
+        for (auto *block : blocks_) {
+            ::operator delete(block);
+        }
+    }
+
+    static FunStore &instance() {
+        static FunStore store; // NOLINT
+        return store;
+    }
+
+    void *allocate(uint32_t arity, size_t size) {
+        if (pools_.size() <= arity) {
+            pools_.resize(arity + 1);
+        }
+        auto &pool = pools_[arity];
+        if (pool.free == 0) {
+            pool.free = std::max<size_t>(1, blockSize / size);
+            blocks_.emplace_back(::operator new(pool.free * size));
+            bytes_ += pool.free * size;
+            pool.next = static_cast<char *>(blocks_.back());
+        }
+        void *ret = pool.next;
+        pool.next += size; // NOLINT
+        --pool.free;
+        return ret;
+    }
+
+    size_t memoryUsage() const { return bytes_; }
+
+  private:
+    static constexpr size_t blockSize = 1U << 16U;
+    struct Pool {
+        char *next = nullptr;
+        size_t free = 0;
+    };
+    std::vector<Pool> pools_;
+    std::vector<void *> blocks_;
+    std::atomic<size_t> bytes_{0};
+};
+
+// {{{1 definition of RenderCache
+
+// Caches the textual representation of function and string symbols.
+//
+// Renderings are copied into large blocks that are never freed. Hence,
+// returned pointers stay valid for the lifetime of the program. To bound
+// memory consumption, no further renderings are cached once the limit has
+// been reached.
+class RenderCache {
+  public:
+    static constexpr size_t limit = 1U << 25U;
+
+    RenderCache() = default;
+    RenderCache(RenderCache const &other) = delete;
+    RenderCache(RenderCache &&other) noexcept = delete;
+    RenderCache &operator=(RenderCache const &other) = delete;
+    RenderCache &operator=(RenderCache &&other) noexcept = delete;
+    ~RenderCache() noexcept = default;
+
+    static RenderCache &instance() {
+        static RenderCache cache; // NOLINT
+        return cache;
+    }
+
+    // Returns the cached rendering or nullptr if there is none.
+    char const *find(uint64_t rep) {
+        std::lock_guard<std::mutex> g(mutex_);
+        auto it = map_.find(rep);
+        return it != map_.end() ? it->second : nullptr;
+    }
+
+    // Caches the given rendering and returns a stable pointer to it.
+    //
+    // Returns nullptr if the limit has been reached.
+    char const *insert(uint64_t rep, std::string const &str) {
+        std::lock_guard<std::mutex> g(mutex_);
+        auto it = map_.find(rep);
+        if (it != map_.end()) {
+            return it->second;
+        }
+        size_t size = str.size() + 1;
+        if (bytes_ + size > limit) {
+            return nullptr;
+        }
+        if (free_ < size) {
+            free_ = size < blockSize ? blockSize : size;
+            blocks_.emplace_back(new char[free_]); // NOLINT
+            bytes_ += free_;
+            next_ = blocks_.back().get();
+        }
+        char *ret = next_;
+        std::memcpy(ret, str.c_str(), size);
+        next_ += size; // NOLINT
+        free_ -= size;
+        map_.emplace(rep, ret);
+        return ret;
+    }
+
+    size_t memoryUsage() {
+        std::lock_guard<std::mutex> g(mutex_);
+        return bytes_ + hash_memory_usage(map_);
+    }
+
+  private:
+    static constexpr size_t blockSize = 1U << 16U;
+    hash_map<uint64_t, char const *> map_;
+    std::vector<std::unique_ptr<char[]>> blocks_; // NOLINT
+    char *next_ = nullptr;
+    size_t free_ = 0;
+    size_t bytes_ = 0;
+    std::mutex mutex_;
+};
+
 // {{{1 definition of Fun
 
 class Fun {
@@ -156,17 +295,14 @@ class Fun {
     Fun(Fun &&other) noexcept = delete;
     Fun &operator=(Fun const &other) = delete;
     Fun &operator=(Fun &&other) noexcept = delete;
+    ~Fun() noexcept = default;
 
     static Fun *make(Sig sig, SymSpan args, size_t hash) {
-        auto *mem = ::operator new(sizeof(Fun) + args.size * sizeof(Symbol));
+        static_assert(std::is_trivially_destructible<Fun>::value, "function symbols are never destroyed");
+        auto *mem = FunStore::instance().allocate(sig.arity(), sizeof(Fun) + args.size * sizeof(Symbol));
         return new (mem) Fun(sig, args, hash); // NOLINT
     }
 
-    void destroy() noexcept {
-        this->~Fun();
-        ::operator delete(this);
-    }
-
     Sig sig() const { return sig_; }
 
     SymSpan args() const { return {args_, sig().arity()}; }
@@ -174,8 +310,6 @@ class Fun {
     size_t hash() const { return hash_; }
 
   private:
-    ~Fun() noexcept = default;
-
     Fun(Sig sig, SymSpan args, size_t hash) noexcept : sig_(sig), hash_{hash} {
         std::memcpy(static_cast<void *>(args_), args.first, args.size * sizeof(Symbol));
     }
@@ -213,11 +347,8 @@ class MFun {
         std::swap(fun_, other.fun_);
         return *this;
     }
-    ~MFun() noexcept {
-        if (fun_ != nullptr) {
-            fun_->destroy();
-        }
-    }
+    // Note: the memory of the function symbol is owned by the FunStore.
+    ~MFun() noexcept = default;
 
     Fun const &as_fun() const { return *fun_; }
 
@@ -429,6 +560,11 @@ Symbol Symbol::createFun(String name, SymSpan args, bool sign) {
                : createId(name, sign);
 }
 
+size_t Symbol::memoryUsage() {
+    return UniqueConstruct<MFun>::memoryUsage() + FunStore::instance().memoryUsage() +
+           RenderCache::instance().memoryUsage();
+}
+
 // {{{2 inspection
 
 SymbolType Symbol::type() const {
@@ -604,6 +740,52 @@ bool less(Symbol const &a, Symbol const &b) {
     return false;
 }
 
+// {{{1 formatting
+
+// Appends the decimal representation of the given number.
+void appendNum(std::string &out, int32_t num) {
+    char buf[12];
+    char *end = buf + sizeof(buf);
+    char *pos = end;
+    // negate in unsigned arithmetic to handle the minimum value
+    auto val = static_cast<uint32_t>(num);
+    if (num < 0) {
+        val = 0U - val;
+    }
+    do {
+        *--pos = static_cast<char>('0' + val % 10);
+        val /= 10;
+    } while (val > 0);
+    if (num < 0) {
+        *--pos = '-';
+    }
+    out.append(pos, end);
+}
+
+// Appends the given string escaping special characters like quote().
+void appendQuoted(std::string &out, char const *str) {
+    for (; *str != '\0'; ++str) { // NOLINT
+        switch (*str) {
+            case '\n': {
+                out.append("\\n");
+                break;
+            }
+            case '\\': {
+                out.append("\\\\");
+                break;
+            }
+            case '"': {
+                out.append("\\\"");
+                break;
+            }
+            default: {
+                out.push_back(*str);
+                break;
+            }
+        }
+    }
+}
+
 } // namespace
 
 bool Symbol::operator==(Symbol const &other) const { return rep_ == other.rep_; }
@@ -621,51 +803,88 @@ bool Symbol::operator>=(Symbol const &other) const { return (*this == other) ||
 // {{{2 output
 
 void Symbol::print(std::ostream &out) const {
+    // symbols are first rendered into a buffer to avoid the overhead of
+    // formatting each token with the stream
+    thread_local std::string buf;
+    buf.clear();
+    print(buf);
+    out.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+}
+
+char const *Symbol::printCached() const {
+    auto type = symbolType_(rep_);
+    if (type == SymbolType_::IdP && name() != "") {
+        return name().c_str();
+    }
+    bool cache = type == SymbolType_::Fun || type == SymbolType_::Str;
+    if (cache) {
+        if (auto const *ret = RenderCache::instance().find(rep_)) {
+            return ret;
+        }
+    }
+    thread_local std::string buf;
+    buf.clear();
+    print(buf);
+    if (cache) {
+        if (auto const *ret = RenderCache::instance().insert(rep_, buf)) {
+            return ret;
+        }
+    }
+    return buf.c_str();
+}
+
+void Symbol::print(std::string &out) const {
     switch (symbolType_(rep_)) {
         case SymbolType_::Num: {
-            out << num();
+            appendNum(out, num());
             break;
         }
         case SymbolType_::IdN: {
-            out << "-";
+            out.push_back('-');
         }
         case SymbolType_::IdP: {
             char const *n = name().c_str();
-            out << (n[0] != '\0' ? n : "()"); // NOLINT
+            out.append(n[0] != '\0' ? n : "()"); // NOLINT
             break;
         }
         case SymbolType_::Str: {
-            out << '"' << quote(string().c_str()) << '"';
+            out.push_back('"');
+            appendQuoted(out, string().c_str());
+            out.push_back('"');
             break;
         }
         case SymbolType_::Inf: {
-            out << "#inf";
+            out.append("#inf");
             break;
         }
         case SymbolType_::Sup: {
-            out << "#sup";
+            out.append("#sup");
             break;
         }
         case SymbolType_::Fun: {
             auto s = sig();
             if (s.sign()) {
-                out << "-";
+                out.push_back('-');
             }
-            out << s.name();
+            out.append(s.name().c_str());
             auto a = args();
-            out << "(";
-            if (a.size > 0) {
-                std::copy(begin(a), end(a) - 1, std::ostream_iterator<Symbol>(out, ",")); // NOLINT
-                out << *(end(a) - 1);                                                     // NOLINT
+            out.push_back('(');
+            bool comma = false;
+            for (auto const &arg : a) {
+                if (comma) {
+                    out.push_back(',');
+                }
+                arg.print(out);
+                comma = true;
             }
             if (a.size == 1 && s.name() == "") {
-                out << ",";
+                out.push_back(',');
             }
-            out << ")";
+            out.push_back(')');
             break;
         }
         case SymbolType_::Special: {
-            out << "#special";
+            out.append("#special");
             break;
         }
     }
@@ -514,6 +514,13 @@ Sig GValTerm::sig() const { return val_.sig(); }
 
 GTerm::EvalResult GValTerm::eval() const { return {true, val_}; }
 
+GTerm::EvalResult GValTerm::evalArg(unsigned idx) const {
+    if (val_.type() == SymbolType::Fun && idx < val_.args().size) {
+        return {true, val_.args()[idx]};
+    }
+    return {false, Symbol()};
+}
+
 bool GValTerm::occurs(GRef &x) const { return false; }
 
 void GValTerm::reset() {}
@@ -554,6 +561,10 @@ Sig GFunctionTerm::sig() const { return {name_, numeric_cast<uint32_t>(args_.siz
 
 GTerm::EvalResult GFunctionTerm::eval() const { return {false, Symbol()}; }
 
+GTerm::EvalResult GFunctionTerm::evalArg(unsigned idx) const {
+    return idx < args_.size() ? args_[idx]->eval() : EvalResult{false, Symbol()};
+}
+
 bool GFunctionTerm::occurs(GRef &x) const {
     for (const auto &y : args_) {
         if (y->occurs(x)) {
@@ -629,6 +640,8 @@ Sig GLinearTerm::sig() const { throw std::logic_error("must not be called"); }
 
 GTerm::EvalResult GLinearTerm::eval() const { return {false, Symbol()}; }
 
+GTerm::EvalResult GLinearTerm::evalArg(unsigned idx) const { return {false, Symbol()}; }
+
 bool GLinearTerm::occurs(GRef &x) const { return ref_->occurs(x); }
 
 void GLinearTerm::reset() { ref_->reset(); }
@@ -687,6 +700,8 @@ Sig GVarTerm::sig() const { throw std::logic_error("must not be called"); }
 
 GTerm::EvalResult GVarTerm::eval() const { return {false, Symbol()}; }
 
+GTerm::EvalResult GVarTerm::evalArg(unsigned idx) const { return {false, Symbol()}; }
+
 bool GVarTerm::occurs(GRef &x) const { return ref->occurs(x); }
 
 void GVarTerm::reset() { ref->reset(); }
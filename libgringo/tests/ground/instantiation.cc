@@ -39,7 +39,8 @@ using namespace Gringo::IO;
 
 namespace {
 
-std::string ground(std::string const &str, std::initializer_list<std::string> filter = {""}) {
+std::string ground(std::string const &str, std::initializer_list<std::string> filter = {""},
+                   std::atomic<bool> const *interrupted = nullptr, size_t memoryLimit = 0) {
     std::regex delayedDef("^#delayed\\(([0-9]+)\\) <=> (.*)$");
     std::regex delayedOcc("#delayed\\(([0-9]+)\\)");
     std::map<std::string, std::string> delayedMap;
@@ -47,6 +48,7 @@ std::string ground(std::string const &str, std::initializer_list<std::string> fi
 
     Potassco::TheoryData td;
     Output::OutputBase out(td, {}, ss, Output::OutputFormat::TEXT);
+    out.memoryLimit = memoryLimit;
     Input::Program prg;
     Defines defs;
     Gringo::Test::TestGringoModule module;
@@ -62,7 +64,7 @@ std::string ground(std::string const &str, std::initializer_list<std::string> fi
     Parameters params;
     params.add("base", {});
     gPrg.prepare(params, out, module);
-    gPrg.ground(context, out, module);
+    gPrg.ground(context, out, module, interrupted);
     out.endStep({});
 
     std::string line;
@@ -1272,6 +1274,54 @@ TEST_CASE("ground-instantiation", "[ground]") {
     }
 
     SECTION("tuple") { REQUIRE("p(((),())).\n" == ground("p(((),())).\n")); }
+
+    SECTION("interrupt") {
+        std::atomic<bool> interrupted{false};
+        REQUIRE("p(1).\np(2).\n" == ground("p(1..2).\n", {""}, &interrupted));
+        interrupted = true;
+        REQUIRE_THROWS_AS(ground("p(1..2).\nq(X):-p(X).\n", {""}, &interrupted), std::runtime_error);
+    }
+
+    SECTION("pool") {
+        REQUIRE("p(1,a).\n"
+                "p(1,b).\n"
+                "p(2,a).\n"
+                "p(2,b).\n" == ground("q(1..2).p(X,Y):-q(X),Y=(a;b).", {"p("}));
+        REQUIRE("r(1,a).\n"
+                "r(1,b).\n"
+                "r(2,a).\n"
+                "r(2,b).\n" == ground("q.r((1;2),(a;b)):-q.", {"r("}));
+        REQUIRE("s(1).\n"
+                "s(3).\n" == ground("q(1;3).s(X):-q(X),not q((2;3)).", {"s("}));
+        REQUIRE("t(1).\n" == ground("q(1,a;2,b;3,c).t(X):-q(X,Y),q(1,a;2,c),Y<b.", {"t("}));
+    }
+
+    SECTION("range") {
+        REQUIRE("r(1,2).\n"
+                "r(1,3).\n"
+                "r(2,3).\n"
+                "r(2,4).\n"
+                "r(3,4).\n"
+                "r(3,5).\n"
+                "r(4,5).\n" == ground("p(1..5).q(1..5).r(X,Y):-p(X),q(Y),X<Y,Y<=X+2.", {"r("}));
+        REQUIRE("r(2).\n"
+                "r(3).\n" == ground("p(1..5).r(X):-p(X),1<X,4>X.", {"r("}));
+        REQUIRE("r(1).\n" == ground("p(a).p(1).p(f(1)).p(\"1\").r(X):-p(X),X<2.", {"r("}));
+        REQUIRE("a(1).\n"
+                "a(2).\n"
+                "a(3).\n"
+                "a(4).\n" == ground("b(1..4).a(1).a(Y):-a(X),b(Y),Y>X.", {"a("}));
+        REQUIRE("a(1).\n"
+                "a(3).\n"
+                "a(5).\n" == ground("b(1..6).a(1).a(Y):-a(X),b(Y),X+1<Y,Y<=X+2.", {"a("}));
+    }
+
+    SECTION("memory limit") {
+        REQUIRE("p(1).\np(2).\n" == ground("p(1..2).\n", {""}, nullptr, 1));
+        REQUIRE_THROWS_AS(ground("p(1..100000).\n", {""}, nullptr, 1), std::runtime_error);
+        // each round only instantiates a few steps
+        REQUIRE_THROWS_AS(ground("p(1).\np(X+1):-p(X),X<10000.\n", {""}, nullptr, 1), std::runtime_error);
+    }
 }
 
 } // namespace Test
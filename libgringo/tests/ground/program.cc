@@ -41,7 +41,7 @@ namespace {
 
 typedef std::string S;
 
-Program parse(std::string const &str) {
+Program parse(std::string const &str, std::function<bool(Sig)> const &demand = nullptr) {
     Gringo::Test::TestGringoModule module;
     std::ostringstream oss;
     Potassco::TheoryData td;
@@ -56,7 +56,7 @@ Program parse(std::string const &str) {
     ngp.pushStream("-", gringo_make_unique<std::stringstream>(str), module.logger);
     ngp.parse(module.logger);
     prg.rewrite(defs, module.logger);
-    return prg.toGround({Sig{"base", 0, false}}, out.data, module.logger);
+    return prg.toGround({Sig{"base", 0, false}}, out.data, module.logger, demand);
 }
 
 std::string toString(Program const &p) {
@@ -207,6 +207,22 @@ TEST_CASE("ground-program", "[ground]") {
                 "% component\n"
                 "b:-x,a!,not a!." == toString(parse("x:-x.a:-not b.b:-not a,a,x.")));
     }
+
+    SECTION("demand") {
+        auto demand = [](Sig sig) { return sig == Sig{"a", 1, false}; };
+        auto str = toString(parse("a(X):-b(X).c(X):-b(X).f(X):-c(X),not g(X).g(X):-h(X).d:-not e.e:-not d.:-c(1).",
+                                  demand));
+        // needed to derive shown atoms
+        REQUIRE(str.find("a(X):-b(X).") != std::string::npos);
+        // needed by the integrity constraint
+        REQUIRE(str.find("c(X):-b(X).") != std::string::npos);
+        // unstratified
+        REQUIRE(str.find("d:-") != std::string::npos);
+        REQUIRE(str.find("e:-") != std::string::npos);
+        // stratified and not needed
+        REQUIRE(str.find("f(X)") == std::string::npos);
+        REQUIRE(str.find("g(X):-") == std::string::npos);
+    }
 }
 
 } // namespace Test
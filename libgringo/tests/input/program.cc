@@ -93,7 +93,11 @@ TEST_CASE("input-program", "[input]") {
     SECTION("rewrite") {
         REQUIRE("p(1):-q.p(2):-q.p(3):-q.p:-q." == rewrite(parse("p(1;2;3;):-q.")));
         REQUIRE("p:-q(1).p:-q(2).p:-q(3).p:-q." == rewrite(parse("p:-q(1;2;3;).")));
-        REQUIRE("p(1):-q(3).p(2):-q(3).p(1):-q(4).p(2):-q(4)." == rewrite(parse("p(1;2):-q(3;4).")));
+        REQUIRE("p(#Pool0):-#pool(#Pool1,(3;4));#pool(#Pool0,(1;2));q(#Pool1)." ==
+                rewrite(parse("p(1;2):-q(3;4).")));
+        REQUIRE("p(#Pool0,#Pool1):-#pool(#Pool1,(a;b));#pool(#Pool0,(1;2));q." ==
+                rewrite(parse("p((1;2),(a;b)):-q.")));
+        REQUIRE("p(X):-q(X,X).p(X):-q(X,1)." == rewrite(parse("p(X):-q(X,(X;1)).")));
         REQUIRE("p((X+Y)):-q(#Arith0);#Arith0=(X+Y)." == rewrite(parse("p(X+Y):-q(X+Y).")));
         REQUIRE("#Arith0<=#count{(X+Y):q((X+Y)):r(#Arith0),s(#Arith1),#Arith1=(A+B)}:-t(#Arith0);#Arith0=(X+Y);1<=#"
                 "count{(X+Y):u(#Arith0),v(#Arith2),#Arith2=(A+B)}." ==
@@ -132,8 +136,9 @@ TEST_CASE("input-program", "[input]") {
                 "#void:-#range(#Range0,1,0);#range(#Range0,1,2);q;(#Range0+0)>=3." == rewrite(parse("1<1..2<3:-q.")));
         REQUIRE("#void:-#range(#Range0,2,2);#range(#Range0,1,2);q;1<(#Range0+0);(#Range0+0)<3." ==
                 rewrite(parse("not 1<1..2<3:-q.")));
-        REQUIRE("#void:-1>=2;q.#void:-2>=4;q.#void:-1>=3;q.#void:-3>=4;q." == rewrite(parse("1<(2;3)<4:-q.")));
-        REQUIRE("#void:-2<4;1<2;q.#void:-3<4;1<3;q." == rewrite(parse("not 1<(2;3)<4:-q.")));
+        REQUIRE("#void:-#pool(#Pool0,(2;3));q;1>=#Pool0.#void:-#pool(#Pool0,(2;3));q;#Pool0>=4." ==
+                rewrite(parse("1<(2;3)<4:-q.")));
+        REQUIRE("#void:-#pool(#Pool0,(2;3));q;1<#Pool0;#Pool0<4." == rewrite(parse("not 1<(2;3)<4:-q.")));
         // body
         REQUIRE("q:-2<3;1<2." == rewrite(parse("q :- 1<2<3.")));
         REQUIRE("q:-1>=2."
@@ -142,12 +147,9 @@ TEST_CASE("input-program", "[input]") {
                 rewrite(parse("q :- 1<1..2<3.")));
         REQUIRE("q:-#range(#Range0,1,1);#range(#Range0,1,2);1>=(#Range0+0)."
                 "q:-#range(#Range0,1,0);#range(#Range0,1,2);(#Range0+0)>=3." == rewrite(parse("q :- not 1<1..2<3.")));
-        REQUIRE("q:-2<4;1<2."
-                "q:-3<4;1<3." == rewrite(parse("q :- 1<(2;3)<4.")));
-        REQUIRE("q:-1>=2."
-                "q:-2>=4."
-                "q:-1>=3."
-                "q:-3>=4." == rewrite(parse("q :- not 1<(2;3)<4.")));
+        REQUIRE("q:-#pool(#Pool0,(2;3));1<#Pool0;#Pool0<4." == rewrite(parse("q :- 1<(2;3)<4.")));
+        REQUIRE("q:-#pool(#Pool0,(2;3));1>=#Pool0."
+                "q:-#pool(#Pool0,(2;3));#Pool0>=4." == rewrite(parse("q :- not 1<(2;3)<4.")));
         // disjunctions
         REQUIRE("#void:1>=2&#void:2>=3:;"
                 "#void:4>=5&#void:5>=6::-q." == rewrite(parse("1<2<3|4<5<6:-q.")));
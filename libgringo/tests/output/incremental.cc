@@ -36,11 +36,11 @@ using namespace Gringo::Test;
 
 namespace {
 
-std::string iground(std::string in, int last = 3) {
+std::string iground(std::string in, int last = 3, OutputOptions opts = {}) {
     std::stringstream ss;
     Gringo::Test::TestGringoModule module;
     Potassco::TheoryData td;
-    Output::OutputBase out(td, {}, ss, OutputFormat::INTERMEDIATE);
+    Output::OutputBase out(td, {}, ss, OutputFormat::INTERMEDIATE, opts);
     Input::Program prg;
     Defines defs;
     Gringo::Test::TestContext context;
@@ -245,6 +245,67 @@ TEST_CASE("output-incremental", "[output]") {
         REQUIRE(Id_t(3) == m.get(5));
         REQUIRE(InvalidId == m.get(6));
     }
+
+    SECTION("pipeline") {
+        std::string prg = "#program base."
+                          "{p(0,0)}."
+                          "#theory t { t { }; &a/0 : t, any }."
+                          "#program step(k)."
+                          "{p(k,k)} :- p(_,k-1)."
+                          "&a { k : p(k,k) }."
+                          "#program last."
+                          "{r(X)} :- p(_,X)."
+                          ":~ r(X). [X]";
+        OutputOptions opts;
+        opts.pipeline = true;
+        REQUIRE(iground(prg) == iground(prg, 3, opts));
+        REQUIRE(iground(prg, 20) == iground(prg, 20, opts));
+    }
+    SECTION("dedup") {
+        auto rules = [](std::string const &out) {
+            size_t n = 0;
+            std::istringstream iss(out);
+            for (std::string line; std::getline(iss, line);) {
+                n += line.compare(0, 6, "1 0 1 ") == 0 ? 1 : 0;
+            }
+            return n;
+        };
+        std::string prg = "#program base."
+                          "{a;b}."
+                          "c :- a, b."
+                          "c :- b, a."
+                          "c :- a, b, a.";
+        OutputOptions opts;
+        opts.dedupRules = true;
+        REQUIRE(rules(iground(prg)) == 3);
+        REQUIRE(rules(iground(prg, 3, opts)) == 1);
+        opts.pipeline = true;
+        REQUIRE(rules(iground(prg, 3, opts)) == 1);
+    }
+    SECTION("minimize") {
+        // counts the weighted literals of minimize statements
+        auto literals = [](std::string const &out) {
+            size_t n = 0;
+            std::istringstream iss(out);
+            for (std::string line; std::getline(iss, line);) {
+                if (line.compare(0, 2, "2 ") == 0) {
+                    std::istringstream ils(line);
+                    size_t type = 0;
+                    int prio = 0;
+                    size_t size = 0;
+                    ils >> type >> prio >> size;
+                    n += size;
+                }
+            }
+            return n;
+        };
+        std::string prg = "#program step(k)."
+                          "{b(k)}."
+                          ":~ b(k). [1,x]";
+        REQUIRE(literals(iground(prg, 2)) == 1);
+        REQUIRE(literals(iground(prg, 5)) == 3);
+        REQUIRE(literals(iground(prg, 20)) == 3);
+    }
 }
 
 } // namespace Test
@@ -36,6 +36,22 @@ TEST_CASE("symbol_bug", "[base]") {
         auto b = Symbol::createId(std::string{"x"}.c_str());
         REQUIRE(a == b);
     }
+    SECTION("store") {
+        // function symbols are allocated in blocks per arity
+        SymVec funs;
+        for (int i = 0; i < 100000; ++i) {
+            SymVec args(static_cast<size_t>(i % 5), Symbol::createNum(i));
+            funs.emplace_back(Symbol::createFun("f", Potassco::toSpan(args), false));
+        }
+        for (int i = 0; i < 100000; ++i) {
+            SymVec args(static_cast<size_t>(i % 5), Symbol::createNum(i));
+            auto fun = Symbol::createFun("f", Potassco::toSpan(args), false);
+            REQUIRE(fun == funs[i]);
+            REQUIRE(fun.args().size == args.size());
+            REQUIRE(std::equal(begin(args), end(args), begin(fun.args())));
+        }
+        REQUIRE(Symbol::memoryUsage() > 100000 * sizeof(Symbol));
+    }
 }
 
 TEST_CASE("symbol", "[base]") {
@@ -197,6 +213,25 @@ TEST_CASE("symbol", "[base]") {
 
         std::string comp = toString(Symbol::createFun("g", SymSpan{symbols.data() + 2, symbols.size() - 2}));
         REQUIRE("g(0,42,x,abc,\"\",\"xyz\",#inf,#sup,(42,a),f(42,a))" == comp);
+
+        REQUIRE("-2147483648" == toString(symbols[0]));
+        REQUIRE("2147483647" == toString(symbols[1]));
+        REQUIRE("-7" == toString(Symbol::createNum(-7)));
+        REQUIRE("(0,)" == toString(Symbol::createTuple(SymSpan{symbols.data() + 2, 1})));
+
+        for (auto const &sym : symbols) {
+            std::string str = toString(sym);
+            REQUIRE(str == sym.printCached());
+            REQUIRE(str == sym.printCached());
+        }
+        REQUIRE(std::string{"()"} == Symbol::createTuple(SymSpan{nullptr, 0}).printCached());
+        REQUIRE(comp == Symbol::createFun("g", SymSpan{symbols.data() + 2, symbols.size() - 2}).printCached());
+        REQUIRE("\"a\\\"b\\\\c\\n\"" == toString(Symbol::createStr("a\"b\\c\n")));
+
+        std::string str;
+        symbols[11].print(str);
+        symbols[3].print(str);
+        REQUIRE("f(42,a)42" == str);
     }
 
     SECTION("sig") {
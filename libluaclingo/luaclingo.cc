@@ -1301,6 +1301,48 @@ struct SymbolicAtoms : Object<SymbolicAtoms> {
         return 1;
     }
 
+    static int find_pattern(lua_State *L) {
+        auto &self = get_self(L);
+        char const *name = luaL_checkstring(L, 2);
+        int arity = numeric_cast<int>(luaL_checkinteger(L, 3));
+        luaL_checktype(L, 4, LUA_TTABLE);
+        bool positive = lua_isnone(L, 5) || lua_toboolean(L, 5);
+        clingo_signature_t sig = call_c(L, clingo_signature_create, name, arity, positive);
+        size_t size = 0;
+        lua_pushnil(L); // +1
+        while (lua_next(L, 4) != 0) {
+            ++size;
+            lua_pop(L, 1); // -1
+        }
+        auto *positions = static_cast<size_t *>(lua_newuserdata(L, sizeof(*positions) * size)); // +1
+        auto *values = static_cast<clingo_symbol_t *>(lua_newuserdata(L, sizeof(*values) * size)); // +1
+        size_t i = 0;
+        lua_pushnil(L); // +1
+        while (lua_next(L, 4) != 0) {
+            auto pos = luaL_checkinteger(L, -2);
+            if (pos < 1) {
+                return luaL_error(L, "invalid argument position: %d", static_cast<int>(pos));
+            }
+            positions[i] = static_cast<size_t>(pos - 1);
+            values[i] = luaToVal(L, -1);
+            ++i;
+            lua_pop(L, 1); // -1
+        }
+        auto n = call_c(L, clingo_symbolic_atoms_find_pattern, self.atoms, sig, positions, values, size, nullptr, 0);
+        auto *iterators =
+            static_cast<clingo_symbolic_atom_iterator_t *>(lua_newuserdata(L, sizeof(*iterators) * n)); // +1
+        handle_c_error(L,
+                       clingo_symbolic_atoms_find_pattern(self.atoms, sig, positions, values, size, iterators, n, &n));
+        lua_createtable(L, numeric_cast<int>(n), 0); // +1
+        for (size_t j = 0; j < n; ++j) {
+            SymbolicAtom::new_(L, self.atoms, iterators[j]); // +1
+            lua_rawseti(L, -2, numeric_cast<int>(j + 1));   // -1
+        }
+        lua_replace(L, -4); // -1
+        lua_pop(L, 2);      // -2
+        return 1;
+    }
+
     static int signatures(lua_State *L) {
         auto &self = get_self(L);
         auto size = call_c(L, clingo_symbolic_atoms_signatures_size, self.atoms);
@@ -1337,7 +1379,12 @@ struct SymbolicAtoms : Object<SymbolicAtoms> {
 constexpr const char *SymbolicAtoms::typeName;
 
 luaL_Reg const SymbolicAtoms::meta[] = {
-    {"__len", len}, {"iter", iter}, {"lookup", lookup}, {"by_signature", by_signature}, {nullptr, nullptr}};
+    {"__len", len},
+    {"iter", iter},
+    {"lookup", lookup},
+    {"by_signature", by_signature},
+    {"find_pattern", find_pattern},
+    {nullptr, nullptr}};
 
 // {{{1 wrap SolveControl
 
@@ -2519,6 +2566,39 @@ struct PropagateInit : Object<PropagateInit> {
         return 1;
     }
 
+    // converts the array at the given index into a vector of literals
+    static std::vector<clingo_literal_t> *checkLits(lua_State *L, int idx) {
+        idx = lua_absindex(L, idx);
+        luaL_checktype(L, idx, LUA_TTABLE);
+        auto *lits = AnyWrap::new_<std::vector<clingo_literal_t>>(L); // +1
+        for (int i = 1;; ++i) {
+            lua_rawgeti(L, idx, i); // +1
+            if (lua_isnil(L, -1)) {
+                lua_pop(L, 1); // -1
+                break;
+            }
+            auto lit = numeric_cast<clingo_literal_t>(luaL_checkinteger(L, -1));
+            lua_pop(L, 1); // -1
+            protect(L, [lits, lit]() { lits->push_back(lit); });
+        }
+        return lits;
+    }
+
+    static int mapLits(lua_State *L) {
+        auto &self = get_self(L);
+        auto *lits = checkLits(L, 2); // +1
+        auto *ret = AnyWrap::new_<std::vector<clingo_literal_t>>(L); // +1
+        protect(L, [lits, ret]() { ret->resize(lits->size()); });
+        handle_c_error(L, clingo_propagate_init_solver_literals(self.init, lits->data(), lits->size(), ret->data()));
+        lua_createtable(L, numeric_cast<int>(ret->size()), 0); // +1
+        int i = 1;
+        for (auto lit : *ret) {
+            lua_pushinteger(L, lit);
+            lua_rawseti(L, -2, i++);
+        }
+        return 1;
+    }
+
     static int numThreads(lua_State *L) {
         auto &self = get_self(L);
         lua_pushinteger(L, clingo_propagate_init_number_of_threads(self.init));
@@ -2536,6 +2616,19 @@ struct PropagateInit : Object<PropagateInit> {
         return 0;
     }
 
+    static int addWatches(lua_State *L) {
+        auto &self = get_self(L);
+        auto *lits = checkLits(L, 2); // +1
+        if (lua_isnone(L, 3) || lua_isnil(L, 3)) {
+            handle_c_error(L, clingo_propagate_init_add_watches(self.init, lits->data(), lits->size()));
+        } else {
+            auto thread_id = numeric_cast<uint32_t>(luaL_checkinteger(L, 3));
+            handle_c_error(L, clingo_propagate_init_add_watches_to_thread(self.init, lits->data(), lits->size(),
+                                                                          thread_id - 1));
+        }
+        return 0;
+    }
+
     static int addLiteral(lua_State *L) {
         auto &self = get_self(L);
         bool freeze = lua_isnoneornil(L, 1) || lua_toboolean(L, 1);
@@ -2665,7 +2758,9 @@ struct PropagateInit : Object<PropagateInit> {
 
 constexpr char const *PropagateInit::typeName;
 luaL_Reg const PropagateInit::meta[] = {{"solver_literal", mapLit},
+                                        {"solver_literals", mapLits},
                                         {"add_watch", addWatch},
+                                        {"add_watches", addWatches},
                                         {"add_literal", addLiteral},
                                         {"add_clause", addClause},
                                         {"add_weight_constraint", addWeightConstraint},
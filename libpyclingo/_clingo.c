@@ -1320,14 +1320,14 @@ static void *_cffi_types[] = {
 /*  3 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28), // size_t
 /*  4 */ _CFFI_OP(_CFFI_OP_POINTER, 12), // int32_t const *
 /*  5 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/*  6 */ _CFFI_OP(_CFFI_OP_POINTER, 1334), // void *
+/*  6 */ _CFFI_OP(_CFFI_OP_POINTER, 1467), // void *
 /*  7 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
 /*  8 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(_Bool, uint32_t const *, size_t, int32_t, clingo_weighted_literal_t const *, size_t, void *)
 /*  9 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 1),
 /* 10 */ _CFFI_OP(_CFFI_OP_NOOP, 2),
 /* 11 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
 /* 12 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21), // int32_t
-/* 13 */ _CFFI_OP(_CFFI_OP_POINTER, 1295), // clingo_weighted_literal_t const *
+/* 13 */ _CFFI_OP(_CFFI_OP_POINTER, 1428), // clingo_weighted_literal_t const *
 /* 14 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
 /* 15 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
 /* 16 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
@@ -1340,8 +1340,8 @@ static void *_cffi_types[] = {
 /* 23 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
 /* 24 */ _CFFI_OP(_CFFI_OP_POINTER, 252), // _Bool(*)(clingo_ast_t *, void *)
 /* 25 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 26 */ _CFFI_OP(_CFFI_OP_POINTER, 1279), // clingo_control_t *
-/* 27 */ _CFFI_OP(_CFFI_OP_POINTER, 1217), // void(*)(int, char const *, void *)
+/* 26 */ _CFFI_OP(_CFFI_OP_POINTER, 1407), // clingo_control_t *
+/* 27 */ _CFFI_OP(_CFFI_OP_POINTER, 1340), // void(*)(int, char const *, void *)
 /* 28 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
 /* 29 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 8), // unsigned int
 /* 30 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
@@ -1354,7 +1354,7 @@ static void *_cffi_types[] = {
 /* 37 */ _CFFI_OP(_CFFI_OP_POINTER, 26), // clingo_control_t * *
 /* 38 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
 /* 39 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(char const *, _Bool *, void *)
-/* 40 */ _CFFI_OP(_CFFI_OP_POINTER, 1267), // char const *
+/* 40 */ _CFFI_OP(_CFFI_OP_POINTER, 1395), // char const *
 /* 41 */ _CFFI_OP(_CFFI_OP_POINTER, 1), // _Bool *
 /* 42 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
 /* 43 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
@@ -1378,7 +1378,7 @@ static void *_cffi_types[] = {
 /* 61 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
 /* 62 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(char const *, clingo_script_t const *, void *)
 /* 63 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 64 */ _CFFI_OP(_CFFI_OP_POINTER, 1289), // clingo_script_t const *
+/* 64 */ _CFFI_OP(_CFFI_OP_POINTER, 1420), // clingo_script_t const *
 /* 65 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
 /* 66 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
 /* 67 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(char const *, uint32_t, _Bool, uint64_t *)
@@ -1410,7 +1410,7 @@ static void *_cffi_types[] = {
 /* 93 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
 /* 94 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
 /* 95 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_assignment_t const *)
-/* 96 */ _CFFI_OP(_CFFI_OP_POINTER, 1269), // clingo_assignment_t const *
+/* 96 */ _CFFI_OP(_CFFI_OP_POINTER, 1397), // clingo_assignment_t const *
 /* 97 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
 /* 98 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_assignment_t const *, int32_t)
 /* 99 */ _CFFI_OP(_CFFI_OP_NOOP, 96),
@@ -1451,8 +1451,8 @@ static void *_cffi_types[] = {
 /* 134 */ _CFFI_OP(_CFFI_OP_NOOP, 115),
 /* 135 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
 /* 136 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_ast_t *, char *, size_t)
-/* 137 */ _CFFI_OP(_CFFI_OP_POINTER, 1276), // clingo_ast_t *
-/* 138 */ _CFFI_OP(_CFFI_OP_POINTER, 1267), // char *
+/* 137 */ _CFFI_OP(_CFFI_OP_POINTER, 1404), // clingo_ast_t *
+/* 138 */ _CFFI_OP(_CFFI_OP_POINTER, 1395), // char *
 /* 139 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
 /* 140 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
 /* 141 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_ast_t *, clingo_ast_t * *)
@@ -1501,12 +1501,12 @@ static void *_cffi_types[] = {
 /* 184 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_ast_t *, int, clingo_location_t *)
 /* 185 */ _CFFI_OP(_CFFI_OP_NOOP, 137),
 /* 186 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 187 */ _CFFI_OP(_CFFI_OP_POINTER, 1281), // clingo_location_t *
+/* 187 */ _CFFI_OP(_CFFI_OP_POINTER, 1410), // clingo_location_t *
 /* 188 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
 /* 189 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_ast_t *, int, clingo_location_t const *)
 /* 190 */ _CFFI_OP(_CFFI_OP_NOOP, 137),
 /* 191 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 192 */ _CFFI_OP(_CFFI_OP_POINTER, 1281), // clingo_location_t const *
+/* 192 */ _CFFI_OP(_CFFI_OP_POINTER, 1410), // clingo_location_t const *
 /* 193 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
 /* 194 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_ast_t *, int, int *)
 /* 195 */ _CFFI_OP(_CFFI_OP_NOOP, 137),
@@ -1571,11 +1571,11 @@ static void *_cffi_types[] = {
 /* 254 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
 /* 255 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
 /* 256 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_ast_t const *, void *)
-/* 257 */ _CFFI_OP(_CFFI_OP_POINTER, 1276), // clingo_ast_t const *
+/* 257 */ _CFFI_OP(_CFFI_OP_POINTER, 1404), // clingo_ast_t const *
 /* 258 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
 /* 259 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
 /* 260 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_backend_t *)
-/* 261 */ _CFFI_OP(_CFFI_OP_POINTER, 1277), // clingo_backend_t *
+/* 261 */ _CFFI_OP(_CFFI_OP_POINTER, 1405), // clingo_backend_t *
 /* 262 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
 /* 263 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_backend_t *, _Bool, uint32_t const *, size_t, int32_t const *, size_t)
 /* 264 */ _CFFI_OP(_CFFI_OP_NOOP, 261),
@@ -1692,12 +1692,12 @@ static void *_cffi_types[] = {
 /* 375 */ _CFFI_OP(_CFFI_OP_NOOP, 115),
 /* 376 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
 /* 377 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_configuration_t *, uint32_t, char const *)
-/* 378 */ _CFFI_OP(_CFFI_OP_POINTER, 1278), // clingo_configuration_t *
+/* 378 */ _CFFI_OP(_CFFI_OP_POINTER, 1406), // clingo_configuration_t *
 /* 379 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
 /* 380 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
 /* 381 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
 /* 382 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_configuration_t const *, uint32_t *)
-/* 383 */ _CFFI_OP(_CFFI_OP_POINTER, 1278), // clingo_configuration_t const *
+/* 383 */ _CFFI_OP(_CFFI_OP_POINTER, 1406), // clingo_configuration_t const *
 /* 384 */ _CFFI_OP(_CFFI_OP_NOOP, 115),
 /* 385 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
 /* 386 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_configuration_t const *, uint32_t, _Bool *)
@@ -1789,866 +1789,999 @@ static void *_cffi_types[] = {
 /* 472 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
 /* 473 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, clingo_ground_program_observer_t const *, _Bool, void *)
 /* 474 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
-/* 475 */ _CFFI_OP(_CFFI_OP_POINTER, 1280), // clingo_ground_program_observer_t const *
+/* 475 */ _CFFI_OP(_CFFI_OP_POINTER, 1409), // clingo_ground_program_observer_t const *
 /* 476 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 1),
 /* 477 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
 /* 478 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 479 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, clingo_part_t const *, size_t, _Bool(*)(clingo_location_t const *, char const *, uint64_t const *, size_t, void *, _Bool(*)(uint64_t const *, size_t, void *), void *), void *)
+/* 479 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, clingo_ground_program_observer_t const *, clingo_ground_program_batch_observer_t const *, size_t, _Bool, void *)
 /* 480 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
-/* 481 */ _CFFI_OP(_CFFI_OP_POINTER, 1284), // clingo_part_t const *
-/* 482 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 483 */ _CFFI_OP(_CFFI_OP_POINTER, 582), // _Bool(*)(clingo_location_t const *, char const *, uint64_t const *, size_t, void *, _Bool(*)(uint64_t const *, size_t, void *), void *)
-/* 484 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 485 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 486 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, clingo_program_builder_t * *)
-/* 487 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
-/* 488 */ _CFFI_OP(_CFFI_OP_POINTER, 689), // clingo_program_builder_t * *
-/* 489 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 490 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, clingo_propagator_t const *, void *, _Bool)
-/* 491 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
-/* 492 */ _CFFI_OP(_CFFI_OP_POINTER, 1288), // clingo_propagator_t const *
-/* 493 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 494 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 1),
-/* 495 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 496 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, int32_t)
-/* 497 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
-/* 498 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
-/* 499 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 500 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, int32_t, int)
-/* 501 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
-/* 502 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
-/* 503 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 504 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 505 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, uint32_t const *, size_t, _Bool)
-/* 506 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
-/* 507 */ _CFFI_OP(_CFFI_OP_NOOP, 2),
-/* 508 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 509 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 1),
-/* 510 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 511 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, unsigned int, char const *, _Bool)
-/* 512 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
-/* 513 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 8),
-/* 514 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 515 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 1),
-/* 516 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 517 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, unsigned int, int32_t const *, size_t, _Bool(*)(unsigned int, void *, void *, _Bool *), void *, clingo_solve_handle_t * *)
-/* 518 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
-/* 519 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 8),
-/* 520 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 521 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 522 */ _CFFI_OP(_CFFI_OP_POINTER, 1101), // _Bool(*)(unsigned int, void *, void *, _Bool *)
-/* 523 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 524 */ _CFFI_OP(_CFFI_OP_POINTER, 795), // clingo_solve_handle_t * *
-/* 525 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 526 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, void * *)
-/* 527 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
-/* 528 */ _CFFI_OP(_CFFI_OP_POINTER, 6), // void * *
-/* 529 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 530 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, void *)
-/* 531 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
-/* 532 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 481 */ _CFFI_OP(_CFFI_OP_NOOP, 475),
+/* 482 */ _CFFI_OP(_CFFI_OP_POINTER, 1408), // clingo_ground_program_batch_observer_t const *
+/* 483 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 484 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 1),
+/* 485 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 486 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 487 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, clingo_part_t const *, size_t, _Bool(*)(clingo_location_t const *, char const *, uint64_t const *, size_t, void *, _Bool(*)(uint64_t const *, size_t, void *), void *), void *)
+/* 488 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
+/* 489 */ _CFFI_OP(_CFFI_OP_POINTER, 1414), // clingo_part_t const *
+/* 490 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 491 */ _CFFI_OP(_CFFI_OP_POINTER, 590), // _Bool(*)(clingo_location_t const *, char const *, uint64_t const *, size_t, void *, _Bool(*)(uint64_t const *, size_t, void *), void *)
+/* 492 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 493 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 494 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, clingo_program_builder_t * *)
+/* 495 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
+/* 496 */ _CFFI_OP(_CFFI_OP_POINTER, 701), // clingo_program_builder_t * *
+/* 497 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 498 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, clingo_propagator_t const *, void *, _Bool)
+/* 499 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
+/* 500 */ _CFFI_OP(_CFFI_OP_POINTER, 1418), // clingo_propagator_t const *
+/* 501 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 502 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 1),
+/* 503 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 504 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, int32_t)
+/* 505 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
+/* 506 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 507 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 508 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, int32_t, int)
+/* 509 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
+/* 510 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 511 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 512 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 513 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, uint32_t const *, size_t, _Bool)
+/* 514 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
+/* 515 */ _CFFI_OP(_CFFI_OP_NOOP, 2),
+/* 516 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 517 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 1),
+/* 518 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 519 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, unsigned int, char const *, _Bool)
+/* 520 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
+/* 521 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 8),
+/* 522 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 523 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 1),
+/* 524 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 525 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, unsigned int, int32_t const *, size_t, _Bool(*)(unsigned int, void *, void *, _Bool *), void *, clingo_solve_handle_t * *)
+/* 526 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
+/* 527 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 8),
+/* 528 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 529 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 530 */ _CFFI_OP(_CFFI_OP_POINTER, 1219), // _Bool(*)(unsigned int, void *, void *, _Bool *)
+/* 531 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 532 */ _CFFI_OP(_CFFI_OP_POINTER, 841), // clingo_solve_handle_t * *
 /* 533 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 534 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t const *)
-/* 535 */ _CFFI_OP(_CFFI_OP_POINTER, 1279), // clingo_control_t const *
-/* 536 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 537 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t const *, char const *, _Bool *)
-/* 538 */ _CFFI_OP(_CFFI_OP_NOOP, 535),
-/* 539 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 540 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 534 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, void * *)
+/* 535 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
+/* 536 */ _CFFI_OP(_CFFI_OP_POINTER, 6), // void * *
+/* 537 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 538 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t *, void *)
+/* 539 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
+/* 540 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
 /* 541 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 542 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t const *, char const *, uint64_t *)
-/* 543 */ _CFFI_OP(_CFFI_OP_NOOP, 535),
-/* 544 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 545 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
-/* 546 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 547 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t const *, clingo_statistics_t const * *)
-/* 548 */ _CFFI_OP(_CFFI_OP_NOOP, 535),
-/* 549 */ _CFFI_OP(_CFFI_OP_POINTER, 829), // clingo_statistics_t const * *
-/* 550 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 551 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t const *, clingo_symbolic_atoms_t const * *)
-/* 552 */ _CFFI_OP(_CFFI_OP_NOOP, 535),
-/* 553 */ _CFFI_OP(_CFFI_OP_POINTER, 872), // clingo_symbolic_atoms_t const * *
+/* 542 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t const *)
+/* 543 */ _CFFI_OP(_CFFI_OP_POINTER, 1407), // clingo_control_t const *
+/* 544 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 545 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t const *, char const *, _Bool *)
+/* 546 */ _CFFI_OP(_CFFI_OP_NOOP, 543),
+/* 547 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 548 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 549 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 550 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t const *, char const *, uint64_t *)
+/* 551 */ _CFFI_OP(_CFFI_OP_NOOP, 543),
+/* 552 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 553 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
 /* 554 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 555 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t const *, clingo_theory_atoms_t const * *)
-/* 556 */ _CFFI_OP(_CFFI_OP_NOOP, 535),
-/* 557 */ _CFFI_OP(_CFFI_OP_POINTER, 911), // clingo_theory_atoms_t const * *
+/* 555 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t const *, clingo_statistics_t const * *)
+/* 556 */ _CFFI_OP(_CFFI_OP_NOOP, 543),
+/* 557 */ _CFFI_OP(_CFFI_OP_POINTER, 875), // clingo_statistics_t const * *
 /* 558 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 559 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_location_t *, char const *, void *)
-/* 560 */ _CFFI_OP(_CFFI_OP_NOOP, 187),
-/* 561 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 562 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 563 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 564 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_location_t *, char const *, void *, size_t, void *, void *, void *)
-/* 565 */ _CFFI_OP(_CFFI_OP_NOOP, 187),
-/* 566 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 567 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 568 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 569 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 559 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t const *, clingo_symbolic_atoms_t const * *)
+/* 560 */ _CFFI_OP(_CFFI_OP_NOOP, 543),
+/* 561 */ _CFFI_OP(_CFFI_OP_POINTER, 924), // clingo_symbolic_atoms_t const * *
+/* 562 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 563 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_control_t const *, clingo_theory_atoms_t const * *)
+/* 564 */ _CFFI_OP(_CFFI_OP_NOOP, 543),
+/* 565 */ _CFFI_OP(_CFFI_OP_POINTER, 988), // clingo_theory_atoms_t const * *
+/* 566 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 567 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_location_t *, char const *, void *)
+/* 568 */ _CFFI_OP(_CFFI_OP_NOOP, 187),
+/* 569 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
 /* 570 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 571 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 572 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 573 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_location_t const *, char const *, uint64_t const *, size_t, _Bool(*)(uint64_t const *, size_t, void *), void *, void *)
-/* 574 */ _CFFI_OP(_CFFI_OP_NOOP, 192),
-/* 575 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 576 */ _CFFI_OP(_CFFI_OP_NOOP, 79),
-/* 577 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 578 */ _CFFI_OP(_CFFI_OP_POINTER, 1052), // _Bool(*)(uint64_t const *, size_t, void *)
+/* 571 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 572 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_location_t *, char const *, void *, size_t, void *, void *, void *)
+/* 573 */ _CFFI_OP(_CFFI_OP_NOOP, 187),
+/* 574 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 575 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 576 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 577 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 578 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
 /* 579 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 580 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 581 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 582 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_location_t const *, char const *, uint64_t const *, size_t, void *, _Bool(*)(uint64_t const *, size_t, void *), void *)
-/* 583 */ _CFFI_OP(_CFFI_OP_NOOP, 192),
-/* 584 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 585 */ _CFFI_OP(_CFFI_OP_NOOP, 79),
-/* 586 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 580 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 581 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_location_t const *, char const *, uint64_t const *, size_t, _Bool(*)(uint64_t const *, size_t, void *), void *, void *)
+/* 582 */ _CFFI_OP(_CFFI_OP_NOOP, 192),
+/* 583 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 584 */ _CFFI_OP(_CFFI_OP_NOOP, 79),
+/* 585 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 586 */ _CFFI_OP(_CFFI_OP_POINTER, 1170), // _Bool(*)(uint64_t const *, size_t, void *)
 /* 587 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 588 */ _CFFI_OP(_CFFI_OP_NOOP, 578),
-/* 589 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 590 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 591 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_location_t const *, char const *, void *)
-/* 592 */ _CFFI_OP(_CFFI_OP_NOOP, 192),
-/* 593 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 594 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 595 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 596 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t *, uint64_t const *, size_t)
-/* 597 */ _CFFI_OP(_CFFI_OP_POINTER, 1282), // clingo_model_t *
-/* 598 */ _CFFI_OP(_CFFI_OP_NOOP, 79),
-/* 599 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 600 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 601 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, _Bool *)
-/* 602 */ _CFFI_OP(_CFFI_OP_POINTER, 1282), // clingo_model_t const *
-/* 603 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
-/* 604 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 605 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, _Bool(*)(void *), void *, void *)
-/* 606 */ _CFFI_OP(_CFFI_OP_NOOP, 602),
-/* 607 */ _CFFI_OP(_CFFI_OP_POINTER, 1107), // _Bool(*)(void *)
-/* 608 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 609 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 610 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 611 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, clingo_solve_control_t * *)
-/* 612 */ _CFFI_OP(_CFFI_OP_NOOP, 602),
-/* 613 */ _CFFI_OP(_CFFI_OP_POINTER, 786), // clingo_solve_control_t * *
-/* 614 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 615 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, int *)
-/* 616 */ _CFFI_OP(_CFFI_OP_NOOP, 602),
-/* 617 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
+/* 588 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 589 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 590 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_location_t const *, char const *, uint64_t const *, size_t, void *, _Bool(*)(uint64_t const *, size_t, void *), void *)
+/* 591 */ _CFFI_OP(_CFFI_OP_NOOP, 192),
+/* 592 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 593 */ _CFFI_OP(_CFFI_OP_NOOP, 79),
+/* 594 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 595 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 596 */ _CFFI_OP(_CFFI_OP_NOOP, 586),
+/* 597 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 598 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 599 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_location_t const *, char const *, void *)
+/* 600 */ _CFFI_OP(_CFFI_OP_NOOP, 192),
+/* 601 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 602 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 603 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 604 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t *, uint64_t const *, size_t)
+/* 605 */ _CFFI_OP(_CFFI_OP_POINTER, 1411), // clingo_model_t *
+/* 606 */ _CFFI_OP(_CFFI_OP_NOOP, 79),
+/* 607 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 608 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 609 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, _Bool *)
+/* 610 */ _CFFI_OP(_CFFI_OP_POINTER, 1411), // clingo_model_t const *
+/* 611 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 612 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 613 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, _Bool(*)(void *), void *, void *)
+/* 614 */ _CFFI_OP(_CFFI_OP_NOOP, 610),
+/* 615 */ _CFFI_OP(_CFFI_OP_POINTER, 1225), // _Bool(*)(void *)
+/* 616 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 617 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
 /* 618 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 619 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, int32_t *, size_t)
-/* 620 */ _CFFI_OP(_CFFI_OP_NOOP, 602),
-/* 621 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
-/* 622 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 623 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 624 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, int32_t, _Bool *)
-/* 625 */ _CFFI_OP(_CFFI_OP_NOOP, 602),
-/* 626 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
-/* 627 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
-/* 628 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 629 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, int32_t, int *)
-/* 630 */ _CFFI_OP(_CFFI_OP_NOOP, 602),
-/* 631 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
-/* 632 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
-/* 633 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 634 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, int64_t *, size_t)
-/* 635 */ _CFFI_OP(_CFFI_OP_NOOP, 602),
-/* 636 */ _CFFI_OP(_CFFI_OP_POINTER, 1330), // int64_t *
-/* 637 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 638 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 639 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, size_t *)
-/* 640 */ _CFFI_OP(_CFFI_OP_NOOP, 602),
-/* 641 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
-/* 642 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 643 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, uint32_t *)
-/* 644 */ _CFFI_OP(_CFFI_OP_NOOP, 602),
-/* 645 */ _CFFI_OP(_CFFI_OP_NOOP, 115),
+/* 619 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, clingo_solve_control_t * *)
+/* 620 */ _CFFI_OP(_CFFI_OP_NOOP, 610),
+/* 621 */ _CFFI_OP(_CFFI_OP_POINTER, 832), // clingo_solve_control_t * *
+/* 622 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 623 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, int *)
+/* 624 */ _CFFI_OP(_CFFI_OP_NOOP, 610),
+/* 625 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
+/* 626 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 627 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, int32_t *, size_t)
+/* 628 */ _CFFI_OP(_CFFI_OP_NOOP, 610),
+/* 629 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
+/* 630 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 631 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 632 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, int32_t, _Bool *)
+/* 633 */ _CFFI_OP(_CFFI_OP_NOOP, 610),
+/* 634 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 635 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 636 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 637 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, int32_t, int *)
+/* 638 */ _CFFI_OP(_CFFI_OP_NOOP, 610),
+/* 639 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 640 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
+/* 641 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 642 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, int64_t *, size_t)
+/* 643 */ _CFFI_OP(_CFFI_OP_NOOP, 610),
+/* 644 */ _CFFI_OP(_CFFI_OP_POINTER, 1463), // int64_t *
+/* 645 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
 /* 646 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 647 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, uint64_t *)
-/* 648 */ _CFFI_OP(_CFFI_OP_NOOP, 602),
-/* 649 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
+/* 647 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, size_t *)
+/* 648 */ _CFFI_OP(_CFFI_OP_NOOP, 610),
+/* 649 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
 /* 650 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 651 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, uint64_t, _Bool *)
-/* 652 */ _CFFI_OP(_CFFI_OP_NOOP, 602),
-/* 653 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 654 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
-/* 655 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 656 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, unsigned int, size_t *)
-/* 657 */ _CFFI_OP(_CFFI_OP_NOOP, 602),
-/* 658 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 8),
-/* 659 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
-/* 660 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 661 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, unsigned int, uint64_t *, size_t)
-/* 662 */ _CFFI_OP(_CFFI_OP_NOOP, 602),
-/* 663 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 8),
-/* 664 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
-/* 665 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 666 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 667 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_options_t *, char const *, char const *, char const *, _Bool *)
-/* 668 */ _CFFI_OP(_CFFI_OP_POINTER, 1283), // clingo_options_t *
-/* 669 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 670 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 671 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 672 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
-/* 673 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 674 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_options_t *, char const *, char const *, char const *, _Bool(*)(char const *, void *), void *, _Bool, char const *)
-/* 675 */ _CFFI_OP(_CFFI_OP_NOOP, 668),
-/* 676 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 651 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, uint32_t *)
+/* 652 */ _CFFI_OP(_CFFI_OP_NOOP, 610),
+/* 653 */ _CFFI_OP(_CFFI_OP_NOOP, 115),
+/* 654 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 655 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, uint64_t *)
+/* 656 */ _CFFI_OP(_CFFI_OP_NOOP, 610),
+/* 657 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
+/* 658 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 659 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, uint64_t, _Bool *)
+/* 660 */ _CFFI_OP(_CFFI_OP_NOOP, 610),
+/* 661 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 662 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 663 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 664 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, unsigned int, size_t *)
+/* 665 */ _CFFI_OP(_CFFI_OP_NOOP, 610),
+/* 666 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 8),
+/* 667 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
+/* 668 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 669 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_model_t const *, unsigned int, uint64_t *, size_t)
+/* 670 */ _CFFI_OP(_CFFI_OP_NOOP, 610),
+/* 671 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 8),
+/* 672 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
+/* 673 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 674 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 675 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_options_t *, char const *, char const *, char const *, _Bool *)
+/* 676 */ _CFFI_OP(_CFFI_OP_POINTER, 1412), // clingo_options_t *
 /* 677 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
 /* 678 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 679 */ _CFFI_OP(_CFFI_OP_POINTER, 84), // _Bool(*)(char const *, void *)
-/* 680 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 681 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 1),
-/* 682 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 683 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 684 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_options_t *, void *)
-/* 685 */ _CFFI_OP(_CFFI_OP_NOOP, 668),
-/* 686 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 687 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 688 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_program_builder_t *)
-/* 689 */ _CFFI_OP(_CFFI_OP_POINTER, 1285), // clingo_program_builder_t *
-/* 690 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 691 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_program_builder_t *, clingo_ast_t *)
-/* 692 */ _CFFI_OP(_CFFI_OP_NOOP, 689),
-/* 693 */ _CFFI_OP(_CFFI_OP_NOOP, 137),
-/* 694 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 695 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_control_t *, _Bool *)
-/* 696 */ _CFFI_OP(_CFFI_OP_POINTER, 1286), // clingo_propagate_control_t *
-/* 697 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
-/* 698 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 699 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_control_t *, int32_t *)
-/* 700 */ _CFFI_OP(_CFFI_OP_NOOP, 696),
-/* 701 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
+/* 679 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 680 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 681 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 682 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_options_t *, char const *, char const *, char const *, _Bool(*)(char const *, void *), void *, _Bool, char const *)
+/* 683 */ _CFFI_OP(_CFFI_OP_NOOP, 676),
+/* 684 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 685 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 686 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 687 */ _CFFI_OP(_CFFI_OP_POINTER, 84), // _Bool(*)(char const *, void *)
+/* 688 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 689 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 1),
+/* 690 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 691 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 692 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_options_t *, void *)
+/* 693 */ _CFFI_OP(_CFFI_OP_NOOP, 676),
+/* 694 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 695 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 696 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_output_atom_batch_t const *, void *)
+/* 697 */ _CFFI_OP(_CFFI_OP_POINTER, 1413), // clingo_output_atom_batch_t const *
+/* 698 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 699 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 700 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_program_builder_t *)
+/* 701 */ _CFFI_OP(_CFFI_OP_POINTER, 1415), // clingo_program_builder_t *
 /* 702 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 703 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_control_t *, int32_t const *, size_t, int, _Bool *)
-/* 704 */ _CFFI_OP(_CFFI_OP_NOOP, 696),
-/* 705 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 706 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 707 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 708 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
-/* 709 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 710 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_control_t *, int32_t const *, size_t, void *)
-/* 711 */ _CFFI_OP(_CFFI_OP_NOOP, 696),
-/* 712 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 713 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 714 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 715 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 716 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_control_t *, int32_t)
-/* 717 */ _CFFI_OP(_CFFI_OP_NOOP, 696),
-/* 718 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
-/* 719 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 720 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_control_t *, void *)
-/* 721 */ _CFFI_OP(_CFFI_OP_NOOP, 696),
-/* 722 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 723 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 724 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_control_t const *, int32_t)
-/* 725 */ _CFFI_OP(_CFFI_OP_POINTER, 1286), // clingo_propagate_control_t const *
-/* 726 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 703 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_program_builder_t *, clingo_ast_t *)
+/* 704 */ _CFFI_OP(_CFFI_OP_NOOP, 701),
+/* 705 */ _CFFI_OP(_CFFI_OP_NOOP, 137),
+/* 706 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 707 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_control_t *, _Bool *)
+/* 708 */ _CFFI_OP(_CFFI_OP_POINTER, 1416), // clingo_propagate_control_t *
+/* 709 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 710 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 711 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_control_t *, int32_t *)
+/* 712 */ _CFFI_OP(_CFFI_OP_NOOP, 708),
+/* 713 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
+/* 714 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 715 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_control_t *, int32_t const *, size_t const *, size_t, int, _Bool *)
+/* 716 */ _CFFI_OP(_CFFI_OP_NOOP, 708),
+/* 717 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 718 */ _CFFI_OP(_CFFI_OP_POINTER, 3), // size_t const *
+/* 719 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 720 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 721 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 722 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 723 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_control_t *, int32_t const *, size_t)
+/* 724 */ _CFFI_OP(_CFFI_OP_NOOP, 708),
+/* 725 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 726 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
 /* 727 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 728 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, _Bool *)
-/* 729 */ _CFFI_OP(_CFFI_OP_POINTER, 1287), // clingo_propagate_init_t *
-/* 730 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
-/* 731 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 732 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, _Bool, int32_t *)
-/* 733 */ _CFFI_OP(_CFFI_OP_NOOP, 729),
-/* 734 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 1),
-/* 735 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
-/* 736 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 737 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, int32_t const *, size_t, _Bool *)
-/* 738 */ _CFFI_OP(_CFFI_OP_NOOP, 729),
-/* 739 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 740 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 741 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
-/* 742 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 743 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, int32_t)
-/* 744 */ _CFFI_OP(_CFFI_OP_NOOP, 729),
-/* 745 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
-/* 746 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 747 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, int32_t, clingo_weighted_literal_t const *, size_t, int32_t, int, _Bool, _Bool *)
-/* 748 */ _CFFI_OP(_CFFI_OP_NOOP, 729),
-/* 749 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
-/* 750 */ _CFFI_OP(_CFFI_OP_NOOP, 13),
-/* 751 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 752 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
-/* 753 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 754 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 1),
+/* 728 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_control_t *, int32_t const *, size_t, int, _Bool *)
+/* 729 */ _CFFI_OP(_CFFI_OP_NOOP, 708),
+/* 730 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 731 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 732 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 733 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 734 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 735 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_control_t *, int32_t const *, size_t, void *)
+/* 736 */ _CFFI_OP(_CFFI_OP_NOOP, 708),
+/* 737 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 738 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 739 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 740 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 741 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_control_t *, int32_t)
+/* 742 */ _CFFI_OP(_CFFI_OP_NOOP, 708),
+/* 743 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 744 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 745 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_control_t *, void *)
+/* 746 */ _CFFI_OP(_CFFI_OP_NOOP, 708),
+/* 747 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 748 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 749 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_control_t const *, int32_t)
+/* 750 */ _CFFI_OP(_CFFI_OP_POINTER, 1416), // clingo_propagate_control_t const *
+/* 751 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 752 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 753 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, _Bool *)
+/* 754 */ _CFFI_OP(_CFFI_OP_POINTER, 1417), // clingo_propagate_init_t *
 /* 755 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
 /* 756 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 757 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, int32_t, int32_t, int32_t)
-/* 758 */ _CFFI_OP(_CFFI_OP_NOOP, 729),
-/* 759 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
-/* 760 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
-/* 761 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
-/* 762 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 763 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, int32_t, uint32_t)
-/* 764 */ _CFFI_OP(_CFFI_OP_NOOP, 729),
-/* 765 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
-/* 766 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 767 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 768 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, void *)
-/* 769 */ _CFFI_OP(_CFFI_OP_NOOP, 729),
-/* 770 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 771 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 772 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t const *, clingo_symbolic_atoms_t const * *)
-/* 773 */ _CFFI_OP(_CFFI_OP_POINTER, 1287), // clingo_propagate_init_t const *
-/* 774 */ _CFFI_OP(_CFFI_OP_NOOP, 553),
-/* 775 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 776 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t const *, clingo_theory_atoms_t const * *)
-/* 777 */ _CFFI_OP(_CFFI_OP_NOOP, 773),
-/* 778 */ _CFFI_OP(_CFFI_OP_NOOP, 557),
-/* 779 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 780 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t const *, int32_t, int32_t *)
-/* 781 */ _CFFI_OP(_CFFI_OP_NOOP, 773),
-/* 782 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
-/* 783 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
-/* 784 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 785 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_solve_control_t *, int32_t const *, size_t)
-/* 786 */ _CFFI_OP(_CFFI_OP_POINTER, 1290), // clingo_solve_control_t *
-/* 787 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 788 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 789 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 790 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_solve_control_t const *, clingo_symbolic_atoms_t const * *)
-/* 791 */ _CFFI_OP(_CFFI_OP_POINTER, 1290), // clingo_solve_control_t const *
-/* 792 */ _CFFI_OP(_CFFI_OP_NOOP, 553),
-/* 793 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 794 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_solve_handle_t *)
-/* 795 */ _CFFI_OP(_CFFI_OP_POINTER, 1291), // clingo_solve_handle_t *
-/* 796 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 797 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_solve_handle_t *, clingo_model_t const * *)
-/* 798 */ _CFFI_OP(_CFFI_OP_NOOP, 795),
-/* 799 */ _CFFI_OP(_CFFI_OP_POINTER, 602), // clingo_model_t const * *
-/* 800 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 801 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_solve_handle_t *, int32_t const * *, size_t *)
-/* 802 */ _CFFI_OP(_CFFI_OP_NOOP, 795),
-/* 803 */ _CFFI_OP(_CFFI_OP_POINTER, 4), // int32_t const * *
-/* 804 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
-/* 805 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 806 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_solve_handle_t *, unsigned int *)
-/* 807 */ _CFFI_OP(_CFFI_OP_NOOP, 795),
-/* 808 */ _CFFI_OP(_CFFI_OP_NOOP, 434),
-/* 809 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 810 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t *, uint64_t, char const *, int, uint64_t *)
-/* 811 */ _CFFI_OP(_CFFI_OP_POINTER, 1292), // clingo_statistics_t *
-/* 812 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 813 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 814 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 815 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
-/* 816 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 817 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t *, uint64_t, double)
-/* 818 */ _CFFI_OP(_CFFI_OP_NOOP, 811),
-/* 819 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 820 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 14), // double
+/* 757 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, _Bool, int32_t *)
+/* 758 */ _CFFI_OP(_CFFI_OP_NOOP, 754),
+/* 759 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 1),
+/* 760 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
+/* 761 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 762 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, int32_t const *, size_t)
+/* 763 */ _CFFI_OP(_CFFI_OP_NOOP, 754),
+/* 764 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 765 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 766 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 767 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, int32_t const *, size_t, _Bool *)
+/* 768 */ _CFFI_OP(_CFFI_OP_NOOP, 754),
+/* 769 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 770 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 771 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 772 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 773 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, int32_t const *, size_t, uint32_t)
+/* 774 */ _CFFI_OP(_CFFI_OP_NOOP, 754),
+/* 775 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 776 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 777 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 778 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 779 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, int32_t)
+/* 780 */ _CFFI_OP(_CFFI_OP_NOOP, 754),
+/* 781 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 782 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 783 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, int32_t, clingo_weighted_literal_t const *, size_t, int32_t, int, _Bool, _Bool *)
+/* 784 */ _CFFI_OP(_CFFI_OP_NOOP, 754),
+/* 785 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 786 */ _CFFI_OP(_CFFI_OP_NOOP, 13),
+/* 787 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 788 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 789 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 790 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 1),
+/* 791 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 792 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 793 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, int32_t, int32_t, int32_t)
+/* 794 */ _CFFI_OP(_CFFI_OP_NOOP, 754),
+/* 795 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 796 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 797 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 798 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 799 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, int32_t, uint32_t)
+/* 800 */ _CFFI_OP(_CFFI_OP_NOOP, 754),
+/* 801 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 802 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 803 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 804 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t *, void *)
+/* 805 */ _CFFI_OP(_CFFI_OP_NOOP, 754),
+/* 806 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 807 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 808 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t const *, clingo_symbolic_atoms_t const * *)
+/* 809 */ _CFFI_OP(_CFFI_OP_POINTER, 1417), // clingo_propagate_init_t const *
+/* 810 */ _CFFI_OP(_CFFI_OP_NOOP, 561),
+/* 811 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 812 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t const *, clingo_theory_atoms_t const * *)
+/* 813 */ _CFFI_OP(_CFFI_OP_NOOP, 809),
+/* 814 */ _CFFI_OP(_CFFI_OP_NOOP, 565),
+/* 815 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 816 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t const *, int32_t const *, size_t, int32_t *)
+/* 817 */ _CFFI_OP(_CFFI_OP_NOOP, 809),
+/* 818 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 819 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 820 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
 /* 821 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 822 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t *, uint64_t, int, uint64_t *)
-/* 823 */ _CFFI_OP(_CFFI_OP_NOOP, 811),
-/* 824 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 825 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 826 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
-/* 827 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 828 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t const *, uint64_t *)
-/* 829 */ _CFFI_OP(_CFFI_OP_POINTER, 1292), // clingo_statistics_t const *
-/* 830 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
-/* 831 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 832 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t const *, uint64_t, char const *, _Bool *)
-/* 833 */ _CFFI_OP(_CFFI_OP_NOOP, 829),
-/* 834 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 835 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 836 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
-/* 837 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 838 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t const *, uint64_t, char const *, uint64_t *)
-/* 839 */ _CFFI_OP(_CFFI_OP_NOOP, 829),
-/* 840 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 841 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 842 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
-/* 843 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 844 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t const *, uint64_t, double *)
-/* 845 */ _CFFI_OP(_CFFI_OP_NOOP, 829),
-/* 846 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 847 */ _CFFI_OP(_CFFI_OP_POINTER, 820), // double *
-/* 848 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 849 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t const *, uint64_t, int *)
-/* 850 */ _CFFI_OP(_CFFI_OP_NOOP, 829),
-/* 851 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 852 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
-/* 853 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 854 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t const *, uint64_t, size_t *)
-/* 855 */ _CFFI_OP(_CFFI_OP_NOOP, 829),
-/* 856 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 857 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
-/* 858 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 859 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t const *, uint64_t, size_t, char const * *)
-/* 860 */ _CFFI_OP(_CFFI_OP_NOOP, 829),
-/* 861 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 862 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 863 */ _CFFI_OP(_CFFI_OP_NOOP, 60),
-/* 864 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 865 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t const *, uint64_t, size_t, uint64_t *)
-/* 866 */ _CFFI_OP(_CFFI_OP_NOOP, 829),
-/* 867 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 868 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 869 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
-/* 870 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 871 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, size_t *)
-/* 872 */ _CFFI_OP(_CFFI_OP_POINTER, 1293), // clingo_symbolic_atoms_t const *
-/* 873 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
-/* 874 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 875 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, uint64_t *)
-/* 876 */ _CFFI_OP(_CFFI_OP_NOOP, 872),
-/* 877 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
-/* 878 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 879 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, uint64_t *, size_t)
-/* 880 */ _CFFI_OP(_CFFI_OP_NOOP, 872),
-/* 881 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
+/* 822 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_propagate_init_t const *, int32_t, int32_t *)
+/* 823 */ _CFFI_OP(_CFFI_OP_NOOP, 809),
+/* 824 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 825 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
+/* 826 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 827 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_rule_batch_t const *, void *)
+/* 828 */ _CFFI_OP(_CFFI_OP_POINTER, 1419), // clingo_rule_batch_t const *
+/* 829 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 830 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 831 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_solve_control_t *, int32_t const *, size_t)
+/* 832 */ _CFFI_OP(_CFFI_OP_POINTER, 1421), // clingo_solve_control_t *
+/* 833 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 834 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 835 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 836 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_solve_control_t const *, clingo_symbolic_atoms_t const * *)
+/* 837 */ _CFFI_OP(_CFFI_OP_POINTER, 1421), // clingo_solve_control_t const *
+/* 838 */ _CFFI_OP(_CFFI_OP_NOOP, 561),
+/* 839 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 840 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_solve_handle_t *)
+/* 841 */ _CFFI_OP(_CFFI_OP_POINTER, 1422), // clingo_solve_handle_t *
+/* 842 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 843 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_solve_handle_t *, clingo_model_t const * *)
+/* 844 */ _CFFI_OP(_CFFI_OP_NOOP, 841),
+/* 845 */ _CFFI_OP(_CFFI_OP_POINTER, 610), // clingo_model_t const * *
+/* 846 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 847 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_solve_handle_t *, int32_t const * *, size_t *)
+/* 848 */ _CFFI_OP(_CFFI_OP_NOOP, 841),
+/* 849 */ _CFFI_OP(_CFFI_OP_POINTER, 4), // int32_t const * *
+/* 850 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
+/* 851 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 852 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_solve_handle_t *, unsigned int *)
+/* 853 */ _CFFI_OP(_CFFI_OP_NOOP, 841),
+/* 854 */ _CFFI_OP(_CFFI_OP_NOOP, 434),
+/* 855 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 856 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t *, uint64_t, char const *, int, uint64_t *)
+/* 857 */ _CFFI_OP(_CFFI_OP_POINTER, 1423), // clingo_statistics_t *
+/* 858 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 859 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 860 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 861 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
+/* 862 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 863 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t *, uint64_t, double)
+/* 864 */ _CFFI_OP(_CFFI_OP_NOOP, 857),
+/* 865 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 866 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 14), // double
+/* 867 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 868 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t *, uint64_t, int, uint64_t *)
+/* 869 */ _CFFI_OP(_CFFI_OP_NOOP, 857),
+/* 870 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 871 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 872 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
+/* 873 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 874 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t const *, uint64_t *)
+/* 875 */ _CFFI_OP(_CFFI_OP_POINTER, 1423), // clingo_statistics_t const *
+/* 876 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
+/* 877 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 878 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t const *, uint64_t, char *, size_t)
+/* 879 */ _CFFI_OP(_CFFI_OP_NOOP, 875),
+/* 880 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 881 */ _CFFI_OP(_CFFI_OP_NOOP, 138),
 /* 882 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
 /* 883 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 884 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, uint64_t const *, uint64_t *)
-/* 885 */ _CFFI_OP(_CFFI_OP_NOOP, 872),
-/* 886 */ _CFFI_OP(_CFFI_OP_NOOP, 79),
-/* 887 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
-/* 888 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 889 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, uint64_t, _Bool *)
-/* 890 */ _CFFI_OP(_CFFI_OP_NOOP, 872),
-/* 891 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 892 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
-/* 893 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 894 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, uint64_t, int32_t *)
-/* 895 */ _CFFI_OP(_CFFI_OP_NOOP, 872),
-/* 896 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 897 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
-/* 898 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 899 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, uint64_t, uint64_t *)
-/* 900 */ _CFFI_OP(_CFFI_OP_NOOP, 872),
-/* 901 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 902 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
-/* 903 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 904 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, uint64_t, uint64_t, _Bool *)
-/* 905 */ _CFFI_OP(_CFFI_OP_NOOP, 872),
-/* 906 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 907 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 908 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
-/* 909 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 910 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, size_t *)
-/* 911 */ _CFFI_OP(_CFFI_OP_POINTER, 1294), // clingo_theory_atoms_t const *
-/* 912 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
-/* 913 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 914 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, _Bool *)
-/* 915 */ _CFFI_OP(_CFFI_OP_NOOP, 911),
-/* 916 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 917 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
-/* 918 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 919 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, char *, size_t)
-/* 920 */ _CFFI_OP(_CFFI_OP_NOOP, 911),
-/* 921 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 922 */ _CFFI_OP(_CFFI_OP_NOOP, 138),
-/* 923 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 924 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 925 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, char const * *)
-/* 926 */ _CFFI_OP(_CFFI_OP_NOOP, 911),
-/* 927 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 928 */ _CFFI_OP(_CFFI_OP_NOOP, 60),
-/* 929 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 930 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, char const * *, uint32_t *)
-/* 931 */ _CFFI_OP(_CFFI_OP_NOOP, 911),
-/* 932 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 933 */ _CFFI_OP(_CFFI_OP_NOOP, 60),
-/* 934 */ _CFFI_OP(_CFFI_OP_NOOP, 115),
+/* 884 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t const *, uint64_t, char const *, _Bool *)
+/* 885 */ _CFFI_OP(_CFFI_OP_NOOP, 875),
+/* 886 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 887 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 888 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 889 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 890 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t const *, uint64_t, char const *, uint64_t *)
+/* 891 */ _CFFI_OP(_CFFI_OP_NOOP, 875),
+/* 892 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 893 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 894 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
+/* 895 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 896 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t const *, uint64_t, double *)
+/* 897 */ _CFFI_OP(_CFFI_OP_NOOP, 875),
+/* 898 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 899 */ _CFFI_OP(_CFFI_OP_POINTER, 866), // double *
+/* 900 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 901 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t const *, uint64_t, int *)
+/* 902 */ _CFFI_OP(_CFFI_OP_NOOP, 875),
+/* 903 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 904 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
+/* 905 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 906 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t const *, uint64_t, size_t *)
+/* 907 */ _CFFI_OP(_CFFI_OP_NOOP, 875),
+/* 908 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 909 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
+/* 910 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 911 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t const *, uint64_t, size_t, char const * *)
+/* 912 */ _CFFI_OP(_CFFI_OP_NOOP, 875),
+/* 913 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 914 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 915 */ _CFFI_OP(_CFFI_OP_NOOP, 60),
+/* 916 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 917 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_statistics_t const *, uint64_t, size_t, uint64_t *)
+/* 918 */ _CFFI_OP(_CFFI_OP_NOOP, 875),
+/* 919 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 920 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 921 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
+/* 922 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 923 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, size_t *)
+/* 924 */ _CFFI_OP(_CFFI_OP_POINTER, 1424), // clingo_symbolic_atoms_t const *
+/* 925 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
+/* 926 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 927 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, uint64_t *)
+/* 928 */ _CFFI_OP(_CFFI_OP_NOOP, 924),
+/* 929 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
+/* 930 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 931 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, uint64_t *, size_t)
+/* 932 */ _CFFI_OP(_CFFI_OP_NOOP, 924),
+/* 933 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
+/* 934 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
 /* 935 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 936 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, int *)
-/* 937 */ _CFFI_OP(_CFFI_OP_NOOP, 911),
-/* 938 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 939 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
+/* 936 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, uint64_t const *, uint64_t *)
+/* 937 */ _CFFI_OP(_CFFI_OP_NOOP, 924),
+/* 938 */ _CFFI_OP(_CFFI_OP_NOOP, 79),
+/* 939 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
 /* 940 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 941 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, int32_t *)
-/* 942 */ _CFFI_OP(_CFFI_OP_NOOP, 911),
-/* 943 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 944 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
+/* 941 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, uint64_t, _Bool *)
+/* 942 */ _CFFI_OP(_CFFI_OP_NOOP, 924),
+/* 943 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 944 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
 /* 945 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 946 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, int32_t const * *, size_t *)
-/* 947 */ _CFFI_OP(_CFFI_OP_NOOP, 911),
-/* 948 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 949 */ _CFFI_OP(_CFFI_OP_NOOP, 803),
-/* 950 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
-/* 951 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 952 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, size_t *)
-/* 953 */ _CFFI_OP(_CFFI_OP_NOOP, 911),
-/* 954 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 955 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
-/* 956 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 957 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, uint32_t *)
-/* 958 */ _CFFI_OP(_CFFI_OP_NOOP, 911),
-/* 959 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 960 */ _CFFI_OP(_CFFI_OP_NOOP, 115),
-/* 961 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 962 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, uint32_t const * *, size_t *)
-/* 963 */ _CFFI_OP(_CFFI_OP_NOOP, 911),
-/* 964 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 965 */ _CFFI_OP(_CFFI_OP_POINTER, 2), // uint32_t const * *
-/* 966 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
-/* 967 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 968 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(int, clingo_ast_t * *, ...)
-/* 969 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 970 */ _CFFI_OP(_CFFI_OP_NOOP, 143),
-/* 971 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 1),
-/* 972 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(int, int, int32_t const *, size_t, void *)
-/* 973 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 974 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 975 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 976 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 977 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 978 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 979 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(int32_t const *, size_t, void *)
-/* 980 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 981 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 982 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 983 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 984 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(int32_t, clingo_weighted_literal_t const *, size_t, void *)
-/* 985 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
-/* 986 */ _CFFI_OP(_CFFI_OP_NOOP, 13),
-/* 987 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 988 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 989 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 990 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t const *, size_t, void *)
-/* 991 */ _CFFI_OP(_CFFI_OP_NOOP, 2),
-/* 992 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 993 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 994 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 995 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t, char const *, void *)
-/* 996 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 997 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 998 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 999 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1000 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t, clingo_assignment_t const *, int32_t, void *, int32_t *)
-/* 1001 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 1002 */ _CFFI_OP(_CFFI_OP_NOOP, 96),
-/* 1003 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
-/* 1004 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1005 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
+/* 946 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, uint64_t, int32_t *)
+/* 947 */ _CFFI_OP(_CFFI_OP_NOOP, 924),
+/* 948 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 949 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
+/* 950 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 951 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, uint64_t, size_t *)
+/* 952 */ _CFFI_OP(_CFFI_OP_NOOP, 924),
+/* 953 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 954 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
+/* 955 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 956 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, uint64_t, size_t const *, uint64_t const *, size_t, uint64_t *, size_t, size_t *)
+/* 957 */ _CFFI_OP(_CFFI_OP_NOOP, 924),
+/* 958 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 959 */ _CFFI_OP(_CFFI_OP_NOOP, 718),
+/* 960 */ _CFFI_OP(_CFFI_OP_NOOP, 79),
+/* 961 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 962 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
+/* 963 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 964 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
+/* 965 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 966 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, uint64_t, size_t, uint64_t *, int32_t *, _Bool *, _Bool *, size_t)
+/* 967 */ _CFFI_OP(_CFFI_OP_NOOP, 924),
+/* 968 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 969 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 970 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
+/* 971 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
+/* 972 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 973 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 974 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 975 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 976 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, uint64_t, uint64_t *)
+/* 977 */ _CFFI_OP(_CFFI_OP_NOOP, 924),
+/* 978 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 979 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
+/* 980 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 981 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_symbolic_atoms_t const *, uint64_t, uint64_t, _Bool *)
+/* 982 */ _CFFI_OP(_CFFI_OP_NOOP, 924),
+/* 983 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 984 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 985 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 986 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 987 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, size_t *)
+/* 988 */ _CFFI_OP(_CFFI_OP_POINTER, 1425), // clingo_theory_atoms_t const *
+/* 989 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
+/* 990 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 991 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, _Bool *)
+/* 992 */ _CFFI_OP(_CFFI_OP_NOOP, 988),
+/* 993 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 994 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 995 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 996 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, char *, size_t)
+/* 997 */ _CFFI_OP(_CFFI_OP_NOOP, 988),
+/* 998 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 999 */ _CFFI_OP(_CFFI_OP_NOOP, 138),
+/* 1000 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1001 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1002 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, char const * *)
+/* 1003 */ _CFFI_OP(_CFFI_OP_NOOP, 988),
+/* 1004 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1005 */ _CFFI_OP(_CFFI_OP_NOOP, 60),
 /* 1006 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1007 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t, int, int, unsigned int, int32_t const *, size_t, void *)
-/* 1008 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 1009 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 1010 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 1011 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 8),
-/* 1012 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 1013 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 1014 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1015 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1016 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t, int, uint32_t const *, size_t, void *)
-/* 1017 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 1018 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 1019 */ _CFFI_OP(_CFFI_OP_NOOP, 2),
-/* 1020 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 1021 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1022 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1023 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t, int, void *)
-/* 1024 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 1025 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 1026 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1027 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1028 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t, uint32_t const *, size_t, int32_t const *, size_t, void *)
-/* 1029 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 1030 */ _CFFI_OP(_CFFI_OP_NOOP, 2),
-/* 1031 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 1032 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 1033 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 1034 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1035 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1036 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t, uint32_t, uint32_t const *, size_t, uint32_t, uint32_t, void *)
-/* 1037 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 1038 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 1039 */ _CFFI_OP(_CFFI_OP_NOOP, 2),
-/* 1040 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 1041 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 1042 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 1043 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1044 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1045 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t, uint32_t, uint32_t const *, size_t, void *)
-/* 1046 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 1047 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 1048 */ _CFFI_OP(_CFFI_OP_NOOP, 2),
-/* 1049 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 1050 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1051 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1052 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t const *, size_t, void *)
-/* 1053 */ _CFFI_OP(_CFFI_OP_NOOP, 79),
-/* 1054 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 1055 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1056 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1057 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t)
-/* 1058 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 1007 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, char const * *, uint32_t *)
+/* 1008 */ _CFFI_OP(_CFFI_OP_NOOP, 988),
+/* 1009 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1010 */ _CFFI_OP(_CFFI_OP_NOOP, 60),
+/* 1011 */ _CFFI_OP(_CFFI_OP_NOOP, 115),
+/* 1012 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1013 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, int *)
+/* 1014 */ _CFFI_OP(_CFFI_OP_NOOP, 988),
+/* 1015 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1016 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
+/* 1017 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1018 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, int *, int *, size_t *, size_t)
+/* 1019 */ _CFFI_OP(_CFFI_OP_NOOP, 988),
+/* 1020 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1021 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
+/* 1022 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
+/* 1023 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
+/* 1024 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1025 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1026 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, int32_t *)
+/* 1027 */ _CFFI_OP(_CFFI_OP_NOOP, 988),
+/* 1028 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1029 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
+/* 1030 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1031 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, int32_t *, size_t *, size_t)
+/* 1032 */ _CFFI_OP(_CFFI_OP_NOOP, 988),
+/* 1033 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1034 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
+/* 1035 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
+/* 1036 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1037 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1038 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, int32_t *, uint32_t *, _Bool *, uint32_t *, uint32_t *, size_t *, size_t)
+/* 1039 */ _CFFI_OP(_CFFI_OP_NOOP, 988),
+/* 1040 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1041 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
+/* 1042 */ _CFFI_OP(_CFFI_OP_NOOP, 115),
+/* 1043 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 1044 */ _CFFI_OP(_CFFI_OP_NOOP, 115),
+/* 1045 */ _CFFI_OP(_CFFI_OP_NOOP, 115),
+/* 1046 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
+/* 1047 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1048 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1049 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, int32_t const * *, size_t *)
+/* 1050 */ _CFFI_OP(_CFFI_OP_NOOP, 988),
+/* 1051 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1052 */ _CFFI_OP(_CFFI_OP_NOOP, 849),
+/* 1053 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
+/* 1054 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1055 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, size_t *)
+/* 1056 */ _CFFI_OP(_CFFI_OP_NOOP, 988),
+/* 1057 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1058 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
 /* 1059 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1060 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, _Bool *)
-/* 1061 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 1062 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
-/* 1063 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1064 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, char *, size_t)
-/* 1065 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 1066 */ _CFFI_OP(_CFFI_OP_NOOP, 138),
-/* 1067 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 1068 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1069 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, char const * *)
-/* 1070 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 1071 */ _CFFI_OP(_CFFI_OP_NOOP, 60),
-/* 1072 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1073 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, int *)
-/* 1074 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 1075 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
-/* 1076 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1077 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, int32_t const *, size_t, void *)
-/* 1078 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 1079 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 1080 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 1081 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1082 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1083 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, size_t *)
-/* 1084 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 1085 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
-/* 1086 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1087 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, uint32_t, void *)
-/* 1088 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 1089 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 1090 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1091 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1092 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, uint64_t const * *, size_t *)
-/* 1093 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 1094 */ _CFFI_OP(_CFFI_OP_POINTER, 79), // uint64_t const * *
-/* 1095 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
+/* 1060 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, size_t, uint32_t *, size_t)
+/* 1061 */ _CFFI_OP(_CFFI_OP_NOOP, 988),
+/* 1062 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1063 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1064 */ _CFFI_OP(_CFFI_OP_NOOP, 115),
+/* 1065 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1066 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1067 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, uint32_t *)
+/* 1068 */ _CFFI_OP(_CFFI_OP_NOOP, 988),
+/* 1069 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1070 */ _CFFI_OP(_CFFI_OP_NOOP, 115),
+/* 1071 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1072 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_atoms_t const *, uint32_t, uint32_t const * *, size_t *)
+/* 1073 */ _CFFI_OP(_CFFI_OP_NOOP, 988),
+/* 1074 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1075 */ _CFFI_OP(_CFFI_OP_POINTER, 2), // uint32_t const * *
+/* 1076 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
+/* 1077 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1078 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_theory_element_batch_t const *, void *)
+/* 1079 */ _CFFI_OP(_CFFI_OP_POINTER, 1426), // clingo_theory_element_batch_t const *
+/* 1080 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1081 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1082 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(clingo_weight_rule_batch_t const *, void *)
+/* 1083 */ _CFFI_OP(_CFFI_OP_POINTER, 1427), // clingo_weight_rule_batch_t const *
+/* 1084 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1085 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1086 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(int, clingo_ast_t * *, ...)
+/* 1087 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 1088 */ _CFFI_OP(_CFFI_OP_NOOP, 143),
+/* 1089 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 1),
+/* 1090 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(int, int, int32_t const *, size_t, void *)
+/* 1091 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 1092 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 1093 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 1094 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1095 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
 /* 1096 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1097 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, uint64_t)
-/* 1098 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 1099 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 1100 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1101 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(unsigned int, void *, void *, _Bool *)
-/* 1102 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 8),
-/* 1103 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1104 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1105 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
-/* 1106 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1107 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(void *)
-/* 1108 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1109 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1110 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(void *, char const *, void *)
+/* 1097 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(int32_t const *, size_t, void *)
+/* 1098 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 1099 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1100 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1101 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1102 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(int32_t, clingo_weighted_literal_t const *, size_t, void *)
+/* 1103 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 1104 */ _CFFI_OP(_CFFI_OP_NOOP, 13),
+/* 1105 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1106 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1107 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1108 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t const *, size_t, void *)
+/* 1109 */ _CFFI_OP(_CFFI_OP_NOOP, 2),
+/* 1110 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
 /* 1111 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1112 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 1113 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1114 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1115 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(void *, char const *, void *, size_t, void *, void *, void *)
+/* 1112 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1113 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t, char const *, void *)
+/* 1114 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1115 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
 /* 1116 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1117 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 1118 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1119 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 1120 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1121 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1117 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1118 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t, clingo_assignment_t const *, int32_t, void *, int32_t *)
+/* 1119 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1120 */ _CFFI_OP(_CFFI_OP_NOOP, 96),
+/* 1121 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
 /* 1122 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1123 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1124 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(void *, void *)
-/* 1125 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1126 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1127 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1128 */ _CFFI_OP(_CFFI_OP_FUNCTION, 40), // char const *()(char const *)
-/* 1129 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 1130 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1131 */ _CFFI_OP(_CFFI_OP_FUNCTION, 40), // char const *()(int)
-/* 1132 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 1123 */ _CFFI_OP(_CFFI_OP_NOOP, 120),
+/* 1124 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1125 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t, int, int, unsigned int, int32_t const *, size_t, void *)
+/* 1126 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1127 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 1128 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 1129 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 8),
+/* 1130 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 1131 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1132 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
 /* 1133 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1134 */ _CFFI_OP(_CFFI_OP_FUNCTION, 40), // char const *()(uint64_t)
-/* 1135 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 1136 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1137 */ _CFFI_OP(_CFFI_OP_FUNCTION, 40), // char const *()(void *)
-/* 1138 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1139 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1140 */ _CFFI_OP(_CFFI_OP_FUNCTION, 40), // char const *()(void)
-/* 1141 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1142 */ _CFFI_OP(_CFFI_OP_FUNCTION, 96), // clingo_assignment_t const *()(clingo_propagate_control_t const *)
-/* 1143 */ _CFFI_OP(_CFFI_OP_NOOP, 725),
-/* 1144 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1145 */ _CFFI_OP(_CFFI_OP_FUNCTION, 96), // clingo_assignment_t const *()(clingo_propagate_init_t const *)
-/* 1146 */ _CFFI_OP(_CFFI_OP_NOOP, 773),
-/* 1147 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1148 */ _CFFI_OP(_CFFI_OP_FUNCTION, 155), // int()(clingo_application_t *, char const * const *, size_t, void *)
-/* 1149 */ _CFFI_OP(_CFFI_OP_POINTER, 1268), // clingo_application_t *
-/* 1150 */ _CFFI_OP(_CFFI_OP_NOOP, 22),
+/* 1134 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t, int, uint32_t const *, size_t, void *)
+/* 1135 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1136 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 1137 */ _CFFI_OP(_CFFI_OP_NOOP, 2),
+/* 1138 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1139 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1140 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1141 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t, int, void *)
+/* 1142 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1143 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 1144 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1145 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1146 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t, uint32_t const *, size_t, int32_t const *, size_t, void *)
+/* 1147 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1148 */ _CFFI_OP(_CFFI_OP_NOOP, 2),
+/* 1149 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1150 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
 /* 1151 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
 /* 1152 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
 /* 1153 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1154 */ _CFFI_OP(_CFFI_OP_FUNCTION, 155), // int()(clingo_propagate_init_t const *)
-/* 1155 */ _CFFI_OP(_CFFI_OP_NOOP, 773),
-/* 1156 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1157 */ _CFFI_OP(_CFFI_OP_FUNCTION, 155), // int()(uint64_t)
-/* 1158 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 1159 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1160 */ _CFFI_OP(_CFFI_OP_FUNCTION, 155), // int()(void)
-/* 1161 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1162 */ _CFFI_OP(_CFFI_OP_FUNCTION, 3), // size_t()(clingo_assignment_t const *)
-/* 1163 */ _CFFI_OP(_CFFI_OP_NOOP, 96),
-/* 1164 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1165 */ _CFFI_OP(_CFFI_OP_FUNCTION, 3), // size_t()(clingo_ast_t *)
-/* 1166 */ _CFFI_OP(_CFFI_OP_NOOP, 137),
-/* 1167 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1168 */ _CFFI_OP(_CFFI_OP_FUNCTION, 3), // size_t()(uint64_t)
-/* 1169 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 1170 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1171 */ _CFFI_OP(_CFFI_OP_FUNCTION, 69), // uint32_t()(clingo_assignment_t const *)
-/* 1172 */ _CFFI_OP(_CFFI_OP_NOOP, 96),
-/* 1173 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1174 */ _CFFI_OP(_CFFI_OP_FUNCTION, 69), // uint32_t()(clingo_propagate_control_t const *)
-/* 1175 */ _CFFI_OP(_CFFI_OP_NOOP, 725),
-/* 1176 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1177 */ _CFFI_OP(_CFFI_OP_FUNCTION, 69), // uint32_t()(uint64_t)
-/* 1178 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
-/* 1179 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1180 */ _CFFI_OP(_CFFI_OP_FUNCTION, 29), // unsigned int()(void *)
-/* 1181 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1182 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1183 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1334), // void()(clingo_ast_t *)
-/* 1184 */ _CFFI_OP(_CFFI_OP_NOOP, 137),
-/* 1185 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1186 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1334), // void()(clingo_control_t *)
-/* 1187 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
-/* 1188 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1189 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1334), // void()(clingo_propagate_control_t *, int32_t)
-/* 1190 */ _CFFI_OP(_CFFI_OP_NOOP, 696),
-/* 1191 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
-/* 1192 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1193 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1334), // void()(clingo_propagate_control_t const *, int32_t const *, size_t, void *)
-/* 1194 */ _CFFI_OP(_CFFI_OP_NOOP, 725),
-/* 1195 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 1196 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 1197 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1198 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1199 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1334), // void()(clingo_propagate_init_t *, int)
-/* 1200 */ _CFFI_OP(_CFFI_OP_NOOP, 729),
-/* 1201 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 1202 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1203 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1334), // void()(clingo_solve_handle_t *, double, _Bool *)
-/* 1204 */ _CFFI_OP(_CFFI_OP_NOOP, 795),
-/* 1205 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 14),
-/* 1206 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
-/* 1207 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1208 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1334), // void()(int *, int *, int *)
-/* 1209 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
-/* 1210 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
-/* 1211 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
-/* 1212 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1213 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1334), // void()(int, char const *)
-/* 1214 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 1215 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 1216 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1217 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1334), // void()(int, char const *, void *)
-/* 1218 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 1219 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
-/* 1220 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1221 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1222 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1334), // void()(int, uint64_t *)
-/* 1223 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
-/* 1224 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
-/* 1225 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1226 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1334), // void()(uint64_t *)
-/* 1227 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
-/* 1228 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1229 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1334), // void()(void *)
-/* 1230 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
-/* 1231 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 1232 */ _CFFI_OP(_CFFI_OP_POINTER, 0), // _Bool(*)(_Bool, uint32_t const *, size_t, int32_t const *, size_t, void *)
-/* 1233 */ _CFFI_OP(_CFFI_OP_POINTER, 8), // _Bool(*)(_Bool, uint32_t const *, size_t, int32_t, clingo_weighted_literal_t const *, size_t, void *)
-/* 1234 */ _CFFI_OP(_CFFI_OP_POINTER, 17), // _Bool(*)(_Bool, void *)
-/* 1235 */ _CFFI_OP(_CFFI_OP_POINTER, 39), // _Bool(*)(char const *, _Bool *, void *)
-/* 1236 */ _CFFI_OP(_CFFI_OP_POINTER, 256), // _Bool(*)(clingo_ast_t const *, void *)
-/* 1237 */ _CFFI_OP(_CFFI_OP_POINTER, 448), // _Bool(*)(clingo_control_t *, char const * const *, size_t, void *)
-/* 1238 */ _CFFI_OP(_CFFI_OP_POINTER, 530), // _Bool(*)(clingo_control_t *, void *)
-/* 1239 */ _CFFI_OP(_CFFI_OP_POINTER, 559), // _Bool(*)(clingo_location_t *, char const *, void *)
-/* 1240 */ _CFFI_OP(_CFFI_OP_POINTER, 564), // _Bool(*)(clingo_location_t *, char const *, void *, size_t, void *, void *, void *)
-/* 1241 */ _CFFI_OP(_CFFI_OP_POINTER, 573), // _Bool(*)(clingo_location_t const *, char const *, uint64_t const *, size_t, _Bool(*)(uint64_t const *, size_t, void *), void *, void *)
-/* 1242 */ _CFFI_OP(_CFFI_OP_POINTER, 591), // _Bool(*)(clingo_location_t const *, char const *, void *)
-/* 1243 */ _CFFI_OP(_CFFI_OP_POINTER, 605), // _Bool(*)(clingo_model_t const *, _Bool(*)(void *), void *, void *)
-/* 1244 */ _CFFI_OP(_CFFI_OP_POINTER, 684), // _Bool(*)(clingo_options_t *, void *)
-/* 1245 */ _CFFI_OP(_CFFI_OP_POINTER, 710), // _Bool(*)(clingo_propagate_control_t *, int32_t const *, size_t, void *)
-/* 1246 */ _CFFI_OP(_CFFI_OP_POINTER, 720), // _Bool(*)(clingo_propagate_control_t *, void *)
-/* 1247 */ _CFFI_OP(_CFFI_OP_POINTER, 768), // _Bool(*)(clingo_propagate_init_t *, void *)
-/* 1248 */ _CFFI_OP(_CFFI_OP_POINTER, 968), // _Bool(*)(int, clingo_ast_t * *, ...)
-/* 1249 */ _CFFI_OP(_CFFI_OP_POINTER, 972), // _Bool(*)(int, int, int32_t const *, size_t, void *)
-/* 1250 */ _CFFI_OP(_CFFI_OP_POINTER, 979), // _Bool(*)(int32_t const *, size_t, void *)
-/* 1251 */ _CFFI_OP(_CFFI_OP_POINTER, 984), // _Bool(*)(int32_t, clingo_weighted_literal_t const *, size_t, void *)
-/* 1252 */ _CFFI_OP(_CFFI_OP_POINTER, 990), // _Bool(*)(uint32_t const *, size_t, void *)
-/* 1253 */ _CFFI_OP(_CFFI_OP_POINTER, 995), // _Bool(*)(uint32_t, char const *, void *)
-/* 1254 */ _CFFI_OP(_CFFI_OP_POINTER, 1000), // _Bool(*)(uint32_t, clingo_assignment_t const *, int32_t, void *, int32_t *)
-/* 1255 */ _CFFI_OP(_CFFI_OP_POINTER, 1007), // _Bool(*)(uint32_t, int, int, unsigned int, int32_t const *, size_t, void *)
-/* 1256 */ _CFFI_OP(_CFFI_OP_POINTER, 1016), // _Bool(*)(uint32_t, int, uint32_t const *, size_t, void *)
-/* 1257 */ _CFFI_OP(_CFFI_OP_POINTER, 1023), // _Bool(*)(uint32_t, int, void *)
-/* 1258 */ _CFFI_OP(_CFFI_OP_POINTER, 1028), // _Bool(*)(uint32_t, uint32_t const *, size_t, int32_t const *, size_t, void *)
-/* 1259 */ _CFFI_OP(_CFFI_OP_POINTER, 1036), // _Bool(*)(uint32_t, uint32_t, uint32_t const *, size_t, uint32_t, uint32_t, void *)
-/* 1260 */ _CFFI_OP(_CFFI_OP_POINTER, 1045), // _Bool(*)(uint32_t, uint32_t, uint32_t const *, size_t, void *)
-/* 1261 */ _CFFI_OP(_CFFI_OP_POINTER, 1077), // _Bool(*)(uint64_t, int32_t const *, size_t, void *)
-/* 1262 */ _CFFI_OP(_CFFI_OP_POINTER, 1087), // _Bool(*)(uint64_t, uint32_t, void *)
-/* 1263 */ _CFFI_OP(_CFFI_OP_POINTER, 1110), // _Bool(*)(void *, char const *, void *)
-/* 1264 */ _CFFI_OP(_CFFI_OP_POINTER, 1115), // _Bool(*)(void *, char const *, void *, size_t, void *, void *, void *)
-/* 1265 */ _CFFI_OP(_CFFI_OP_POINTER, 1124), // _Bool(*)(void *, void *)
-/* 1266 */ _CFFI_OP(_CFFI_OP_POINTER, 1137), // char const *(*)(void *)
-/* 1267 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 2), // char
-/* 1268 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 0), // clingo_application_t
-/* 1269 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 1), // clingo_assignment_t
-/* 1270 */ _CFFI_OP(_CFFI_OP_POINTER, 1271), // clingo_ast_argument_t const *
-/* 1271 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 3), // clingo_ast_argument_t
-/* 1272 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 4), // clingo_ast_attribute_names_t
-/* 1273 */ _CFFI_OP(_CFFI_OP_POINTER, 1274), // clingo_ast_constructor_t const *
-/* 1274 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 5), // clingo_ast_constructor_t
-/* 1275 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 6), // clingo_ast_constructors_t
-/* 1276 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 2), // clingo_ast_t
-/* 1277 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 7), // clingo_backend_t
-/* 1278 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 8), // clingo_configuration_t
-/* 1279 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 9), // clingo_control_t
-/* 1280 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 10), // clingo_ground_program_observer_t
-/* 1281 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 11), // clingo_location_t
-/* 1282 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 12), // clingo_model_t
-/* 1283 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 13), // clingo_options_t
-/* 1284 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 14), // clingo_part_t
-/* 1285 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 15), // clingo_program_builder_t
-/* 1286 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 16), // clingo_propagate_control_t
-/* 1287 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 17), // clingo_propagate_init_t
-/* 1288 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 18), // clingo_propagator_t
-/* 1289 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 19), // clingo_script_t
-/* 1290 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 20), // clingo_solve_control_t
-/* 1291 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 21), // clingo_solve_handle_t
-/* 1292 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 22), // clingo_statistics_t
-/* 1293 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 23), // clingo_symbolic_atoms_t
-/* 1294 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 24), // clingo_theory_atoms_t
-/* 1295 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 25), // clingo_weighted_literal_t
-/* 1296 */ _CFFI_OP(_CFFI_OP_ENUM, 0), // enum clingo_ast_aggregate_function_e
-/* 1297 */ _CFFI_OP(_CFFI_OP_ENUM, 1), // enum clingo_ast_attribute_e
-/* 1298 */ _CFFI_OP(_CFFI_OP_ENUM, 2), // enum clingo_ast_attribute_type_e
-/* 1299 */ _CFFI_OP(_CFFI_OP_ENUM, 3), // enum clingo_ast_binary_operator_e
-/* 1300 */ _CFFI_OP(_CFFI_OP_ENUM, 4), // enum clingo_ast_comparison_operator_e
-/* 1301 */ _CFFI_OP(_CFFI_OP_ENUM, 5), // enum clingo_ast_sign_e
-/* 1302 */ _CFFI_OP(_CFFI_OP_ENUM, 6), // enum clingo_ast_theory_atom_definition_type_e
-/* 1303 */ _CFFI_OP(_CFFI_OP_ENUM, 7), // enum clingo_ast_theory_operator_type_e
-/* 1304 */ _CFFI_OP(_CFFI_OP_ENUM, 8), // enum clingo_ast_theory_sequence_type_e
-/* 1305 */ _CFFI_OP(_CFFI_OP_ENUM, 9), // enum clingo_ast_type_e
-/* 1306 */ _CFFI_OP(_CFFI_OP_ENUM, 10), // enum clingo_ast_unary_operator_e
-/* 1307 */ _CFFI_OP(_CFFI_OP_ENUM, 11), // enum clingo_ast_unpool_type_e
-/* 1308 */ _CFFI_OP(_CFFI_OP_ENUM, 12), // enum clingo_backend_type_e
-/* 1309 */ _CFFI_OP(_CFFI_OP_ENUM, 13), // enum clingo_clause_type_e
-/* 1310 */ _CFFI_OP(_CFFI_OP_ENUM, 14), // enum clingo_comment_type_e
-/* 1311 */ _CFFI_OP(_CFFI_OP_ENUM, 15), // enum clingo_configuration_type_e
-/* 1312 */ _CFFI_OP(_CFFI_OP_ENUM, 16), // enum clingo_consequence_e
-/* 1313 */ _CFFI_OP(_CFFI_OP_ENUM, 17), // enum clingo_error_e
-/* 1314 */ _CFFI_OP(_CFFI_OP_ENUM, 18), // enum clingo_external_type_e
-/* 1315 */ _CFFI_OP(_CFFI_OP_ENUM, 19), // enum clingo_heuristic_type_e
-/* 1316 */ _CFFI_OP(_CFFI_OP_ENUM, 20), // enum clingo_model_type_e
-/* 1317 */ _CFFI_OP(_CFFI_OP_ENUM, 21), // enum clingo_propagator_check_mode_e
-/* 1318 */ _CFFI_OP(_CFFI_OP_ENUM, 22), // enum clingo_propagator_undo_mode_e
-/* 1319 */ _CFFI_OP(_CFFI_OP_ENUM, 23), // enum clingo_show_type_e
-/* 1320 */ _CFFI_OP(_CFFI_OP_ENUM, 24), // enum clingo_solve_event_type_e
-/* 1321 */ _CFFI_OP(_CFFI_OP_ENUM, 25), // enum clingo_solve_mode_e
-/* 1322 */ _CFFI_OP(_CFFI_OP_ENUM, 26), // enum clingo_solve_result_e
-/* 1323 */ _CFFI_OP(_CFFI_OP_ENUM, 27), // enum clingo_statistics_type_e
-/* 1324 */ _CFFI_OP(_CFFI_OP_ENUM, 28), // enum clingo_symbol_type_e
-/* 1325 */ _CFFI_OP(_CFFI_OP_ENUM, 29), // enum clingo_theory_sequence_type_e
-/* 1326 */ _CFFI_OP(_CFFI_OP_ENUM, 30), // enum clingo_theory_term_type_e
-/* 1327 */ _CFFI_OP(_CFFI_OP_ENUM, 31), // enum clingo_truth_value_e
-/* 1328 */ _CFFI_OP(_CFFI_OP_ENUM, 32), // enum clingo_warning_e
-/* 1329 */ _CFFI_OP(_CFFI_OP_ENUM, 33), // enum clingo_weight_constraint_type_e
-/* 1330 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 23), // int64_t
-/* 1331 */ _CFFI_OP(_CFFI_OP_POINTER, 1180), // unsigned int(*)(void *)
-/* 1332 */ _CFFI_OP(_CFFI_OP_POINTER, 1193), // void(*)(clingo_propagate_control_t const *, int32_t const *, size_t, void *)
-/* 1333 */ _CFFI_OP(_CFFI_OP_POINTER, 1229), // void(*)(void *)
-/* 1334 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 0), // void
+/* 1154 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t, uint32_t, uint32_t const *, size_t, uint32_t, uint32_t, void *)
+/* 1155 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1156 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1157 */ _CFFI_OP(_CFFI_OP_NOOP, 2),
+/* 1158 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1159 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1160 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1161 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1162 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1163 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint32_t, uint32_t, uint32_t const *, size_t, void *)
+/* 1164 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1165 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1166 */ _CFFI_OP(_CFFI_OP_NOOP, 2),
+/* 1167 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1168 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1169 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1170 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t const *, size_t, void *)
+/* 1171 */ _CFFI_OP(_CFFI_OP_NOOP, 79),
+/* 1172 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1173 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1174 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1175 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t)
+/* 1176 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 1177 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1178 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, _Bool *)
+/* 1179 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 1180 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 1181 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1182 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, char *, size_t)
+/* 1183 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 1184 */ _CFFI_OP(_CFFI_OP_NOOP, 138),
+/* 1185 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1186 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1187 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, char const * *)
+/* 1188 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 1189 */ _CFFI_OP(_CFFI_OP_NOOP, 60),
+/* 1190 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1191 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, int *)
+/* 1192 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 1193 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
+/* 1194 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1195 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, int32_t const *, size_t, void *)
+/* 1196 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 1197 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 1198 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1199 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1200 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1201 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, size_t *)
+/* 1202 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 1203 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
+/* 1204 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1205 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, uint32_t, void *)
+/* 1206 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 1207 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 1208 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1209 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1210 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, uint64_t const * *, size_t *)
+/* 1211 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 1212 */ _CFFI_OP(_CFFI_OP_POINTER, 79), // uint64_t const * *
+/* 1213 */ _CFFI_OP(_CFFI_OP_NOOP, 207),
+/* 1214 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1215 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(uint64_t, uint64_t)
+/* 1216 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 1217 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 1218 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1219 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(unsigned int, void *, void *, _Bool *)
+/* 1220 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 8),
+/* 1221 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1222 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1223 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 1224 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1225 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(void *)
+/* 1226 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1227 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1228 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(void *, char const *, void *)
+/* 1229 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1230 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 1231 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1232 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1233 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(void *, char const *, void *, size_t, void *, void *, void *)
+/* 1234 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1235 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 1236 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1237 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1238 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1239 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1240 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1241 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1242 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1), // _Bool()(void *, void *)
+/* 1243 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1244 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1245 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1246 */ _CFFI_OP(_CFFI_OP_FUNCTION, 40), // char const *()(char const *)
+/* 1247 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 1248 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1249 */ _CFFI_OP(_CFFI_OP_FUNCTION, 40), // char const *()(int)
+/* 1250 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 1251 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1252 */ _CFFI_OP(_CFFI_OP_FUNCTION, 40), // char const *()(uint64_t)
+/* 1253 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 1254 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1255 */ _CFFI_OP(_CFFI_OP_FUNCTION, 40), // char const *()(void *)
+/* 1256 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1257 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1258 */ _CFFI_OP(_CFFI_OP_FUNCTION, 40), // char const *()(void)
+/* 1259 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1260 */ _CFFI_OP(_CFFI_OP_FUNCTION, 96), // clingo_assignment_t const *()(clingo_propagate_control_t const *)
+/* 1261 */ _CFFI_OP(_CFFI_OP_NOOP, 750),
+/* 1262 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1263 */ _CFFI_OP(_CFFI_OP_FUNCTION, 96), // clingo_assignment_t const *()(clingo_propagate_init_t const *)
+/* 1264 */ _CFFI_OP(_CFFI_OP_NOOP, 809),
+/* 1265 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1266 */ _CFFI_OP(_CFFI_OP_FUNCTION, 155), // int()(clingo_application_t *, char const * const *, size_t, void *)
+/* 1267 */ _CFFI_OP(_CFFI_OP_POINTER, 1396), // clingo_application_t *
+/* 1268 */ _CFFI_OP(_CFFI_OP_NOOP, 22),
+/* 1269 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1270 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1271 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1272 */ _CFFI_OP(_CFFI_OP_FUNCTION, 155), // int()(clingo_propagate_init_t const *)
+/* 1273 */ _CFFI_OP(_CFFI_OP_NOOP, 809),
+/* 1274 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1275 */ _CFFI_OP(_CFFI_OP_FUNCTION, 155), // int()(uint64_t)
+/* 1276 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 1277 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1278 */ _CFFI_OP(_CFFI_OP_FUNCTION, 155), // int()(void)
+/* 1279 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1280 */ _CFFI_OP(_CFFI_OP_FUNCTION, 3), // size_t()(clingo_assignment_t const *)
+/* 1281 */ _CFFI_OP(_CFFI_OP_NOOP, 96),
+/* 1282 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1283 */ _CFFI_OP(_CFFI_OP_FUNCTION, 3), // size_t()(clingo_ast_t *)
+/* 1284 */ _CFFI_OP(_CFFI_OP_NOOP, 137),
+/* 1285 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1286 */ _CFFI_OP(_CFFI_OP_FUNCTION, 3), // size_t()(uint64_t)
+/* 1287 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 1288 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1289 */ _CFFI_OP(_CFFI_OP_FUNCTION, 69), // uint32_t()(clingo_assignment_t const *)
+/* 1290 */ _CFFI_OP(_CFFI_OP_NOOP, 96),
+/* 1291 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1292 */ _CFFI_OP(_CFFI_OP_FUNCTION, 69), // uint32_t()(clingo_propagate_control_t const *)
+/* 1293 */ _CFFI_OP(_CFFI_OP_NOOP, 750),
+/* 1294 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1295 */ _CFFI_OP(_CFFI_OP_FUNCTION, 69), // uint32_t()(uint64_t)
+/* 1296 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24),
+/* 1297 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1298 */ _CFFI_OP(_CFFI_OP_FUNCTION, 29), // unsigned int()(void *)
+/* 1299 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1300 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1301 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1467), // void()(clingo_ast_t *)
+/* 1302 */ _CFFI_OP(_CFFI_OP_NOOP, 137),
+/* 1303 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1304 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1467), // void()(clingo_control_t *)
+/* 1305 */ _CFFI_OP(_CFFI_OP_NOOP, 26),
+/* 1306 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1307 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1467), // void()(clingo_propagate_control_t *, int32_t const *, size_t)
+/* 1308 */ _CFFI_OP(_CFFI_OP_NOOP, 708),
+/* 1309 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 1310 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1311 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1312 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1467), // void()(clingo_propagate_control_t *, int32_t)
+/* 1313 */ _CFFI_OP(_CFFI_OP_NOOP, 708),
+/* 1314 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 1315 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1316 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1467), // void()(clingo_propagate_control_t const *, int32_t const *, size_t, void *)
+/* 1317 */ _CFFI_OP(_CFFI_OP_NOOP, 750),
+/* 1318 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 1319 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 1320 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1321 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1322 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1467), // void()(clingo_propagate_init_t *, int)
+/* 1323 */ _CFFI_OP(_CFFI_OP_NOOP, 754),
+/* 1324 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 1325 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1326 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1467), // void()(clingo_solve_handle_t *, double, _Bool *)
+/* 1327 */ _CFFI_OP(_CFFI_OP_NOOP, 841),
+/* 1328 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 14),
+/* 1329 */ _CFFI_OP(_CFFI_OP_NOOP, 41),
+/* 1330 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1331 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1467), // void()(int *, int *, int *)
+/* 1332 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
+/* 1333 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
+/* 1334 */ _CFFI_OP(_CFFI_OP_NOOP, 110),
+/* 1335 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1336 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1467), // void()(int, char const *)
+/* 1337 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 1338 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 1339 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1340 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1467), // void()(int, char const *, void *)
+/* 1341 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 1342 */ _CFFI_OP(_CFFI_OP_NOOP, 40),
+/* 1343 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1344 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1345 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1467), // void()(int, uint64_t *)
+/* 1346 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 1347 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
+/* 1348 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1349 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1467), // void()(uint64_t *)
+/* 1350 */ _CFFI_OP(_CFFI_OP_NOOP, 56),
+/* 1351 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1352 */ _CFFI_OP(_CFFI_OP_FUNCTION, 1467), // void()(void *)
+/* 1353 */ _CFFI_OP(_CFFI_OP_NOOP, 6),
+/* 1354 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 1355 */ _CFFI_OP(_CFFI_OP_POINTER, 1), // _Bool const *
+/* 1356 */ _CFFI_OP(_CFFI_OP_POINTER, 0), // _Bool(*)(_Bool, uint32_t const *, size_t, int32_t const *, size_t, void *)
+/* 1357 */ _CFFI_OP(_CFFI_OP_POINTER, 8), // _Bool(*)(_Bool, uint32_t const *, size_t, int32_t, clingo_weighted_literal_t const *, size_t, void *)
+/* 1358 */ _CFFI_OP(_CFFI_OP_POINTER, 17), // _Bool(*)(_Bool, void *)
+/* 1359 */ _CFFI_OP(_CFFI_OP_POINTER, 39), // _Bool(*)(char const *, _Bool *, void *)
+/* 1360 */ _CFFI_OP(_CFFI_OP_POINTER, 256), // _Bool(*)(clingo_ast_t const *, void *)
+/* 1361 */ _CFFI_OP(_CFFI_OP_POINTER, 448), // _Bool(*)(clingo_control_t *, char const * const *, size_t, void *)
+/* 1362 */ _CFFI_OP(_CFFI_OP_POINTER, 538), // _Bool(*)(clingo_control_t *, void *)
+/* 1363 */ _CFFI_OP(_CFFI_OP_POINTER, 567), // _Bool(*)(clingo_location_t *, char const *, void *)
+/* 1364 */ _CFFI_OP(_CFFI_OP_POINTER, 572), // _Bool(*)(clingo_location_t *, char const *, void *, size_t, void *, void *, void *)
+/* 1365 */ _CFFI_OP(_CFFI_OP_POINTER, 581), // _Bool(*)(clingo_location_t const *, char const *, uint64_t const *, size_t, _Bool(*)(uint64_t const *, size_t, void *), void *, void *)
+/* 1366 */ _CFFI_OP(_CFFI_OP_POINTER, 599), // _Bool(*)(clingo_location_t const *, char const *, void *)
+/* 1367 */ _CFFI_OP(_CFFI_OP_POINTER, 613), // _Bool(*)(clingo_model_t const *, _Bool(*)(void *), void *, void *)
+/* 1368 */ _CFFI_OP(_CFFI_OP_POINTER, 692), // _Bool(*)(clingo_options_t *, void *)
+/* 1369 */ _CFFI_OP(_CFFI_OP_POINTER, 696), // _Bool(*)(clingo_output_atom_batch_t const *, void *)
+/* 1370 */ _CFFI_OP(_CFFI_OP_POINTER, 735), // _Bool(*)(clingo_propagate_control_t *, int32_t const *, size_t, void *)
+/* 1371 */ _CFFI_OP(_CFFI_OP_POINTER, 745), // _Bool(*)(clingo_propagate_control_t *, void *)
+/* 1372 */ _CFFI_OP(_CFFI_OP_POINTER, 804), // _Bool(*)(clingo_propagate_init_t *, void *)
+/* 1373 */ _CFFI_OP(_CFFI_OP_POINTER, 827), // _Bool(*)(clingo_rule_batch_t const *, void *)
+/* 1374 */ _CFFI_OP(_CFFI_OP_POINTER, 1078), // _Bool(*)(clingo_theory_element_batch_t const *, void *)
+/* 1375 */ _CFFI_OP(_CFFI_OP_POINTER, 1082), // _Bool(*)(clingo_weight_rule_batch_t const *, void *)
+/* 1376 */ _CFFI_OP(_CFFI_OP_POINTER, 1086), // _Bool(*)(int, clingo_ast_t * *, ...)
+/* 1377 */ _CFFI_OP(_CFFI_OP_POINTER, 1090), // _Bool(*)(int, int, int32_t const *, size_t, void *)
+/* 1378 */ _CFFI_OP(_CFFI_OP_POINTER, 1097), // _Bool(*)(int32_t const *, size_t, void *)
+/* 1379 */ _CFFI_OP(_CFFI_OP_POINTER, 1102), // _Bool(*)(int32_t, clingo_weighted_literal_t const *, size_t, void *)
+/* 1380 */ _CFFI_OP(_CFFI_OP_POINTER, 1108), // _Bool(*)(uint32_t const *, size_t, void *)
+/* 1381 */ _CFFI_OP(_CFFI_OP_POINTER, 1113), // _Bool(*)(uint32_t, char const *, void *)
+/* 1382 */ _CFFI_OP(_CFFI_OP_POINTER, 1118), // _Bool(*)(uint32_t, clingo_assignment_t const *, int32_t, void *, int32_t *)
+/* 1383 */ _CFFI_OP(_CFFI_OP_POINTER, 1125), // _Bool(*)(uint32_t, int, int, unsigned int, int32_t const *, size_t, void *)
+/* 1384 */ _CFFI_OP(_CFFI_OP_POINTER, 1134), // _Bool(*)(uint32_t, int, uint32_t const *, size_t, void *)
+/* 1385 */ _CFFI_OP(_CFFI_OP_POINTER, 1141), // _Bool(*)(uint32_t, int, void *)
+/* 1386 */ _CFFI_OP(_CFFI_OP_POINTER, 1146), // _Bool(*)(uint32_t, uint32_t const *, size_t, int32_t const *, size_t, void *)
+/* 1387 */ _CFFI_OP(_CFFI_OP_POINTER, 1154), // _Bool(*)(uint32_t, uint32_t, uint32_t const *, size_t, uint32_t, uint32_t, void *)
+/* 1388 */ _CFFI_OP(_CFFI_OP_POINTER, 1163), // _Bool(*)(uint32_t, uint32_t, uint32_t const *, size_t, void *)
+/* 1389 */ _CFFI_OP(_CFFI_OP_POINTER, 1195), // _Bool(*)(uint64_t, int32_t const *, size_t, void *)
+/* 1390 */ _CFFI_OP(_CFFI_OP_POINTER, 1205), // _Bool(*)(uint64_t, uint32_t, void *)
+/* 1391 */ _CFFI_OP(_CFFI_OP_POINTER, 1228), // _Bool(*)(void *, char const *, void *)
+/* 1392 */ _CFFI_OP(_CFFI_OP_POINTER, 1233), // _Bool(*)(void *, char const *, void *, size_t, void *, void *, void *)
+/* 1393 */ _CFFI_OP(_CFFI_OP_POINTER, 1242), // _Bool(*)(void *, void *)
+/* 1394 */ _CFFI_OP(_CFFI_OP_POINTER, 1255), // char const *(*)(void *)
+/* 1395 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 2), // char
+/* 1396 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 0), // clingo_application_t
+/* 1397 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 1), // clingo_assignment_t
+/* 1398 */ _CFFI_OP(_CFFI_OP_POINTER, 1399), // clingo_ast_argument_t const *
+/* 1399 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 3), // clingo_ast_argument_t
+/* 1400 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 4), // clingo_ast_attribute_names_t
+/* 1401 */ _CFFI_OP(_CFFI_OP_POINTER, 1402), // clingo_ast_constructor_t const *
+/* 1402 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 5), // clingo_ast_constructor_t
+/* 1403 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 6), // clingo_ast_constructors_t
+/* 1404 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 2), // clingo_ast_t
+/* 1405 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 7), // clingo_backend_t
+/* 1406 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 8), // clingo_configuration_t
+/* 1407 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 9), // clingo_control_t
+/* 1408 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 10), // clingo_ground_program_batch_observer_t
+/* 1409 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 11), // clingo_ground_program_observer_t
+/* 1410 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 12), // clingo_location_t
+/* 1411 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 13), // clingo_model_t
+/* 1412 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 14), // clingo_options_t
+/* 1413 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 15), // clingo_output_atom_batch_t
+/* 1414 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 16), // clingo_part_t
+/* 1415 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 17), // clingo_program_builder_t
+/* 1416 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 18), // clingo_propagate_control_t
+/* 1417 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 19), // clingo_propagate_init_t
+/* 1418 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 20), // clingo_propagator_t
+/* 1419 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 21), // clingo_rule_batch_t
+/* 1420 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 22), // clingo_script_t
+/* 1421 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 23), // clingo_solve_control_t
+/* 1422 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 24), // clingo_solve_handle_t
+/* 1423 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 25), // clingo_statistics_t
+/* 1424 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 26), // clingo_symbolic_atoms_t
+/* 1425 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 27), // clingo_theory_atoms_t
+/* 1426 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 28), // clingo_theory_element_batch_t
+/* 1427 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 29), // clingo_weight_rule_batch_t
+/* 1428 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 30), // clingo_weighted_literal_t
+/* 1429 */ _CFFI_OP(_CFFI_OP_ENUM, 0), // enum clingo_ast_aggregate_function_e
+/* 1430 */ _CFFI_OP(_CFFI_OP_ENUM, 1), // enum clingo_ast_attribute_e
+/* 1431 */ _CFFI_OP(_CFFI_OP_ENUM, 2), // enum clingo_ast_attribute_type_e
+/* 1432 */ _CFFI_OP(_CFFI_OP_ENUM, 3), // enum clingo_ast_binary_operator_e
+/* 1433 */ _CFFI_OP(_CFFI_OP_ENUM, 4), // enum clingo_ast_comparison_operator_e
+/* 1434 */ _CFFI_OP(_CFFI_OP_ENUM, 5), // enum clingo_ast_sign_e
+/* 1435 */ _CFFI_OP(_CFFI_OP_ENUM, 6), // enum clingo_ast_theory_atom_definition_type_e
+/* 1436 */ _CFFI_OP(_CFFI_OP_ENUM, 7), // enum clingo_ast_theory_operator_type_e
+/* 1437 */ _CFFI_OP(_CFFI_OP_ENUM, 8), // enum clingo_ast_theory_sequence_type_e
+/* 1438 */ _CFFI_OP(_CFFI_OP_ENUM, 9), // enum clingo_ast_type_e
+/* 1439 */ _CFFI_OP(_CFFI_OP_ENUM, 10), // enum clingo_ast_unary_operator_e
+/* 1440 */ _CFFI_OP(_CFFI_OP_ENUM, 11), // enum clingo_ast_unpool_type_e
+/* 1441 */ _CFFI_OP(_CFFI_OP_ENUM, 12), // enum clingo_backend_type_e
+/* 1442 */ _CFFI_OP(_CFFI_OP_ENUM, 13), // enum clingo_clause_type_e
+/* 1443 */ _CFFI_OP(_CFFI_OP_ENUM, 14), // enum clingo_comment_type_e
+/* 1444 */ _CFFI_OP(_CFFI_OP_ENUM, 15), // enum clingo_configuration_type_e
+/* 1445 */ _CFFI_OP(_CFFI_OP_ENUM, 16), // enum clingo_consequence_e
+/* 1446 */ _CFFI_OP(_CFFI_OP_ENUM, 17), // enum clingo_error_e
+/* 1447 */ _CFFI_OP(_CFFI_OP_ENUM, 18), // enum clingo_external_type_e
+/* 1448 */ _CFFI_OP(_CFFI_OP_ENUM, 19), // enum clingo_heuristic_type_e
+/* 1449 */ _CFFI_OP(_CFFI_OP_ENUM, 20), // enum clingo_model_type_e
+/* 1450 */ _CFFI_OP(_CFFI_OP_ENUM, 21), // enum clingo_propagator_check_mode_e
+/* 1451 */ _CFFI_OP(_CFFI_OP_ENUM, 22), // enum clingo_propagator_undo_mode_e
+/* 1452 */ _CFFI_OP(_CFFI_OP_ENUM, 23), // enum clingo_show_type_e
+/* 1453 */ _CFFI_OP(_CFFI_OP_ENUM, 24), // enum clingo_solve_event_type_e
+/* 1454 */ _CFFI_OP(_CFFI_OP_ENUM, 25), // enum clingo_solve_mode_e
+/* 1455 */ _CFFI_OP(_CFFI_OP_ENUM, 26), // enum clingo_solve_result_e
+/* 1456 */ _CFFI_OP(_CFFI_OP_ENUM, 27), // enum clingo_statistics_type_e
+/* 1457 */ _CFFI_OP(_CFFI_OP_ENUM, 28), // enum clingo_symbol_type_e
+/* 1458 */ _CFFI_OP(_CFFI_OP_ENUM, 29), // enum clingo_theory_sequence_type_e
+/* 1459 */ _CFFI_OP(_CFFI_OP_ENUM, 30), // enum clingo_theory_term_type_e
+/* 1460 */ _CFFI_OP(_CFFI_OP_ENUM, 31), // enum clingo_truth_value_e
+/* 1461 */ _CFFI_OP(_CFFI_OP_ENUM, 32), // enum clingo_warning_e
+/* 1462 */ _CFFI_OP(_CFFI_OP_ENUM, 33), // enum clingo_weight_constraint_type_e
+/* 1463 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 23), // int64_t
+/* 1464 */ _CFFI_OP(_CFFI_OP_POINTER, 1298), // unsigned int(*)(void *)
+/* 1465 */ _CFFI_OP(_CFFI_OP_POINTER, 1316), // void(*)(clingo_propagate_control_t const *, int32_t const *, size_t, void *)
+/* 1466 */ _CFFI_OP(_CFFI_OP_POINTER, 1352), // void(*)(void *)
+/* 1467 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 0), // void
 };
 
 static struct _cffi_externpy_s _cffi_externpy__pyclingo_call =
@@ -4581,6 +4714,19 @@ static _Bool pyclingo_observer_output_atom(uint64_t a0, uint32_t a1, void * a2)
   return *(_Bool *)p;
 }
 
+static struct _cffi_externpy_s _cffi_externpy__pyclingo_observer_output_atoms =
+  { "_clingo.pyclingo_observer_output_atoms", (int)sizeof(_Bool), 0, 0 };
+
+static _Bool pyclingo_observer_output_atoms(clingo_output_atom_batch_t const * a0, void * a1)
+{
+  char a[16];
+  char *p = a;
+  *(clingo_output_atom_batch_t const * *)(p + 0) = a0;
+  *(void * *)(p + 8) = a1;
+  _cffi_call_python(&_cffi_externpy__pyclingo_observer_output_atoms, p);
+  return *(_Bool *)p;
+}
+
 static struct _cffi_externpy_s _cffi_externpy__pyclingo_observer_output_term =
   { "_clingo.pyclingo_observer_output_term", (int)sizeof(_Bool), 0, 0 };
 
@@ -4627,6 +4773,19 @@ static _Bool pyclingo_observer_rule(_Bool a0, uint32_t const * a1, size_t a2, in
   return *(_Bool *)p;
 }
 
+static struct _cffi_externpy_s _cffi_externpy__pyclingo_observer_rules =
+  { "_clingo.pyclingo_observer_rules", (int)sizeof(_Bool), 0, 0 };
+
+static _Bool pyclingo_observer_rules(clingo_rule_batch_t const * a0, void * a1)
+{
+  char a[16];
+  char *p = a;
+  *(clingo_rule_batch_t const * *)(p + 0) = a0;
+  *(void * *)(p + 8) = a1;
+  _cffi_call_python(&_cffi_externpy__pyclingo_observer_rules, p);
+  return *(_Bool *)p;
+}
+
 static struct _cffi_externpy_s _cffi_externpy__pyclingo_observer_theory_atom =
   { "_clingo.pyclingo_observer_theory_atom", (int)sizeof(_Bool), 0, 0 };
 
@@ -4678,6 +4837,19 @@ static _Bool pyclingo_observer_theory_element(uint32_t a0, uint32_t const * a1,
   return *(_Bool *)p;
 }
 
+static struct _cffi_externpy_s _cffi_externpy__pyclingo_observer_theory_elements =
+  { "_clingo.pyclingo_observer_theory_elements", (int)sizeof(_Bool), 0, 0 };
+
+static _Bool pyclingo_observer_theory_elements(clingo_theory_element_batch_t const * a0, void * a1)
+{
+  char a[16];
+  char *p = a;
+  *(clingo_theory_element_batch_t const * *)(p + 0) = a0;
+  *(void * *)(p + 8) = a1;
+  _cffi_call_python(&_cffi_externpy__pyclingo_observer_theory_elements, p);
+  return *(_Bool *)p;
+}
+
 static struct _cffi_externpy_s _cffi_externpy__pyclingo_observer_theory_term_compound =
   { "_clingo.pyclingo_observer_theory_term_compound", (int)sizeof(_Bool), 0, 0 };
 
@@ -4740,6 +4912,19 @@ static _Bool pyclingo_observer_weight_rule(_Bool a0, uint32_t const * a1, size_t
   return *(_Bool *)p;
 }
 
+static struct _cffi_externpy_s _cffi_externpy__pyclingo_observer_weight_rules =
+  { "_clingo.pyclingo_observer_weight_rules", (int)sizeof(_Bool), 0, 0 };
+
+static _Bool pyclingo_observer_weight_rules(clingo_weight_rule_batch_t const * a0, void * a1)
+{
+  char a[16];
+  char *p = a;
+  *(clingo_weight_rule_batch_t const * *)(p + 0) = a0;
+  *(void * *)(p + 8) = a1;
+  _cffi_call_python(&_cffi_externpy__pyclingo_observer_weight_rules, p);
+  return *(_Bool *)p;
+}
+
 static struct _cffi_externpy_s _cffi_externpy__pyclingo_propagator_check =
   { "_clingo.pyclingo_propagator_check", (int)sizeof(_Bool), 0, 0 };
 
@@ -10327,10 +10512,10 @@ _cffi_f_clingo_control_clasp_facade(PyObject *self, PyObject *args)
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(528), arg1, (char **)&x1);
+      _cffi_type(536), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (void * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(528), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(536), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -10500,10 +10685,10 @@ _cffi_f_clingo_control_get_const(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(535), arg0, (char **)&x0);
+      _cffi_type(543), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_control_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(535), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(543), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -10653,10 +10838,10 @@ _cffi_f_clingo_control_ground(PyObject *self, PyObject *args)
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(481), arg1, (char **)&x1);
+      _cffi_type(489), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_part_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(481), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(489), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -10665,7 +10850,7 @@ _cffi_f_clingo_control_ground(PyObject *self, PyObject *args)
   if (x2 == (size_t)-1 && PyErr_Occurred())
     return NULL;
 
-  x3 = (_Bool(*)(clingo_location_t const *, char const *, uint64_t const *, size_t, void *, _Bool(*)(uint64_t const *, size_t, void *), void *))_cffi_to_c_pointer(arg3, _cffi_type(483));
+  x3 = (_Bool(*)(clingo_location_t const *, char const *, uint64_t const *, size_t, void *, _Bool(*)(uint64_t const *, size_t, void *), void *))_cffi_to_c_pointer(arg3, _cffi_type(491));
   if (x3 == (_Bool(*)(clingo_location_t const *, char const *, uint64_t const *, size_t, void *, _Bool(*)(uint64_t const *, size_t, void *), void *))NULL && PyErr_Occurred())
     return NULL;
 
@@ -10716,10 +10901,10 @@ _cffi_f_clingo_control_has_const(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(535), arg0, (char **)&x0);
+      _cffi_type(543), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_control_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(535), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(543), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -10808,10 +10993,10 @@ _cffi_f_clingo_control_is_conflicting(PyObject *self, PyObject *arg0)
   PyObject *pyresult;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(535), arg0, (char **)&x0);
+      _cffi_type(543), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_control_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(535), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(543), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -11090,6 +11275,93 @@ _cffi_f_clingo_control_register_backend(PyObject *self, PyObject *args)
 #  define _cffi_f_clingo_control_register_backend _cffi_d_clingo_control_register_backend
 #endif
 
+static _Bool _cffi_d_clingo_control_register_batch_observer(clingo_control_t * x0, clingo_ground_program_observer_t const * x1, clingo_ground_program_batch_observer_t const * x2, size_t x3, _Bool x4, void * x5)
+{
+  return clingo_control_register_batch_observer(x0, x1, x2, x3, x4, x5);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_control_register_batch_observer(PyObject *self, PyObject *args)
+{
+  clingo_control_t * x0;
+  clingo_ground_program_observer_t const * x1;
+  clingo_ground_program_batch_observer_t const * x2;
+  size_t x3;
+  _Bool x4;
+  void * x5;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+  PyObject *arg3;
+  PyObject *arg4;
+  PyObject *arg5;
+
+  if (!PyArg_UnpackTuple(args, "clingo_control_register_batch_observer", 6, 6, &arg0, &arg1, &arg2, &arg3, &arg4, &arg5))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(26), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_control_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(26), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(475), arg1, (char **)&x1);
+  if (datasize != 0) {
+    x1 = ((size_t)datasize) <= 640 ? (clingo_ground_program_observer_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(475), arg1, (char **)&x1,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(482), arg2, (char **)&x2);
+  if (datasize != 0) {
+    x2 = ((size_t)datasize) <= 640 ? (clingo_ground_program_batch_observer_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(482), arg2, (char **)&x2,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x3 = _cffi_to_c_int(arg3, size_t);
+  if (x3 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  x4 = (_Bool)_cffi_to_c__Bool(arg4);
+  if (x4 == (_Bool)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(6), arg5, (char **)&x5);
+  if (datasize != 0) {
+    x5 = ((size_t)datasize) <= 640 ? (void *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(6), arg5, (char **)&x5,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_control_register_batch_observer(x0, x1, x2, x3, x4, x5); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_control_register_batch_observer _cffi_d_clingo_control_register_batch_observer
+#endif
+
 static _Bool _cffi_d_clingo_control_register_observer(clingo_control_t * x0, clingo_ground_program_observer_t const * x1, _Bool x2, void * x3)
 {
   return clingo_control_register_observer(x0, x1, x2, x3);
@@ -11194,10 +11466,10 @@ _cffi_f_clingo_control_register_propagator(PyObject *self, PyObject *args)
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(492), arg1, (char **)&x1);
+      _cffi_type(500), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_propagator_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(492), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(500), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -11468,7 +11740,7 @@ _cffi_f_clingo_control_solve(PyObject *self, PyObject *args)
   if (x3 == (size_t)-1 && PyErr_Occurred())
     return NULL;
 
-  x4 = (_Bool(*)(unsigned int, void *, void *, _Bool *))_cffi_to_c_pointer(arg4, _cffi_type(522));
+  x4 = (_Bool(*)(unsigned int, void *, void *, _Bool *))_cffi_to_c_pointer(arg4, _cffi_type(530));
   if (x4 == (_Bool(*)(unsigned int, void *, void *, _Bool *))NULL && PyErr_Occurred())
     return NULL;
 
@@ -11482,10 +11754,10 @@ _cffi_f_clingo_control_solve(PyObject *self, PyObject *args)
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(524), arg6, (char **)&x6);
+      _cffi_type(532), arg6, (char **)&x6);
   if (datasize != 0) {
     x6 = ((size_t)datasize) <= 640 ? (clingo_solve_handle_t * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(524), arg6, (char **)&x6,
+    if (_cffi_convert_array_argument(_cffi_type(532), arg6, (char **)&x6,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -11526,19 +11798,19 @@ _cffi_f_clingo_control_statistics(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(535), arg0, (char **)&x0);
+      _cffi_type(543), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_control_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(535), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(543), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(549), arg1, (char **)&x1);
+      _cffi_type(557), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_statistics_t const * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(549), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(557), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -11579,19 +11851,19 @@ _cffi_f_clingo_control_symbolic_atoms(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(535), arg0, (char **)&x0);
+      _cffi_type(543), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_control_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(535), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(543), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(553), arg1, (char **)&x1);
+      _cffi_type(561), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(553), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(561), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -11632,19 +11904,19 @@ _cffi_f_clingo_control_theory_atoms(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(535), arg0, (char **)&x0);
+      _cffi_type(543), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_control_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(535), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(543), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(557), arg1, (char **)&x1);
+      _cffi_type(565), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(557), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(565), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -11836,10 +12108,10 @@ _cffi_f_clingo_main(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(1149), arg0, (char **)&x0);
+      _cffi_type(1267), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_application_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(1149), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(1267), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -11904,10 +12176,10 @@ _cffi_f_clingo_model_contains(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(602), arg0, (char **)&x0);
+      _cffi_type(610), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_model_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(602), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(610), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -11961,19 +12233,19 @@ _cffi_f_clingo_model_context(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(602), arg0, (char **)&x0);
+      _cffi_type(610), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_model_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(602), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(610), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(613), arg1, (char **)&x1);
+      _cffi_type(621), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_solve_control_t * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(613), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(621), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -12016,19 +12288,19 @@ _cffi_f_clingo_model_cost(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(602), arg0, (char **)&x0);
+      _cffi_type(610), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_model_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(602), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(610), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(636), arg1, (char **)&x1);
+      _cffi_type(644), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (int64_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(636), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(644), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -12073,10 +12345,10 @@ _cffi_f_clingo_model_cost_size(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(602), arg0, (char **)&x0);
+      _cffi_type(610), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_model_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(602), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(610), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -12128,10 +12400,10 @@ _cffi_f_clingo_model_extend(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(597), arg0, (char **)&x0);
+      _cffi_type(605), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_model_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(597), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(605), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -12187,10 +12459,10 @@ _cffi_f_clingo_model_is_consequence(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(602), arg0, (char **)&x0);
+      _cffi_type(610), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_model_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(602), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(610), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -12246,10 +12518,10 @@ _cffi_f_clingo_model_is_true(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(602), arg0, (char **)&x0);
+      _cffi_type(610), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_model_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(602), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(610), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -12303,10 +12575,10 @@ _cffi_f_clingo_model_number(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(602), arg0, (char **)&x0);
+      _cffi_type(610), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_model_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(602), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(610), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -12356,10 +12628,10 @@ _cffi_f_clingo_model_optimality_proven(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(602), arg0, (char **)&x0);
+      _cffi_type(610), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_model_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(602), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(610), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -12411,10 +12683,10 @@ _cffi_f_clingo_model_priority(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(602), arg0, (char **)&x0);
+      _cffi_type(610), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_model_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(602), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(610), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -12472,10 +12744,10 @@ _cffi_f_clingo_model_symbols(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(602), arg0, (char **)&x0);
+      _cffi_type(610), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_model_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(602), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(610), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -12535,10 +12807,10 @@ _cffi_f_clingo_model_symbols_size(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(602), arg0, (char **)&x0);
+      _cffi_type(610), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_model_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(602), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(610), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -12592,10 +12864,10 @@ _cffi_f_clingo_model_thread_id(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(602), arg0, (char **)&x0);
+      _cffi_type(610), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_model_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(602), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(610), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -12645,10 +12917,10 @@ _cffi_f_clingo_model_type(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(602), arg0, (char **)&x0);
+      _cffi_type(610), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_model_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(602), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(610), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -12710,10 +12982,10 @@ _cffi_f_clingo_options_add(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(668), arg0, (char **)&x0);
+      _cffi_type(676), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_options_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(668), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(676), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -12745,7 +13017,7 @@ _cffi_f_clingo_options_add(PyObject *self, PyObject *args)
       return NULL;
   }
 
-  x4 = (_Bool(*)(char const *, void *))_cffi_to_c_pointer(arg4, _cffi_type(679));
+  x4 = (_Bool(*)(char const *, void *))_cffi_to_c_pointer(arg4, _cffi_type(687));
   if (x4 == (_Bool(*)(char const *, void *))NULL && PyErr_Occurred())
     return NULL;
 
@@ -12813,10 +13085,10 @@ _cffi_f_clingo_options_add_flag(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(668), arg0, (char **)&x0);
+      _cffi_type(676), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_options_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(668), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(676), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -12969,10 +13241,10 @@ _cffi_f_clingo_program_builder_add(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(689), arg0, (char **)&x0);
+      _cffi_type(701), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_program_builder_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(689), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(701), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13016,10 +13288,10 @@ _cffi_f_clingo_program_builder_begin(PyObject *self, PyObject *arg0)
   PyObject *pyresult;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(689), arg0, (char **)&x0);
+      _cffi_type(701), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_program_builder_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(689), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(701), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13054,10 +13326,10 @@ _cffi_f_clingo_program_builder_end(PyObject *self, PyObject *arg0)
   PyObject *pyresult;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(689), arg0, (char **)&x0);
+      _cffi_type(701), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_program_builder_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(689), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(701), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13107,10 +13379,10 @@ _cffi_f_clingo_program_builder_init(PyObject *self, PyObject *args)
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(488), arg1, (char **)&x1);
+      _cffi_type(496), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_program_builder_t * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(488), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(496), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13157,10 +13429,10 @@ _cffi_f_clingo_propagate_control_add_clause(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(696), arg0, (char **)&x0);
+      _cffi_type(708), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_control_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(696), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(708), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13206,6 +13478,93 @@ _cffi_f_clingo_propagate_control_add_clause(PyObject *self, PyObject *args)
 #  define _cffi_f_clingo_propagate_control_add_clause _cffi_d_clingo_propagate_control_add_clause
 #endif
 
+static _Bool _cffi_d_clingo_propagate_control_add_clauses(clingo_propagate_control_t * x0, int32_t const * x1, size_t const * x2, size_t x3, int x4, _Bool * x5)
+{
+  return clingo_propagate_control_add_clauses(x0, x1, x2, x3, x4, x5);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_propagate_control_add_clauses(PyObject *self, PyObject *args)
+{
+  clingo_propagate_control_t * x0;
+  int32_t const * x1;
+  size_t const * x2;
+  size_t x3;
+  int x4;
+  _Bool * x5;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+  PyObject *arg3;
+  PyObject *arg4;
+  PyObject *arg5;
+
+  if (!PyArg_UnpackTuple(args, "clingo_propagate_control_add_clauses", 6, 6, &arg0, &arg1, &arg2, &arg3, &arg4, &arg5))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(708), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_control_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(708), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(4), arg1, (char **)&x1);
+  if (datasize != 0) {
+    x1 = ((size_t)datasize) <= 640 ? (int32_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(4), arg1, (char **)&x1,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(718), arg2, (char **)&x2);
+  if (datasize != 0) {
+    x2 = ((size_t)datasize) <= 640 ? (size_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(718), arg2, (char **)&x2,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x3 = _cffi_to_c_int(arg3, size_t);
+  if (x3 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  x4 = _cffi_to_c_int(arg4, int);
+  if (x4 == (int)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(41), arg5, (char **)&x5);
+  if (datasize != 0) {
+    x5 = ((size_t)datasize) <= 640 ? (_Bool *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(41), arg5, (char **)&x5,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_propagate_control_add_clauses(x0, x1, x2, x3, x4, x5); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_propagate_control_add_clauses _cffi_d_clingo_propagate_control_add_clauses
+#endif
+
 static _Bool _cffi_d_clingo_propagate_control_add_literal(clingo_propagate_control_t * x0, int32_t * x1)
 {
   return clingo_propagate_control_add_literal(x0, x1);
@@ -13227,10 +13586,10 @@ _cffi_f_clingo_propagate_control_add_literal(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(696), arg0, (char **)&x0);
+      _cffi_type(708), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_control_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(696), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(708), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13280,10 +13639,10 @@ _cffi_f_clingo_propagate_control_add_watch(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(696), arg0, (char **)&x0);
+      _cffi_type(708), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_control_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(696), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(708), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13307,6 +13666,65 @@ _cffi_f_clingo_propagate_control_add_watch(PyObject *self, PyObject *args)
 #  define _cffi_f_clingo_propagate_control_add_watch _cffi_d_clingo_propagate_control_add_watch
 #endif
 
+static _Bool _cffi_d_clingo_propagate_control_add_watches(clingo_propagate_control_t * x0, int32_t const * x1, size_t x2)
+{
+  return clingo_propagate_control_add_watches(x0, x1, x2);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_propagate_control_add_watches(PyObject *self, PyObject *args)
+{
+  clingo_propagate_control_t * x0;
+  int32_t const * x1;
+  size_t x2;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+
+  if (!PyArg_UnpackTuple(args, "clingo_propagate_control_add_watches", 3, 3, &arg0, &arg1, &arg2))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(708), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_control_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(708), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(4), arg1, (char **)&x1);
+  if (datasize != 0) {
+    x1 = ((size_t)datasize) <= 640 ? (int32_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(4), arg1, (char **)&x1,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x2 = _cffi_to_c_int(arg2, size_t);
+  if (x2 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_propagate_control_add_watches(x0, x1, x2); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_propagate_control_add_watches _cffi_d_clingo_propagate_control_add_watches
+#endif
+
 static clingo_assignment_t const * _cffi_d_clingo_propagate_control_assignment(clingo_propagate_control_t const * x0)
 {
   return clingo_propagate_control_assignment(x0);
@@ -13322,10 +13740,10 @@ _cffi_f_clingo_propagate_control_assignment(PyObject *self, PyObject *arg0)
   PyObject *pyresult;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(725), arg0, (char **)&x0);
+      _cffi_type(750), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_control_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(725), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(750), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13366,10 +13784,10 @@ _cffi_f_clingo_propagate_control_has_watch(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(725), arg0, (char **)&x0);
+      _cffi_type(750), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_control_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(725), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(750), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13414,10 +13832,10 @@ _cffi_f_clingo_propagate_control_propagate(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(696), arg0, (char **)&x0);
+      _cffi_type(708), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_control_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(696), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(708), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13465,10 +13883,10 @@ _cffi_f_clingo_propagate_control_remove_watch(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(696), arg0, (char **)&x0);
+      _cffi_type(708), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_control_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(696), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(708), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13492,40 +13910,97 @@ _cffi_f_clingo_propagate_control_remove_watch(PyObject *self, PyObject *args)
 #  define _cffi_f_clingo_propagate_control_remove_watch _cffi_d_clingo_propagate_control_remove_watch
 #endif
 
-static uint32_t _cffi_d_clingo_propagate_control_thread_id(clingo_propagate_control_t const * x0)
+static void _cffi_d_clingo_propagate_control_remove_watches(clingo_propagate_control_t * x0, int32_t const * x1, size_t x2)
 {
-  return clingo_propagate_control_thread_id(x0);
+  clingo_propagate_control_remove_watches(x0, x1, x2);
 }
 #ifndef PYPY_VERSION
 static PyObject *
-_cffi_f_clingo_propagate_control_thread_id(PyObject *self, PyObject *arg0)
+_cffi_f_clingo_propagate_control_remove_watches(PyObject *self, PyObject *args)
 {
-  clingo_propagate_control_t const * x0;
+  clingo_propagate_control_t * x0;
+  int32_t const * x1;
+  size_t x2;
   Py_ssize_t datasize;
   struct _cffi_freeme_s *large_args_free = NULL;
-  uint32_t result;
-  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+
+  if (!PyArg_UnpackTuple(args, "clingo_propagate_control_remove_watches", 3, 3, &arg0, &arg1, &arg2))
+    return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(725), arg0, (char **)&x0);
+      _cffi_type(708), arg0, (char **)&x0);
   if (datasize != 0) {
-    x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_control_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(725), arg0, (char **)&x0,
+    x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_control_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(708), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
-  Py_BEGIN_ALLOW_THREADS
-  _cffi_restore_errno();
-  { result = clingo_propagate_control_thread_id(x0); }
-  _cffi_save_errno();
-  Py_END_ALLOW_THREADS
-
-  (void)self; /* unused */
-  pyresult = _cffi_from_c_int(result, uint32_t);
-  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
-  return pyresult;
-}
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(4), arg1, (char **)&x1);
+  if (datasize != 0) {
+    x1 = ((size_t)datasize) <= 640 ? (int32_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(4), arg1, (char **)&x1,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x2 = _cffi_to_c_int(arg2, size_t);
+  if (x2 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { clingo_propagate_control_remove_watches(x0, x1, x2); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+#else
+#  define _cffi_f_clingo_propagate_control_remove_watches _cffi_d_clingo_propagate_control_remove_watches
+#endif
+
+static uint32_t _cffi_d_clingo_propagate_control_thread_id(clingo_propagate_control_t const * x0)
+{
+  return clingo_propagate_control_thread_id(x0);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_propagate_control_thread_id(PyObject *self, PyObject *arg0)
+{
+  clingo_propagate_control_t const * x0;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  uint32_t result;
+  PyObject *pyresult;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(750), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_control_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(750), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_propagate_control_thread_id(x0); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c_int(result, uint32_t);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
 #else
 #  define _cffi_f_clingo_propagate_control_thread_id _cffi_d_clingo_propagate_control_thread_id
 #endif
@@ -13555,10 +14030,10 @@ _cffi_f_clingo_propagate_init_add_clause(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(729), arg0, (char **)&x0);
+      _cffi_type(754), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(729), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(754), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13623,10 +14098,10 @@ _cffi_f_clingo_propagate_init_add_literal(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(729), arg0, (char **)&x0);
+      _cffi_type(754), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(729), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(754), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13684,10 +14159,10 @@ _cffi_f_clingo_propagate_init_add_minimize(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(729), arg0, (char **)&x0);
+      _cffi_type(754), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(729), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(754), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13740,10 +14215,10 @@ _cffi_f_clingo_propagate_init_add_watch(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(729), arg0, (char **)&x0);
+      _cffi_type(754), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(729), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(754), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13790,10 +14265,10 @@ _cffi_f_clingo_propagate_init_add_watch_to_thread(PyObject *self, PyObject *args
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(729), arg0, (char **)&x0);
+      _cffi_type(754), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(729), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(754), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13821,6 +14296,130 @@ _cffi_f_clingo_propagate_init_add_watch_to_thread(PyObject *self, PyObject *args
 #  define _cffi_f_clingo_propagate_init_add_watch_to_thread _cffi_d_clingo_propagate_init_add_watch_to_thread
 #endif
 
+static _Bool _cffi_d_clingo_propagate_init_add_watches(clingo_propagate_init_t * x0, int32_t const * x1, size_t x2)
+{
+  return clingo_propagate_init_add_watches(x0, x1, x2);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_propagate_init_add_watches(PyObject *self, PyObject *args)
+{
+  clingo_propagate_init_t * x0;
+  int32_t const * x1;
+  size_t x2;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+
+  if (!PyArg_UnpackTuple(args, "clingo_propagate_init_add_watches", 3, 3, &arg0, &arg1, &arg2))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(754), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(754), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(4), arg1, (char **)&x1);
+  if (datasize != 0) {
+    x1 = ((size_t)datasize) <= 640 ? (int32_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(4), arg1, (char **)&x1,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x2 = _cffi_to_c_int(arg2, size_t);
+  if (x2 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_propagate_init_add_watches(x0, x1, x2); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_propagate_init_add_watches _cffi_d_clingo_propagate_init_add_watches
+#endif
+
+static _Bool _cffi_d_clingo_propagate_init_add_watches_to_thread(clingo_propagate_init_t * x0, int32_t const * x1, size_t x2, uint32_t x3)
+{
+  return clingo_propagate_init_add_watches_to_thread(x0, x1, x2, x3);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_propagate_init_add_watches_to_thread(PyObject *self, PyObject *args)
+{
+  clingo_propagate_init_t * x0;
+  int32_t const * x1;
+  size_t x2;
+  uint32_t x3;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+  PyObject *arg3;
+
+  if (!PyArg_UnpackTuple(args, "clingo_propagate_init_add_watches_to_thread", 4, 4, &arg0, &arg1, &arg2, &arg3))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(754), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(754), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(4), arg1, (char **)&x1);
+  if (datasize != 0) {
+    x1 = ((size_t)datasize) <= 640 ? (int32_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(4), arg1, (char **)&x1,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x2 = _cffi_to_c_int(arg2, size_t);
+  if (x2 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  x3 = _cffi_to_c_int(arg3, uint32_t);
+  if (x3 == (uint32_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_propagate_init_add_watches_to_thread(x0, x1, x2, x3); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_propagate_init_add_watches_to_thread _cffi_d_clingo_propagate_init_add_watches_to_thread
+#endif
+
 static _Bool _cffi_d_clingo_propagate_init_add_weight_constraint(clingo_propagate_init_t * x0, int32_t x1, clingo_weighted_literal_t const * x2, size_t x3, int32_t x4, int x5, _Bool x6, _Bool * x7)
 {
   return clingo_propagate_init_add_weight_constraint(x0, x1, x2, x3, x4, x5, x6, x7);
@@ -13854,10 +14453,10 @@ _cffi_f_clingo_propagate_init_add_weight_constraint(PyObject *self, PyObject *ar
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(729), arg0, (char **)&x0);
+      _cffi_type(754), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(729), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(754), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13930,10 +14529,10 @@ _cffi_f_clingo_propagate_init_assignment(PyObject *self, PyObject *arg0)
   PyObject *pyresult;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(773), arg0, (char **)&x0);
+      _cffi_type(809), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(773), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(809), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -13974,10 +14573,10 @@ _cffi_f_clingo_propagate_init_freeze_literal(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(729), arg0, (char **)&x0);
+      _cffi_type(754), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(729), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(754), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -14016,10 +14615,10 @@ _cffi_f_clingo_propagate_init_get_check_mode(PyObject *self, PyObject *arg0)
   PyObject *pyresult;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(773), arg0, (char **)&x0);
+      _cffi_type(809), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(773), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(809), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -14054,10 +14653,10 @@ _cffi_f_clingo_propagate_init_get_undo_mode(PyObject *self, PyObject *arg0)
   PyObject *pyresult;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(773), arg0, (char **)&x0);
+      _cffi_type(809), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(773), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(809), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -14092,10 +14691,10 @@ _cffi_f_clingo_propagate_init_number_of_threads(PyObject *self, PyObject *arg0)
   PyObject *pyresult;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(773), arg0, (char **)&x0);
+      _cffi_type(809), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(773), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(809), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -14136,10 +14735,10 @@ _cffi_f_clingo_propagate_init_propagate(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(729), arg0, (char **)&x0);
+      _cffi_type(754), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(729), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(754), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -14189,10 +14788,10 @@ _cffi_f_clingo_propagate_init_remove_watch(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(729), arg0, (char **)&x0);
+      _cffi_type(754), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(729), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(754), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -14239,10 +14838,10 @@ _cffi_f_clingo_propagate_init_remove_watch_from_thread(PyObject *self, PyObject
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(729), arg0, (char **)&x0);
+      _cffi_type(754), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(729), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(754), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -14289,10 +14888,10 @@ _cffi_f_clingo_propagate_init_set_check_mode(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(729), arg0, (char **)&x0);
+      _cffi_type(754), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(729), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(754), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -14335,10 +14934,10 @@ _cffi_f_clingo_propagate_init_set_undo_mode(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(729), arg0, (char **)&x0);
+      _cffi_type(754), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(729), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(754), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -14385,10 +14984,10 @@ _cffi_f_clingo_propagate_init_solver_literal(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(773), arg0, (char **)&x0);
+      _cffi_type(809), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(773), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(809), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -14421,6 +15020,76 @@ _cffi_f_clingo_propagate_init_solver_literal(PyObject *self, PyObject *args)
 #  define _cffi_f_clingo_propagate_init_solver_literal _cffi_d_clingo_propagate_init_solver_literal
 #endif
 
+static _Bool _cffi_d_clingo_propagate_init_solver_literals(clingo_propagate_init_t const * x0, int32_t const * x1, size_t x2, int32_t * x3)
+{
+  return clingo_propagate_init_solver_literals(x0, x1, x2, x3);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_propagate_init_solver_literals(PyObject *self, PyObject *args)
+{
+  clingo_propagate_init_t const * x0;
+  int32_t const * x1;
+  size_t x2;
+  int32_t * x3;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+  PyObject *arg3;
+
+  if (!PyArg_UnpackTuple(args, "clingo_propagate_init_solver_literals", 4, 4, &arg0, &arg1, &arg2, &arg3))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(809), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(809), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(4), arg1, (char **)&x1);
+  if (datasize != 0) {
+    x1 = ((size_t)datasize) <= 640 ? (int32_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(4), arg1, (char **)&x1,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x2 = _cffi_to_c_int(arg2, size_t);
+  if (x2 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(120), arg3, (char **)&x3);
+  if (datasize != 0) {
+    x3 = ((size_t)datasize) <= 640 ? (int32_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(120), arg3, (char **)&x3,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_propagate_init_solver_literals(x0, x1, x2, x3); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_propagate_init_solver_literals _cffi_d_clingo_propagate_init_solver_literals
+#endif
+
 static _Bool _cffi_d_clingo_propagate_init_symbolic_atoms(clingo_propagate_init_t const * x0, clingo_symbolic_atoms_t const * * x1)
 {
   return clingo_propagate_init_symbolic_atoms(x0, x1);
@@ -14442,19 +15111,19 @@ _cffi_f_clingo_propagate_init_symbolic_atoms(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(773), arg0, (char **)&x0);
+      _cffi_type(809), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(773), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(809), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(553), arg1, (char **)&x1);
+      _cffi_type(561), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(553), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(561), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -14495,19 +15164,19 @@ _cffi_f_clingo_propagate_init_theory_atoms(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(773), arg0, (char **)&x0);
+      _cffi_type(809), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_propagate_init_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(773), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(809), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(557), arg1, (char **)&x1);
+      _cffi_type(565), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(557), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(565), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -14993,10 +15662,10 @@ _cffi_f_clingo_solve_control_add_clause(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(786), arg0, (char **)&x0);
+      _cffi_type(832), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_solve_control_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(786), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(832), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -15050,19 +15719,19 @@ _cffi_f_clingo_solve_control_symbolic_atoms(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(791), arg0, (char **)&x0);
+      _cffi_type(837), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_solve_control_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(791), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(837), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(553), arg1, (char **)&x1);
+      _cffi_type(561), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(553), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(561), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -15097,10 +15766,10 @@ _cffi_f_clingo_solve_handle_cancel(PyObject *self, PyObject *arg0)
   PyObject *pyresult;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(795), arg0, (char **)&x0);
+      _cffi_type(841), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_solve_handle_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(795), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(841), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -15135,10 +15804,10 @@ _cffi_f_clingo_solve_handle_close(PyObject *self, PyObject *arg0)
   PyObject *pyresult;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(795), arg0, (char **)&x0);
+      _cffi_type(841), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_solve_handle_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(795), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(841), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -15181,19 +15850,19 @@ _cffi_f_clingo_solve_handle_core(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(795), arg0, (char **)&x0);
+      _cffi_type(841), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_solve_handle_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(795), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(841), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(803), arg1, (char **)&x1);
+      _cffi_type(849), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (int32_t const * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(803), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(849), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -15243,10 +15912,10 @@ _cffi_f_clingo_solve_handle_get(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(795), arg0, (char **)&x0);
+      _cffi_type(841), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_solve_handle_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(795), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(841), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -15296,19 +15965,19 @@ _cffi_f_clingo_solve_handle_last(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(795), arg0, (char **)&x0);
+      _cffi_type(841), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_solve_handle_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(795), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(841), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(799), arg1, (char **)&x1);
+      _cffi_type(845), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_model_t const * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(799), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(845), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -15349,19 +16018,19 @@ _cffi_f_clingo_solve_handle_model(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(795), arg0, (char **)&x0);
+      _cffi_type(841), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_solve_handle_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(795), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(841), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(799), arg1, (char **)&x1);
+      _cffi_type(845), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_model_t const * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(799), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(845), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -15396,10 +16065,10 @@ _cffi_f_clingo_solve_handle_resume(PyObject *self, PyObject *arg0)
   PyObject *pyresult;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(795), arg0, (char **)&x0);
+      _cffi_type(841), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_solve_handle_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(795), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(841), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -15440,10 +16109,10 @@ _cffi_f_clingo_solve_handle_wait(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(795), arg0, (char **)&x0);
+      _cffi_type(841), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_solve_handle_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(795), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(841), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -15501,10 +16170,10 @@ _cffi_f_clingo_statistics_array_at(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(829), arg0, (char **)&x0);
+      _cffi_type(875), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_statistics_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(829), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(875), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -15566,10 +16235,10 @@ _cffi_f_clingo_statistics_array_push(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(811), arg0, (char **)&x0);
+      _cffi_type(857), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_statistics_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(811), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(857), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -15629,10 +16298,10 @@ _cffi_f_clingo_statistics_array_size(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(829), arg0, (char **)&x0);
+      _cffi_type(875), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_statistics_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(829), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(875), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -15692,10 +16361,10 @@ _cffi_f_clingo_statistics_map_add_subkey(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(811), arg0, (char **)&x0);
+      _cffi_type(857), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_statistics_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(811), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(857), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -15766,10 +16435,10 @@ _cffi_f_clingo_statistics_map_at(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(829), arg0, (char **)&x0);
+      _cffi_type(875), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_statistics_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(829), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(875), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -15836,10 +16505,10 @@ _cffi_f_clingo_statistics_map_has_subkey(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(829), arg0, (char **)&x0);
+      _cffi_type(875), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_statistics_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(829), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(875), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -15904,10 +16573,10 @@ _cffi_f_clingo_statistics_map_size(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(829), arg0, (char **)&x0);
+      _cffi_type(875), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_statistics_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(829), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(875), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -15965,10 +16634,10 @@ _cffi_f_clingo_statistics_map_subkey_name(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(829), arg0, (char **)&x0);
+      _cffi_type(875), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_statistics_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(829), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(875), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -16026,10 +16695,10 @@ _cffi_f_clingo_statistics_root(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(829), arg0, (char **)&x0);
+      _cffi_type(875), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_statistics_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(829), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(875), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -16058,17 +16727,18 @@ _cffi_f_clingo_statistics_root(PyObject *self, PyObject *args)
 #  define _cffi_f_clingo_statistics_root _cffi_d_clingo_statistics_root
 #endif
 
-static _Bool _cffi_d_clingo_statistics_type(clingo_statistics_t const * x0, uint64_t x1, int * x2)
+static _Bool _cffi_d_clingo_statistics_to_json(clingo_statistics_t const * x0, uint64_t x1, char * x2, size_t x3)
 {
-  return clingo_statistics_type(x0, x1, x2);
+  return clingo_statistics_to_json(x0, x1, x2, x3);
 }
 #ifndef PYPY_VERSION
 static PyObject *
-_cffi_f_clingo_statistics_type(PyObject *self, PyObject *args)
+_cffi_f_clingo_statistics_to_json(PyObject *self, PyObject *args)
 {
   clingo_statistics_t const * x0;
   uint64_t x1;
-  int * x2;
+  char * x2;
+  size_t x3;
   Py_ssize_t datasize;
   struct _cffi_freeme_s *large_args_free = NULL;
   _Bool result;
@@ -16076,15 +16746,16 @@ _cffi_f_clingo_statistics_type(PyObject *self, PyObject *args)
   PyObject *arg0;
   PyObject *arg1;
   PyObject *arg2;
+  PyObject *arg3;
 
-  if (!PyArg_UnpackTuple(args, "clingo_statistics_type", 3, 3, &arg0, &arg1, &arg2))
+  if (!PyArg_UnpackTuple(args, "clingo_statistics_to_json", 4, 4, &arg0, &arg1, &arg2, &arg3))
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(829), arg0, (char **)&x0);
+      _cffi_type(875), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_statistics_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(829), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(875), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -16094,17 +16765,21 @@ _cffi_f_clingo_statistics_type(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(110), arg2, (char **)&x2);
+      _cffi_type(138), arg2, (char **)&x2);
   if (datasize != 0) {
-    x2 = ((size_t)datasize) <= 640 ? (int *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(110), arg2, (char **)&x2,
+    x2 = ((size_t)datasize) <= 640 ? (char *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(138), arg2, (char **)&x2,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
+  x3 = _cffi_to_c_int(arg3, size_t);
+  if (x3 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
   Py_BEGIN_ALLOW_THREADS
   _cffi_restore_errno();
-  { result = clingo_statistics_type(x0, x1, x2); }
+  { result = clingo_statistics_to_json(x0, x1, x2, x3); }
   _cffi_save_errno();
   Py_END_ALLOW_THREADS
 
@@ -16114,20 +16789,20 @@ _cffi_f_clingo_statistics_type(PyObject *self, PyObject *args)
   return pyresult;
 }
 #else
-#  define _cffi_f_clingo_statistics_type _cffi_d_clingo_statistics_type
+#  define _cffi_f_clingo_statistics_to_json _cffi_d_clingo_statistics_to_json
 #endif
 
-static _Bool _cffi_d_clingo_statistics_value_get(clingo_statistics_t const * x0, uint64_t x1, double * x2)
+static _Bool _cffi_d_clingo_statistics_to_json_size(clingo_statistics_t const * x0, uint64_t x1, size_t * x2)
 {
-  return clingo_statistics_value_get(x0, x1, x2);
+  return clingo_statistics_to_json_size(x0, x1, x2);
 }
 #ifndef PYPY_VERSION
 static PyObject *
-_cffi_f_clingo_statistics_value_get(PyObject *self, PyObject *args)
+_cffi_f_clingo_statistics_to_json_size(PyObject *self, PyObject *args)
 {
   clingo_statistics_t const * x0;
   uint64_t x1;
-  double * x2;
+  size_t * x2;
   Py_ssize_t datasize;
   struct _cffi_freeme_s *large_args_free = NULL;
   _Bool result;
@@ -16136,14 +16811,14 @@ _cffi_f_clingo_statistics_value_get(PyObject *self, PyObject *args)
   PyObject *arg1;
   PyObject *arg2;
 
-  if (!PyArg_UnpackTuple(args, "clingo_statistics_value_get", 3, 3, &arg0, &arg1, &arg2))
+  if (!PyArg_UnpackTuple(args, "clingo_statistics_to_json_size", 3, 3, &arg0, &arg1, &arg2))
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(829), arg0, (char **)&x0);
+      _cffi_type(875), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_statistics_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(829), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(875), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -16153,17 +16828,17 @@ _cffi_f_clingo_statistics_value_get(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(847), arg2, (char **)&x2);
+      _cffi_type(207), arg2, (char **)&x2);
   if (datasize != 0) {
-    x2 = ((size_t)datasize) <= 640 ? (double *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(847), arg2, (char **)&x2,
+    x2 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(207), arg2, (char **)&x2,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   Py_BEGIN_ALLOW_THREADS
   _cffi_restore_errno();
-  { result = clingo_statistics_value_get(x0, x1, x2); }
+  { result = clingo_statistics_to_json_size(x0, x1, x2); }
   _cffi_save_errno();
   Py_END_ALLOW_THREADS
 
@@ -16173,10 +16848,128 @@ _cffi_f_clingo_statistics_value_get(PyObject *self, PyObject *args)
   return pyresult;
 }
 #else
-#  define _cffi_f_clingo_statistics_value_get _cffi_d_clingo_statistics_value_get
+#  define _cffi_f_clingo_statistics_to_json_size _cffi_d_clingo_statistics_to_json_size
 #endif
 
-static _Bool _cffi_d_clingo_statistics_value_set(clingo_statistics_t * x0, uint64_t x1, double x2)
+static _Bool _cffi_d_clingo_statistics_type(clingo_statistics_t const * x0, uint64_t x1, int * x2)
+{
+  return clingo_statistics_type(x0, x1, x2);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_statistics_type(PyObject *self, PyObject *args)
+{
+  clingo_statistics_t const * x0;
+  uint64_t x1;
+  int * x2;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+
+  if (!PyArg_UnpackTuple(args, "clingo_statistics_type", 3, 3, &arg0, &arg1, &arg2))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(875), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_statistics_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(875), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x1 = _cffi_to_c_int(arg1, uint64_t);
+  if (x1 == (uint64_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(110), arg2, (char **)&x2);
+  if (datasize != 0) {
+    x2 = ((size_t)datasize) <= 640 ? (int *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(110), arg2, (char **)&x2,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_statistics_type(x0, x1, x2); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_statistics_type _cffi_d_clingo_statistics_type
+#endif
+
+static _Bool _cffi_d_clingo_statistics_value_get(clingo_statistics_t const * x0, uint64_t x1, double * x2)
+{
+  return clingo_statistics_value_get(x0, x1, x2);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_statistics_value_get(PyObject *self, PyObject *args)
+{
+  clingo_statistics_t const * x0;
+  uint64_t x1;
+  double * x2;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+
+  if (!PyArg_UnpackTuple(args, "clingo_statistics_value_get", 3, 3, &arg0, &arg1, &arg2))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(875), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_statistics_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(875), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x1 = _cffi_to_c_int(arg1, uint64_t);
+  if (x1 == (uint64_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(899), arg2, (char **)&x2);
+  if (datasize != 0) {
+    x2 = ((size_t)datasize) <= 640 ? (double *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(899), arg2, (char **)&x2,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_statistics_value_get(x0, x1, x2); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_statistics_value_get _cffi_d_clingo_statistics_value_get
+#endif
+
+static _Bool _cffi_d_clingo_statistics_value_set(clingo_statistics_t * x0, uint64_t x1, double x2)
 {
   return clingo_statistics_value_set(x0, x1, x2);
 }
@@ -16199,10 +16992,10 @@ _cffi_f_clingo_statistics_value_set(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(811), arg0, (char **)&x0);
+      _cffi_type(857), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_statistics_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(811), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(857), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -16257,10 +17050,10 @@ _cffi_f_clingo_symbol_arguments(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(1094), arg1, (char **)&x1);
+      _cffi_type(1212), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (uint64_t const * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(1094), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(1212), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -16945,6 +17738,54 @@ _cffi_f_clingo_symbol_string(PyObject *self, PyObject *args)
 #  define _cffi_f_clingo_symbol_string _cffi_d_clingo_symbol_string
 #endif
 
+static _Bool _cffi_d_clingo_symbol_to_cached_string(uint64_t x0, char const * * x1)
+{
+  return clingo_symbol_to_cached_string(x0, x1);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_symbol_to_cached_string(PyObject *self, PyObject *args)
+{
+  uint64_t x0;
+  char const * * x1;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+
+  if (!PyArg_UnpackTuple(args, "clingo_symbol_to_cached_string", 2, 2, &arg0, &arg1))
+    return NULL;
+
+  x0 = _cffi_to_c_int(arg0, uint64_t);
+  if (x0 == (uint64_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(60), arg1, (char **)&x1);
+  if (datasize != 0) {
+    x1 = ((size_t)datasize) <= 640 ? (char const * *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(60), arg1, (char **)&x1,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_symbol_to_cached_string(x0, x1); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_symbol_to_cached_string _cffi_d_clingo_symbol_to_cached_string
+#endif
+
 static _Bool _cffi_d_clingo_symbol_to_string(uint64_t x0, char * x1, size_t x2)
 {
   return clingo_symbol_to_string(x0, x1, x2);
@@ -17100,10 +17941,10 @@ _cffi_f_clingo_symbolic_atoms_begin(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(872), arg0, (char **)&x0);
+      _cffi_type(924), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(872), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(924), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -17162,10 +18003,10 @@ _cffi_f_clingo_symbolic_atoms_end(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(872), arg0, (char **)&x0);
+      _cffi_type(924), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(872), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(924), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -17194,17 +18035,22 @@ _cffi_f_clingo_symbolic_atoms_end(PyObject *self, PyObject *args)
 #  define _cffi_f_clingo_symbolic_atoms_end _cffi_d_clingo_symbolic_atoms_end
 #endif
 
-static _Bool _cffi_d_clingo_symbolic_atoms_find(clingo_symbolic_atoms_t const * x0, uint64_t x1, uint64_t * x2)
+static _Bool _cffi_d_clingo_symbolic_atoms_fetch(clingo_symbolic_atoms_t const * x0, uint64_t x1, size_t x2, uint64_t * x3, int32_t * x4, _Bool * x5, _Bool * x6, size_t x7)
 {
-  return clingo_symbolic_atoms_find(x0, x1, x2);
+  return clingo_symbolic_atoms_fetch(x0, x1, x2, x3, x4, x5, x6, x7);
 }
 #ifndef PYPY_VERSION
 static PyObject *
-_cffi_f_clingo_symbolic_atoms_find(PyObject *self, PyObject *args)
+_cffi_f_clingo_symbolic_atoms_fetch(PyObject *self, PyObject *args)
 {
   clingo_symbolic_atoms_t const * x0;
   uint64_t x1;
-  uint64_t * x2;
+  size_t x2;
+  uint64_t * x3;
+  int32_t * x4;
+  _Bool * x5;
+  _Bool * x6;
+  size_t x7;
   Py_ssize_t datasize;
   struct _cffi_freeme_s *large_args_free = NULL;
   _Bool result;
@@ -17212,15 +18058,20 @@ _cffi_f_clingo_symbolic_atoms_find(PyObject *self, PyObject *args)
   PyObject *arg0;
   PyObject *arg1;
   PyObject *arg2;
+  PyObject *arg3;
+  PyObject *arg4;
+  PyObject *arg5;
+  PyObject *arg6;
+  PyObject *arg7;
 
-  if (!PyArg_UnpackTuple(args, "clingo_symbolic_atoms_find", 3, 3, &arg0, &arg1, &arg2))
+  if (!PyArg_UnpackTuple(args, "clingo_symbolic_atoms_fetch", 8, 8, &arg0, &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7))
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(872), arg0, (char **)&x0);
+      _cffi_type(924), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(872), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(924), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -17229,18 +18080,53 @@ _cffi_f_clingo_symbolic_atoms_find(PyObject *self, PyObject *args)
   if (x1 == (uint64_t)-1 && PyErr_Occurred())
     return NULL;
 
+  x2 = _cffi_to_c_int(arg2, size_t);
+  if (x2 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(56), arg2, (char **)&x2);
+      _cffi_type(56), arg3, (char **)&x3);
   if (datasize != 0) {
-    x2 = ((size_t)datasize) <= 640 ? (uint64_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(56), arg2, (char **)&x2,
+    x3 = ((size_t)datasize) <= 640 ? (uint64_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(56), arg3, (char **)&x3,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(120), arg4, (char **)&x4);
+  if (datasize != 0) {
+    x4 = ((size_t)datasize) <= 640 ? (int32_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(120), arg4, (char **)&x4,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(41), arg5, (char **)&x5);
+  if (datasize != 0) {
+    x5 = ((size_t)datasize) <= 640 ? (_Bool *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(41), arg5, (char **)&x5,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(41), arg6, (char **)&x6);
+  if (datasize != 0) {
+    x6 = ((size_t)datasize) <= 640 ? (_Bool *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(41), arg6, (char **)&x6,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
+  x7 = _cffi_to_c_int(arg7, size_t);
+  if (x7 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
   Py_BEGIN_ALLOW_THREADS
   _cffi_restore_errno();
-  { result = clingo_symbolic_atoms_find(x0, x1, x2); }
+  { result = clingo_symbolic_atoms_fetch(x0, x1, x2, x3, x4, x5, x6, x7); }
   _cffi_save_errno();
   Py_END_ALLOW_THREADS
 
@@ -17250,20 +18136,20 @@ _cffi_f_clingo_symbolic_atoms_find(PyObject *self, PyObject *args)
   return pyresult;
 }
 #else
-#  define _cffi_f_clingo_symbolic_atoms_find _cffi_d_clingo_symbolic_atoms_find
+#  define _cffi_f_clingo_symbolic_atoms_fetch _cffi_d_clingo_symbolic_atoms_fetch
 #endif
 
-static _Bool _cffi_d_clingo_symbolic_atoms_is_external(clingo_symbolic_atoms_t const * x0, uint64_t x1, _Bool * x2)
+static _Bool _cffi_d_clingo_symbolic_atoms_find(clingo_symbolic_atoms_t const * x0, uint64_t x1, uint64_t * x2)
 {
-  return clingo_symbolic_atoms_is_external(x0, x1, x2);
+  return clingo_symbolic_atoms_find(x0, x1, x2);
 }
 #ifndef PYPY_VERSION
 static PyObject *
-_cffi_f_clingo_symbolic_atoms_is_external(PyObject *self, PyObject *args)
+_cffi_f_clingo_symbolic_atoms_find(PyObject *self, PyObject *args)
 {
   clingo_symbolic_atoms_t const * x0;
   uint64_t x1;
-  _Bool * x2;
+  uint64_t * x2;
   Py_ssize_t datasize;
   struct _cffi_freeme_s *large_args_free = NULL;
   _Bool result;
@@ -17272,14 +18158,14 @@ _cffi_f_clingo_symbolic_atoms_is_external(PyObject *self, PyObject *args)
   PyObject *arg1;
   PyObject *arg2;
 
-  if (!PyArg_UnpackTuple(args, "clingo_symbolic_atoms_is_external", 3, 3, &arg0, &arg1, &arg2))
+  if (!PyArg_UnpackTuple(args, "clingo_symbolic_atoms_find", 3, 3, &arg0, &arg1, &arg2))
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(872), arg0, (char **)&x0);
+      _cffi_type(924), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(872), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(924), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -17289,17 +18175,17 @@ _cffi_f_clingo_symbolic_atoms_is_external(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(41), arg2, (char **)&x2);
+      _cffi_type(56), arg2, (char **)&x2);
   if (datasize != 0) {
-    x2 = ((size_t)datasize) <= 640 ? (_Bool *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(41), arg2, (char **)&x2,
+    x2 = ((size_t)datasize) <= 640 ? (uint64_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(56), arg2, (char **)&x2,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   Py_BEGIN_ALLOW_THREADS
   _cffi_restore_errno();
-  { result = clingo_symbolic_atoms_is_external(x0, x1, x2); }
+  { result = clingo_symbolic_atoms_find(x0, x1, x2); }
   _cffi_save_errno();
   Py_END_ALLOW_THREADS
 
@@ -17309,20 +18195,25 @@ _cffi_f_clingo_symbolic_atoms_is_external(PyObject *self, PyObject *args)
   return pyresult;
 }
 #else
-#  define _cffi_f_clingo_symbolic_atoms_is_external _cffi_d_clingo_symbolic_atoms_is_external
+#  define _cffi_f_clingo_symbolic_atoms_find _cffi_d_clingo_symbolic_atoms_find
 #endif
 
-static _Bool _cffi_d_clingo_symbolic_atoms_is_fact(clingo_symbolic_atoms_t const * x0, uint64_t x1, _Bool * x2)
+static _Bool _cffi_d_clingo_symbolic_atoms_find_pattern(clingo_symbolic_atoms_t const * x0, uint64_t x1, size_t const * x2, uint64_t const * x3, size_t x4, uint64_t * x5, size_t x6, size_t * x7)
 {
-  return clingo_symbolic_atoms_is_fact(x0, x1, x2);
+  return clingo_symbolic_atoms_find_pattern(x0, x1, x2, x3, x4, x5, x6, x7);
 }
 #ifndef PYPY_VERSION
 static PyObject *
-_cffi_f_clingo_symbolic_atoms_is_fact(PyObject *self, PyObject *args)
+_cffi_f_clingo_symbolic_atoms_find_pattern(PyObject *self, PyObject *args)
 {
   clingo_symbolic_atoms_t const * x0;
   uint64_t x1;
-  _Bool * x2;
+  size_t const * x2;
+  uint64_t const * x3;
+  size_t x4;
+  uint64_t * x5;
+  size_t x6;
+  size_t * x7;
   Py_ssize_t datasize;
   struct _cffi_freeme_s *large_args_free = NULL;
   _Bool result;
@@ -17330,15 +18221,20 @@ _cffi_f_clingo_symbolic_atoms_is_fact(PyObject *self, PyObject *args)
   PyObject *arg0;
   PyObject *arg1;
   PyObject *arg2;
+  PyObject *arg3;
+  PyObject *arg4;
+  PyObject *arg5;
+  PyObject *arg6;
+  PyObject *arg7;
 
-  if (!PyArg_UnpackTuple(args, "clingo_symbolic_atoms_is_fact", 3, 3, &arg0, &arg1, &arg2))
+  if (!PyArg_UnpackTuple(args, "clingo_symbolic_atoms_find_pattern", 8, 8, &arg0, &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7))
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(872), arg0, (char **)&x0);
+      _cffi_type(924), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(872), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(924), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -17348,30 +18244,183 @@ _cffi_f_clingo_symbolic_atoms_is_fact(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(41), arg2, (char **)&x2);
+      _cffi_type(718), arg2, (char **)&x2);
   if (datasize != 0) {
-    x2 = ((size_t)datasize) <= 640 ? (_Bool *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(41), arg2, (char **)&x2,
+    x2 = ((size_t)datasize) <= 640 ? (size_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(718), arg2, (char **)&x2,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
-  Py_BEGIN_ALLOW_THREADS
-  _cffi_restore_errno();
-  { result = clingo_symbolic_atoms_is_fact(x0, x1, x2); }
-  _cffi_save_errno();
-  Py_END_ALLOW_THREADS
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(79), arg3, (char **)&x3);
+  if (datasize != 0) {
+    x3 = ((size_t)datasize) <= 640 ? (uint64_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(79), arg3, (char **)&x3,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
 
-  (void)self; /* unused */
-  pyresult = _cffi_from_c__Bool(result);
-  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
-  return pyresult;
-}
-#else
-#  define _cffi_f_clingo_symbolic_atoms_is_fact _cffi_d_clingo_symbolic_atoms_is_fact
-#endif
+  x4 = _cffi_to_c_int(arg4, size_t);
+  if (x4 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
 
-static _Bool _cffi_d_clingo_symbolic_atoms_is_valid(clingo_symbolic_atoms_t const * x0, uint64_t x1, _Bool * x2)
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(56), arg5, (char **)&x5);
+  if (datasize != 0) {
+    x5 = ((size_t)datasize) <= 640 ? (uint64_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(56), arg5, (char **)&x5,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x6 = _cffi_to_c_int(arg6, size_t);
+  if (x6 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(207), arg7, (char **)&x7);
+  if (datasize != 0) {
+    x7 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(207), arg7, (char **)&x7,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_symbolic_atoms_find_pattern(x0, x1, x2, x3, x4, x5, x6, x7); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_symbolic_atoms_find_pattern _cffi_d_clingo_symbolic_atoms_find_pattern
+#endif
+
+static _Bool _cffi_d_clingo_symbolic_atoms_is_external(clingo_symbolic_atoms_t const * x0, uint64_t x1, _Bool * x2)
+{
+  return clingo_symbolic_atoms_is_external(x0, x1, x2);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_symbolic_atoms_is_external(PyObject *self, PyObject *args)
+{
+  clingo_symbolic_atoms_t const * x0;
+  uint64_t x1;
+  _Bool * x2;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+
+  if (!PyArg_UnpackTuple(args, "clingo_symbolic_atoms_is_external", 3, 3, &arg0, &arg1, &arg2))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(924), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(924), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x1 = _cffi_to_c_int(arg1, uint64_t);
+  if (x1 == (uint64_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(41), arg2, (char **)&x2);
+  if (datasize != 0) {
+    x2 = ((size_t)datasize) <= 640 ? (_Bool *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(41), arg2, (char **)&x2,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_symbolic_atoms_is_external(x0, x1, x2); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_symbolic_atoms_is_external _cffi_d_clingo_symbolic_atoms_is_external
+#endif
+
+static _Bool _cffi_d_clingo_symbolic_atoms_is_fact(clingo_symbolic_atoms_t const * x0, uint64_t x1, _Bool * x2)
+{
+  return clingo_symbolic_atoms_is_fact(x0, x1, x2);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_symbolic_atoms_is_fact(PyObject *self, PyObject *args)
+{
+  clingo_symbolic_atoms_t const * x0;
+  uint64_t x1;
+  _Bool * x2;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+
+  if (!PyArg_UnpackTuple(args, "clingo_symbolic_atoms_is_fact", 3, 3, &arg0, &arg1, &arg2))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(924), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(924), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x1 = _cffi_to_c_int(arg1, uint64_t);
+  if (x1 == (uint64_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(41), arg2, (char **)&x2);
+  if (datasize != 0) {
+    x2 = ((size_t)datasize) <= 640 ? (_Bool *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(41), arg2, (char **)&x2,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_symbolic_atoms_is_fact(x0, x1, x2); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_symbolic_atoms_is_fact _cffi_d_clingo_symbolic_atoms_is_fact
+#endif
+
+static _Bool _cffi_d_clingo_symbolic_atoms_is_valid(clingo_symbolic_atoms_t const * x0, uint64_t x1, _Bool * x2)
 {
   return clingo_symbolic_atoms_is_valid(x0, x1, x2);
 }
@@ -17394,10 +18443,10 @@ _cffi_f_clingo_symbolic_atoms_is_valid(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(872), arg0, (char **)&x0);
+      _cffi_type(924), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(872), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(924), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -17455,10 +18504,10 @@ _cffi_f_clingo_symbolic_atoms_iterator_is_equal_to(PyObject *self, PyObject *arg
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(872), arg0, (char **)&x0);
+      _cffi_type(924), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(872), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(924), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -17518,10 +18567,10 @@ _cffi_f_clingo_symbolic_atoms_literal(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(872), arg0, (char **)&x0);
+      _cffi_type(924), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(872), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(924), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -17577,10 +18626,10 @@ _cffi_f_clingo_symbolic_atoms_next(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(872), arg0, (char **)&x0);
+      _cffi_type(924), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(872), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(924), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -17613,6 +18662,65 @@ _cffi_f_clingo_symbolic_atoms_next(PyObject *self, PyObject *args)
 #  define _cffi_f_clingo_symbolic_atoms_next _cffi_d_clingo_symbolic_atoms_next
 #endif
 
+static _Bool _cffi_d_clingo_symbolic_atoms_signature_size(clingo_symbolic_atoms_t const * x0, uint64_t x1, size_t * x2)
+{
+  return clingo_symbolic_atoms_signature_size(x0, x1, x2);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_symbolic_atoms_signature_size(PyObject *self, PyObject *args)
+{
+  clingo_symbolic_atoms_t const * x0;
+  uint64_t x1;
+  size_t * x2;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+
+  if (!PyArg_UnpackTuple(args, "clingo_symbolic_atoms_signature_size", 3, 3, &arg0, &arg1, &arg2))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(924), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(924), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x1 = _cffi_to_c_int(arg1, uint64_t);
+  if (x1 == (uint64_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(207), arg2, (char **)&x2);
+  if (datasize != 0) {
+    x2 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(207), arg2, (char **)&x2,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_symbolic_atoms_signature_size(x0, x1, x2); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_symbolic_atoms_signature_size _cffi_d_clingo_symbolic_atoms_signature_size
+#endif
+
 static _Bool _cffi_d_clingo_symbolic_atoms_signatures(clingo_symbolic_atoms_t const * x0, uint64_t * x1, size_t x2)
 {
   return clingo_symbolic_atoms_signatures(x0, x1, x2);
@@ -17636,10 +18744,10 @@ _cffi_f_clingo_symbolic_atoms_signatures(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(872), arg0, (char **)&x0);
+      _cffi_type(924), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(872), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(924), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -17693,10 +18801,10 @@ _cffi_f_clingo_symbolic_atoms_signatures_size(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(872), arg0, (char **)&x0);
+      _cffi_type(924), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(872), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(924), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -17746,10 +18854,10 @@ _cffi_f_clingo_symbolic_atoms_size(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(872), arg0, (char **)&x0);
+      _cffi_type(924), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(872), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(924), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -17801,10 +18909,10 @@ _cffi_f_clingo_symbolic_atoms_symbol(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(872), arg0, (char **)&x0);
+      _cffi_type(924), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_symbolic_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(872), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(924), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -17862,10 +18970,10 @@ _cffi_f_clingo_theory_atoms_atom_elements(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -17875,10 +18983,10 @@ _cffi_f_clingo_theory_atoms_atom_elements(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(965), arg2, (char **)&x2);
+      _cffi_type(1075), arg2, (char **)&x2);
   if (datasize != 0) {
     x2 = ((size_t)datasize) <= 640 ? (uint32_t const * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(965), arg2, (char **)&x2,
+    if (_cffi_convert_array_argument(_cffi_type(1075), arg2, (char **)&x2,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -17932,10 +19040,10 @@ _cffi_f_clingo_theory_atoms_atom_guard(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18000,10 +19108,10 @@ _cffi_f_clingo_theory_atoms_atom_has_guard(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18059,10 +19167,10 @@ _cffi_f_clingo_theory_atoms_atom_literal(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18118,10 +19226,10 @@ _cffi_f_clingo_theory_atoms_atom_term(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18179,10 +19287,10 @@ _cffi_f_clingo_theory_atoms_atom_to_string(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18242,10 +19350,10 @@ _cffi_f_clingo_theory_atoms_atom_to_string_size(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18265,7 +19373,454 @@ _cffi_f_clingo_theory_atoms_atom_to_string_size(PyObject *self, PyObject *args)
 
   Py_BEGIN_ALLOW_THREADS
   _cffi_restore_errno();
-  { result = clingo_theory_atoms_atom_to_string_size(x0, x1, x2); }
+  { result = clingo_theory_atoms_atom_to_string_size(x0, x1, x2); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_theory_atoms_atom_to_string_size _cffi_d_clingo_theory_atoms_atom_to_string_size
+#endif
+
+static _Bool _cffi_d_clingo_theory_atoms_element_condition(clingo_theory_atoms_t const * x0, uint32_t x1, int32_t const * * x2, size_t * x3)
+{
+  return clingo_theory_atoms_element_condition(x0, x1, x2, x3);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_theory_atoms_element_condition(PyObject *self, PyObject *args)
+{
+  clingo_theory_atoms_t const * x0;
+  uint32_t x1;
+  int32_t const * * x2;
+  size_t * x3;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+  PyObject *arg3;
+
+  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_element_condition", 4, 4, &arg0, &arg1, &arg2, &arg3))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(988), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x1 = _cffi_to_c_int(arg1, uint32_t);
+  if (x1 == (uint32_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(849), arg2, (char **)&x2);
+  if (datasize != 0) {
+    x2 = ((size_t)datasize) <= 640 ? (int32_t const * *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(849), arg2, (char **)&x2,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(207), arg3, (char **)&x3);
+  if (datasize != 0) {
+    x3 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(207), arg3, (char **)&x3,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_theory_atoms_element_condition(x0, x1, x2, x3); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_theory_atoms_element_condition _cffi_d_clingo_theory_atoms_element_condition
+#endif
+
+static _Bool _cffi_d_clingo_theory_atoms_element_condition_id(clingo_theory_atoms_t const * x0, uint32_t x1, int32_t * x2)
+{
+  return clingo_theory_atoms_element_condition_id(x0, x1, x2);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_theory_atoms_element_condition_id(PyObject *self, PyObject *args)
+{
+  clingo_theory_atoms_t const * x0;
+  uint32_t x1;
+  int32_t * x2;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+
+  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_element_condition_id", 3, 3, &arg0, &arg1, &arg2))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(988), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x1 = _cffi_to_c_int(arg1, uint32_t);
+  if (x1 == (uint32_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(120), arg2, (char **)&x2);
+  if (datasize != 0) {
+    x2 = ((size_t)datasize) <= 640 ? (int32_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(120), arg2, (char **)&x2,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_theory_atoms_element_condition_id(x0, x1, x2); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_theory_atoms_element_condition_id _cffi_d_clingo_theory_atoms_element_condition_id
+#endif
+
+static _Bool _cffi_d_clingo_theory_atoms_element_to_string(clingo_theory_atoms_t const * x0, uint32_t x1, char * x2, size_t x3)
+{
+  return clingo_theory_atoms_element_to_string(x0, x1, x2, x3);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_theory_atoms_element_to_string(PyObject *self, PyObject *args)
+{
+  clingo_theory_atoms_t const * x0;
+  uint32_t x1;
+  char * x2;
+  size_t x3;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+  PyObject *arg3;
+
+  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_element_to_string", 4, 4, &arg0, &arg1, &arg2, &arg3))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(988), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x1 = _cffi_to_c_int(arg1, uint32_t);
+  if (x1 == (uint32_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(138), arg2, (char **)&x2);
+  if (datasize != 0) {
+    x2 = ((size_t)datasize) <= 640 ? (char *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(138), arg2, (char **)&x2,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x3 = _cffi_to_c_int(arg3, size_t);
+  if (x3 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_theory_atoms_element_to_string(x0, x1, x2, x3); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_theory_atoms_element_to_string _cffi_d_clingo_theory_atoms_element_to_string
+#endif
+
+static _Bool _cffi_d_clingo_theory_atoms_element_to_string_size(clingo_theory_atoms_t const * x0, uint32_t x1, size_t * x2)
+{
+  return clingo_theory_atoms_element_to_string_size(x0, x1, x2);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_theory_atoms_element_to_string_size(PyObject *self, PyObject *args)
+{
+  clingo_theory_atoms_t const * x0;
+  uint32_t x1;
+  size_t * x2;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+
+  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_element_to_string_size", 3, 3, &arg0, &arg1, &arg2))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(988), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x1 = _cffi_to_c_int(arg1, uint32_t);
+  if (x1 == (uint32_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(207), arg2, (char **)&x2);
+  if (datasize != 0) {
+    x2 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(207), arg2, (char **)&x2,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_theory_atoms_element_to_string_size(x0, x1, x2); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_theory_atoms_element_to_string_size _cffi_d_clingo_theory_atoms_element_to_string_size
+#endif
+
+static _Bool _cffi_d_clingo_theory_atoms_element_tuple(clingo_theory_atoms_t const * x0, uint32_t x1, uint32_t const * * x2, size_t * x3)
+{
+  return clingo_theory_atoms_element_tuple(x0, x1, x2, x3);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_theory_atoms_element_tuple(PyObject *self, PyObject *args)
+{
+  clingo_theory_atoms_t const * x0;
+  uint32_t x1;
+  uint32_t const * * x2;
+  size_t * x3;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+  PyObject *arg3;
+
+  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_element_tuple", 4, 4, &arg0, &arg1, &arg2, &arg3))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(988), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x1 = _cffi_to_c_int(arg1, uint32_t);
+  if (x1 == (uint32_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(1075), arg2, (char **)&x2);
+  if (datasize != 0) {
+    x2 = ((size_t)datasize) <= 640 ? (uint32_t const * *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(1075), arg2, (char **)&x2,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(207), arg3, (char **)&x3);
+  if (datasize != 0) {
+    x3 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(207), arg3, (char **)&x3,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_theory_atoms_element_tuple(x0, x1, x2, x3); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_theory_atoms_element_tuple _cffi_d_clingo_theory_atoms_element_tuple
+#endif
+
+static _Bool _cffi_d_clingo_theory_atoms_elements_size(clingo_theory_atoms_t const * x0, size_t * x1)
+{
+  return clingo_theory_atoms_elements_size(x0, x1);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_theory_atoms_elements_size(PyObject *self, PyObject *args)
+{
+  clingo_theory_atoms_t const * x0;
+  size_t * x1;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+
+  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_elements_size", 2, 2, &arg0, &arg1))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(988), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(207), arg1, (char **)&x1);
+  if (datasize != 0) {
+    x1 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(207), arg1, (char **)&x1,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_theory_atoms_elements_size(x0, x1); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_theory_atoms_elements_size _cffi_d_clingo_theory_atoms_elements_size
+#endif
+
+static _Bool _cffi_d_clingo_theory_atoms_fetch_atom_elements(clingo_theory_atoms_t const * x0, uint32_t x1, size_t x2, uint32_t * x3, size_t x4)
+{
+  return clingo_theory_atoms_fetch_atom_elements(x0, x1, x2, x3, x4);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_theory_atoms_fetch_atom_elements(PyObject *self, PyObject *args)
+{
+  clingo_theory_atoms_t const * x0;
+  uint32_t x1;
+  size_t x2;
+  uint32_t * x3;
+  size_t x4;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+  PyObject *arg3;
+  PyObject *arg4;
+
+  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_fetch_atom_elements", 5, 5, &arg0, &arg1, &arg2, &arg3, &arg4))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(988), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x1 = _cffi_to_c_int(arg1, uint32_t);
+  if (x1 == (uint32_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  x2 = _cffi_to_c_int(arg2, size_t);
+  if (x2 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(115), arg3, (char **)&x3);
+  if (datasize != 0) {
+    x3 = ((size_t)datasize) <= 640 ? (uint32_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(115), arg3, (char **)&x3,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x4 = _cffi_to_c_int(arg4, size_t);
+  if (x4 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_theory_atoms_fetch_atom_elements(x0, x1, x2, x3, x4); }
   _cffi_save_errno();
   Py_END_ALLOW_THREADS
 
@@ -18275,21 +19830,26 @@ _cffi_f_clingo_theory_atoms_atom_to_string_size(PyObject *self, PyObject *args)
   return pyresult;
 }
 #else
-#  define _cffi_f_clingo_theory_atoms_atom_to_string_size _cffi_d_clingo_theory_atoms_atom_to_string_size
+#  define _cffi_f_clingo_theory_atoms_fetch_atom_elements _cffi_d_clingo_theory_atoms_fetch_atom_elements
 #endif
 
-static _Bool _cffi_d_clingo_theory_atoms_element_condition(clingo_theory_atoms_t const * x0, uint32_t x1, int32_t const * * x2, size_t * x3)
+static _Bool _cffi_d_clingo_theory_atoms_fetch_atoms(clingo_theory_atoms_t const * x0, uint32_t x1, int32_t * x2, uint32_t * x3, _Bool * x4, uint32_t * x5, uint32_t * x6, size_t * x7, size_t x8)
 {
-  return clingo_theory_atoms_element_condition(x0, x1, x2, x3);
+  return clingo_theory_atoms_fetch_atoms(x0, x1, x2, x3, x4, x5, x6, x7, x8);
 }
 #ifndef PYPY_VERSION
 static PyObject *
-_cffi_f_clingo_theory_atoms_element_condition(PyObject *self, PyObject *args)
+_cffi_f_clingo_theory_atoms_fetch_atoms(PyObject *self, PyObject *args)
 {
   clingo_theory_atoms_t const * x0;
   uint32_t x1;
-  int32_t const * * x2;
-  size_t * x3;
+  int32_t * x2;
+  uint32_t * x3;
+  _Bool * x4;
+  uint32_t * x5;
+  uint32_t * x6;
+  size_t * x7;
+  size_t x8;
   Py_ssize_t datasize;
   struct _cffi_freeme_s *large_args_free = NULL;
   _Bool result;
@@ -18298,15 +19858,20 @@ _cffi_f_clingo_theory_atoms_element_condition(PyObject *self, PyObject *args)
   PyObject *arg1;
   PyObject *arg2;
   PyObject *arg3;
+  PyObject *arg4;
+  PyObject *arg5;
+  PyObject *arg6;
+  PyObject *arg7;
+  PyObject *arg8;
 
-  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_element_condition", 4, 4, &arg0, &arg1, &arg2, &arg3))
+  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_fetch_atoms", 9, 9, &arg0, &arg1, &arg2, &arg3, &arg4, &arg5, &arg6, &arg7, &arg8))
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18316,26 +19881,66 @@ _cffi_f_clingo_theory_atoms_element_condition(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(803), arg2, (char **)&x2);
+      _cffi_type(120), arg2, (char **)&x2);
   if (datasize != 0) {
-    x2 = ((size_t)datasize) <= 640 ? (int32_t const * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(803), arg2, (char **)&x2,
+    x2 = ((size_t)datasize) <= 640 ? (int32_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(120), arg2, (char **)&x2,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(207), arg3, (char **)&x3);
+      _cffi_type(115), arg3, (char **)&x3);
   if (datasize != 0) {
-    x3 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(207), arg3, (char **)&x3,
+    x3 = ((size_t)datasize) <= 640 ? (uint32_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(115), arg3, (char **)&x3,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(41), arg4, (char **)&x4);
+  if (datasize != 0) {
+    x4 = ((size_t)datasize) <= 640 ? (_Bool *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(41), arg4, (char **)&x4,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(115), arg5, (char **)&x5);
+  if (datasize != 0) {
+    x5 = ((size_t)datasize) <= 640 ? (uint32_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(115), arg5, (char **)&x5,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(115), arg6, (char **)&x6);
+  if (datasize != 0) {
+    x6 = ((size_t)datasize) <= 640 ? (uint32_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(115), arg6, (char **)&x6,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(207), arg7, (char **)&x7);
+  if (datasize != 0) {
+    x7 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(207), arg7, (char **)&x7,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
+  x8 = _cffi_to_c_int(arg8, size_t);
+  if (x8 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
   Py_BEGIN_ALLOW_THREADS
   _cffi_restore_errno();
-  { result = clingo_theory_atoms_element_condition(x0, x1, x2, x3); }
+  { result = clingo_theory_atoms_fetch_atoms(x0, x1, x2, x3, x4, x5, x6, x7, x8); }
   _cffi_save_errno();
   Py_END_ALLOW_THREADS
 
@@ -18345,20 +19950,22 @@ _cffi_f_clingo_theory_atoms_element_condition(PyObject *self, PyObject *args)
   return pyresult;
 }
 #else
-#  define _cffi_f_clingo_theory_atoms_element_condition _cffi_d_clingo_theory_atoms_element_condition
+#  define _cffi_f_clingo_theory_atoms_fetch_atoms _cffi_d_clingo_theory_atoms_fetch_atoms
 #endif
 
-static _Bool _cffi_d_clingo_theory_atoms_element_condition_id(clingo_theory_atoms_t const * x0, uint32_t x1, int32_t * x2)
+static _Bool _cffi_d_clingo_theory_atoms_fetch_element_tuples(clingo_theory_atoms_t const * x0, uint32_t x1, size_t x2, uint32_t * x3, size_t x4)
 {
-  return clingo_theory_atoms_element_condition_id(x0, x1, x2);
+  return clingo_theory_atoms_fetch_element_tuples(x0, x1, x2, x3, x4);
 }
 #ifndef PYPY_VERSION
 static PyObject *
-_cffi_f_clingo_theory_atoms_element_condition_id(PyObject *self, PyObject *args)
+_cffi_f_clingo_theory_atoms_fetch_element_tuples(PyObject *self, PyObject *args)
 {
   clingo_theory_atoms_t const * x0;
   uint32_t x1;
-  int32_t * x2;
+  size_t x2;
+  uint32_t * x3;
+  size_t x4;
   Py_ssize_t datasize;
   struct _cffi_freeme_s *large_args_free = NULL;
   _Bool result;
@@ -18366,15 +19973,17 @@ _cffi_f_clingo_theory_atoms_element_condition_id(PyObject *self, PyObject *args)
   PyObject *arg0;
   PyObject *arg1;
   PyObject *arg2;
+  PyObject *arg3;
+  PyObject *arg4;
 
-  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_element_condition_id", 3, 3, &arg0, &arg1, &arg2))
+  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_fetch_element_tuples", 5, 5, &arg0, &arg1, &arg2, &arg3, &arg4))
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18383,18 +19992,26 @@ _cffi_f_clingo_theory_atoms_element_condition_id(PyObject *self, PyObject *args)
   if (x1 == (uint32_t)-1 && PyErr_Occurred())
     return NULL;
 
+  x2 = _cffi_to_c_int(arg2, size_t);
+  if (x2 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(120), arg2, (char **)&x2);
+      _cffi_type(115), arg3, (char **)&x3);
   if (datasize != 0) {
-    x2 = ((size_t)datasize) <= 640 ? (int32_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(120), arg2, (char **)&x2,
+    x3 = ((size_t)datasize) <= 640 ? (uint32_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(115), arg3, (char **)&x3,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
+  x4 = _cffi_to_c_int(arg4, size_t);
+  if (x4 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
   Py_BEGIN_ALLOW_THREADS
   _cffi_restore_errno();
-  { result = clingo_theory_atoms_element_condition_id(x0, x1, x2); }
+  { result = clingo_theory_atoms_fetch_element_tuples(x0, x1, x2, x3, x4); }
   _cffi_save_errno();
   Py_END_ALLOW_THREADS
 
@@ -18404,21 +20021,22 @@ _cffi_f_clingo_theory_atoms_element_condition_id(PyObject *self, PyObject *args)
   return pyresult;
 }
 #else
-#  define _cffi_f_clingo_theory_atoms_element_condition_id _cffi_d_clingo_theory_atoms_element_condition_id
+#  define _cffi_f_clingo_theory_atoms_fetch_element_tuples _cffi_d_clingo_theory_atoms_fetch_element_tuples
 #endif
 
-static _Bool _cffi_d_clingo_theory_atoms_element_to_string(clingo_theory_atoms_t const * x0, uint32_t x1, char * x2, size_t x3)
+static _Bool _cffi_d_clingo_theory_atoms_fetch_elements(clingo_theory_atoms_t const * x0, uint32_t x1, int32_t * x2, size_t * x3, size_t x4)
 {
-  return clingo_theory_atoms_element_to_string(x0, x1, x2, x3);
+  return clingo_theory_atoms_fetch_elements(x0, x1, x2, x3, x4);
 }
 #ifndef PYPY_VERSION
 static PyObject *
-_cffi_f_clingo_theory_atoms_element_to_string(PyObject *self, PyObject *args)
+_cffi_f_clingo_theory_atoms_fetch_elements(PyObject *self, PyObject *args)
 {
   clingo_theory_atoms_t const * x0;
   uint32_t x1;
-  char * x2;
-  size_t x3;
+  int32_t * x2;
+  size_t * x3;
+  size_t x4;
   Py_ssize_t datasize;
   struct _cffi_freeme_s *large_args_free = NULL;
   _Bool result;
@@ -18427,15 +20045,16 @@ _cffi_f_clingo_theory_atoms_element_to_string(PyObject *self, PyObject *args)
   PyObject *arg1;
   PyObject *arg2;
   PyObject *arg3;
+  PyObject *arg4;
 
-  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_element_to_string", 4, 4, &arg0, &arg1, &arg2, &arg3))
+  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_fetch_elements", 5, 5, &arg0, &arg1, &arg2, &arg3, &arg4))
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18445,21 +20064,30 @@ _cffi_f_clingo_theory_atoms_element_to_string(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(138), arg2, (char **)&x2);
+      _cffi_type(120), arg2, (char **)&x2);
   if (datasize != 0) {
-    x2 = ((size_t)datasize) <= 640 ? (char *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(138), arg2, (char **)&x2,
+    x2 = ((size_t)datasize) <= 640 ? (int32_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(120), arg2, (char **)&x2,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
-  x3 = _cffi_to_c_int(arg3, size_t);
-  if (x3 == (size_t)-1 && PyErr_Occurred())
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(207), arg3, (char **)&x3);
+  if (datasize != 0) {
+    x3 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(207), arg3, (char **)&x3,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x4 = _cffi_to_c_int(arg4, size_t);
+  if (x4 == (size_t)-1 && PyErr_Occurred())
     return NULL;
 
   Py_BEGIN_ALLOW_THREADS
   _cffi_restore_errno();
-  { result = clingo_theory_atoms_element_to_string(x0, x1, x2, x3); }
+  { result = clingo_theory_atoms_fetch_elements(x0, x1, x2, x3, x4); }
   _cffi_save_errno();
   Py_END_ALLOW_THREADS
 
@@ -18469,20 +20097,22 @@ _cffi_f_clingo_theory_atoms_element_to_string(PyObject *self, PyObject *args)
   return pyresult;
 }
 #else
-#  define _cffi_f_clingo_theory_atoms_element_to_string _cffi_d_clingo_theory_atoms_element_to_string
+#  define _cffi_f_clingo_theory_atoms_fetch_elements _cffi_d_clingo_theory_atoms_fetch_elements
 #endif
 
-static _Bool _cffi_d_clingo_theory_atoms_element_to_string_size(clingo_theory_atoms_t const * x0, uint32_t x1, size_t * x2)
+static _Bool _cffi_d_clingo_theory_atoms_fetch_term_arguments(clingo_theory_atoms_t const * x0, uint32_t x1, size_t x2, uint32_t * x3, size_t x4)
 {
-  return clingo_theory_atoms_element_to_string_size(x0, x1, x2);
+  return clingo_theory_atoms_fetch_term_arguments(x0, x1, x2, x3, x4);
 }
 #ifndef PYPY_VERSION
 static PyObject *
-_cffi_f_clingo_theory_atoms_element_to_string_size(PyObject *self, PyObject *args)
+_cffi_f_clingo_theory_atoms_fetch_term_arguments(PyObject *self, PyObject *args)
 {
   clingo_theory_atoms_t const * x0;
   uint32_t x1;
-  size_t * x2;
+  size_t x2;
+  uint32_t * x3;
+  size_t x4;
   Py_ssize_t datasize;
   struct _cffi_freeme_s *large_args_free = NULL;
   _Bool result;
@@ -18490,15 +20120,17 @@ _cffi_f_clingo_theory_atoms_element_to_string_size(PyObject *self, PyObject *arg
   PyObject *arg0;
   PyObject *arg1;
   PyObject *arg2;
+  PyObject *arg3;
+  PyObject *arg4;
 
-  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_element_to_string_size", 3, 3, &arg0, &arg1, &arg2))
+  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_fetch_term_arguments", 5, 5, &arg0, &arg1, &arg2, &arg3, &arg4))
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18507,18 +20139,26 @@ _cffi_f_clingo_theory_atoms_element_to_string_size(PyObject *self, PyObject *arg
   if (x1 == (uint32_t)-1 && PyErr_Occurred())
     return NULL;
 
+  x2 = _cffi_to_c_int(arg2, size_t);
+  if (x2 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(207), arg2, (char **)&x2);
+      _cffi_type(115), arg3, (char **)&x3);
   if (datasize != 0) {
-    x2 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(207), arg2, (char **)&x2,
+    x3 = ((size_t)datasize) <= 640 ? (uint32_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(115), arg3, (char **)&x3,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
+  x4 = _cffi_to_c_int(arg4, size_t);
+  if (x4 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
   Py_BEGIN_ALLOW_THREADS
   _cffi_restore_errno();
-  { result = clingo_theory_atoms_element_to_string_size(x0, x1, x2); }
+  { result = clingo_theory_atoms_fetch_term_arguments(x0, x1, x2, x3, x4); }
   _cffi_save_errno();
   Py_END_ALLOW_THREADS
 
@@ -18528,21 +20168,23 @@ _cffi_f_clingo_theory_atoms_element_to_string_size(PyObject *self, PyObject *arg
   return pyresult;
 }
 #else
-#  define _cffi_f_clingo_theory_atoms_element_to_string_size _cffi_d_clingo_theory_atoms_element_to_string_size
+#  define _cffi_f_clingo_theory_atoms_fetch_term_arguments _cffi_d_clingo_theory_atoms_fetch_term_arguments
 #endif
 
-static _Bool _cffi_d_clingo_theory_atoms_element_tuple(clingo_theory_atoms_t const * x0, uint32_t x1, uint32_t const * * x2, size_t * x3)
+static _Bool _cffi_d_clingo_theory_atoms_fetch_terms(clingo_theory_atoms_t const * x0, uint32_t x1, int * x2, int * x3, size_t * x4, size_t x5)
 {
-  return clingo_theory_atoms_element_tuple(x0, x1, x2, x3);
+  return clingo_theory_atoms_fetch_terms(x0, x1, x2, x3, x4, x5);
 }
 #ifndef PYPY_VERSION
 static PyObject *
-_cffi_f_clingo_theory_atoms_element_tuple(PyObject *self, PyObject *args)
+_cffi_f_clingo_theory_atoms_fetch_terms(PyObject *self, PyObject *args)
 {
   clingo_theory_atoms_t const * x0;
   uint32_t x1;
-  uint32_t const * * x2;
-  size_t * x3;
+  int * x2;
+  int * x3;
+  size_t * x4;
+  size_t x5;
   Py_ssize_t datasize;
   struct _cffi_freeme_s *large_args_free = NULL;
   _Bool result;
@@ -18551,15 +20193,17 @@ _cffi_f_clingo_theory_atoms_element_tuple(PyObject *self, PyObject *args)
   PyObject *arg1;
   PyObject *arg2;
   PyObject *arg3;
+  PyObject *arg4;
+  PyObject *arg5;
 
-  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_element_tuple", 4, 4, &arg0, &arg1, &arg2, &arg3))
+  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_fetch_terms", 6, 6, &arg0, &arg1, &arg2, &arg3, &arg4, &arg5))
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18569,26 +20213,39 @@ _cffi_f_clingo_theory_atoms_element_tuple(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(965), arg2, (char **)&x2);
+      _cffi_type(110), arg2, (char **)&x2);
   if (datasize != 0) {
-    x2 = ((size_t)datasize) <= 640 ? (uint32_t const * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(965), arg2, (char **)&x2,
+    x2 = ((size_t)datasize) <= 640 ? (int *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(110), arg2, (char **)&x2,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(207), arg3, (char **)&x3);
+      _cffi_type(110), arg3, (char **)&x3);
   if (datasize != 0) {
-    x3 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(207), arg3, (char **)&x3,
+    x3 = ((size_t)datasize) <= 640 ? (int *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(110), arg3, (char **)&x3,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(207), arg4, (char **)&x4);
+  if (datasize != 0) {
+    x4 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(207), arg4, (char **)&x4,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
+  x5 = _cffi_to_c_int(arg5, size_t);
+  if (x5 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
   Py_BEGIN_ALLOW_THREADS
   _cffi_restore_errno();
-  { result = clingo_theory_atoms_element_tuple(x0, x1, x2, x3); }
+  { result = clingo_theory_atoms_fetch_terms(x0, x1, x2, x3, x4, x5); }
   _cffi_save_errno();
   Py_END_ALLOW_THREADS
 
@@ -18598,7 +20255,7 @@ _cffi_f_clingo_theory_atoms_element_tuple(PyObject *self, PyObject *args)
   return pyresult;
 }
 #else
-#  define _cffi_f_clingo_theory_atoms_element_tuple _cffi_d_clingo_theory_atoms_element_tuple
+#  define _cffi_f_clingo_theory_atoms_fetch_terms _cffi_d_clingo_theory_atoms_fetch_terms
 #endif
 
 static _Bool _cffi_d_clingo_theory_atoms_size(clingo_theory_atoms_t const * x0, size_t * x1)
@@ -18622,10 +20279,10 @@ _cffi_f_clingo_theory_atoms_size(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18679,10 +20336,10 @@ _cffi_f_clingo_theory_atoms_term_arguments(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18692,10 +20349,10 @@ _cffi_f_clingo_theory_atoms_term_arguments(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(965), arg2, (char **)&x2);
+      _cffi_type(1075), arg2, (char **)&x2);
   if (datasize != 0) {
     x2 = ((size_t)datasize) <= 640 ? (uint32_t const * *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(965), arg2, (char **)&x2,
+    if (_cffi_convert_array_argument(_cffi_type(1075), arg2, (char **)&x2,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18747,10 +20404,10 @@ _cffi_f_clingo_theory_atoms_term_name(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18806,10 +20463,10 @@ _cffi_f_clingo_theory_atoms_term_number(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18867,10 +20524,10 @@ _cffi_f_clingo_theory_atoms_term_to_string(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18930,10 +20587,10 @@ _cffi_f_clingo_theory_atoms_term_to_string_size(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -18989,10 +20646,10 @@ _cffi_f_clingo_theory_atoms_term_type(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(911), arg0, (char **)&x0);
+      _cffi_type(988), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(911), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -19025,6 +20682,59 @@ _cffi_f_clingo_theory_atoms_term_type(PyObject *self, PyObject *args)
 #  define _cffi_f_clingo_theory_atoms_term_type _cffi_d_clingo_theory_atoms_term_type
 #endif
 
+static _Bool _cffi_d_clingo_theory_atoms_terms_size(clingo_theory_atoms_t const * x0, size_t * x1)
+{
+  return clingo_theory_atoms_terms_size(x0, x1);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingo_theory_atoms_terms_size(PyObject *self, PyObject *args)
+{
+  clingo_theory_atoms_t const * x0;
+  size_t * x1;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+
+  if (!PyArg_UnpackTuple(args, "clingo_theory_atoms_terms_size", 2, 2, &arg0, &arg1))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(988), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingo_theory_atoms_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(988), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(207), arg1, (char **)&x1);
+  if (datasize != 0) {
+    x1 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(207), arg1, (char **)&x1,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingo_theory_atoms_terms_size(x0, x1); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingo_theory_atoms_terms_size _cffi_d_clingo_theory_atoms_terms_size
+#endif
+
 static void _cffi_d_clingo_version(int * x0, int * x1, int * x2)
 {
   clingo_version(x0, x1, x2);
@@ -19174,6 +20884,18 @@ static void _cffi_checkfld__clingo_ast_constructors_t(clingo_ast_constructors_t
 }
 struct _cffi_align__clingo_ast_constructors_t { char x; clingo_ast_constructors_t y; };
 
+_CFFI_UNUSED_FN
+static void _cffi_checkfld__clingo_ground_program_batch_observer_t(clingo_ground_program_batch_observer_t *p)
+{
+  /* only to generate compile-time warnings or errors */
+  (void)p;
+  { _Bool(* *tmp)(clingo_rule_batch_t const *, void *) = &p->rules; (void)tmp; }
+  { _Bool(* *tmp)(clingo_weight_rule_batch_t const *, void *) = &p->weight_rules; (void)tmp; }
+  { _Bool(* *tmp)(clingo_output_atom_batch_t const *, void *) = &p->output_atoms; (void)tmp; }
+  { _Bool(* *tmp)(clingo_theory_element_batch_t const *, void *) = &p->theory_elements; (void)tmp; }
+}
+struct _cffi_align__clingo_ground_program_batch_observer_t { char x; clingo_ground_program_batch_observer_t y; };
+
 _CFFI_UNUSED_FN
 static void _cffi_checkfld__clingo_ground_program_observer_t(clingo_ground_program_observer_t *p)
 {
@@ -19215,6 +20937,17 @@ static void _cffi_checkfld__clingo_location_t(clingo_location_t *p)
 }
 struct _cffi_align__clingo_location_t { char x; clingo_location_t y; };
 
+_CFFI_UNUSED_FN
+static void _cffi_checkfld__clingo_output_atom_batch_t(clingo_output_atom_batch_t *p)
+{
+  /* only to generate compile-time warnings or errors */
+  (void)p;
+  { uint64_t const * *tmp = &p->symbols; (void)tmp; }
+  { uint32_t const * *tmp = &p->atoms; (void)tmp; }
+  (void)((p->size) | 0);  /* check that 'clingo_output_atom_batch_t.size' is an integer */
+}
+struct _cffi_align__clingo_output_atom_batch_t { char x; clingo_output_atom_batch_t y; };
+
 _CFFI_UNUSED_FN
 static void _cffi_checkfld__clingo_part_t(clingo_part_t *p)
 {
@@ -19239,6 +20972,20 @@ static void _cffi_checkfld__clingo_propagator_t(clingo_propagator_t *p)
 }
 struct _cffi_align__clingo_propagator_t { char x; clingo_propagator_t y; };
 
+_CFFI_UNUSED_FN
+static void _cffi_checkfld__clingo_rule_batch_t(clingo_rule_batch_t *p)
+{
+  /* only to generate compile-time warnings or errors */
+  (void)p;
+  { _Bool const * *tmp = &p->choices; (void)tmp; }
+  { size_t const * *tmp = &p->head_offsets; (void)tmp; }
+  { uint32_t const * *tmp = &p->heads; (void)tmp; }
+  { size_t const * *tmp = &p->body_offsets; (void)tmp; }
+  { int32_t const * *tmp = &p->bodies; (void)tmp; }
+  (void)((p->size) | 0);  /* check that 'clingo_rule_batch_t.size' is an integer */
+}
+struct _cffi_align__clingo_rule_batch_t { char x; clingo_rule_batch_t y; };
+
 _CFFI_UNUSED_FN
 static void _cffi_checkfld__clingo_script_t(clingo_script_t *p)
 {
@@ -19253,6 +21000,35 @@ static void _cffi_checkfld__clingo_script_t(clingo_script_t *p)
 }
 struct _cffi_align__clingo_script_t { char x; clingo_script_t y; };
 
+_CFFI_UNUSED_FN
+static void _cffi_checkfld__clingo_theory_element_batch_t(clingo_theory_element_batch_t *p)
+{
+  /* only to generate compile-time warnings or errors */
+  (void)p;
+  { uint32_t const * *tmp = &p->element_ids; (void)tmp; }
+  { size_t const * *tmp = &p->term_offsets; (void)tmp; }
+  { uint32_t const * *tmp = &p->terms; (void)tmp; }
+  { size_t const * *tmp = &p->condition_offsets; (void)tmp; }
+  { int32_t const * *tmp = &p->conditions; (void)tmp; }
+  (void)((p->size) | 0);  /* check that 'clingo_theory_element_batch_t.size' is an integer */
+}
+struct _cffi_align__clingo_theory_element_batch_t { char x; clingo_theory_element_batch_t y; };
+
+_CFFI_UNUSED_FN
+static void _cffi_checkfld__clingo_weight_rule_batch_t(clingo_weight_rule_batch_t *p)
+{
+  /* only to generate compile-time warnings or errors */
+  (void)p;
+  { _Bool const * *tmp = &p->choices; (void)tmp; }
+  { size_t const * *tmp = &p->head_offsets; (void)tmp; }
+  { uint32_t const * *tmp = &p->heads; (void)tmp; }
+  { int32_t const * *tmp = &p->lower_bounds; (void)tmp; }
+  { size_t const * *tmp = &p->body_offsets; (void)tmp; }
+  { clingo_weighted_literal_t const * *tmp = &p->bodies; (void)tmp; }
+  (void)((p->size) | 0);  /* check that 'clingo_weight_rule_batch_t.size' is an integer */
+}
+struct _cffi_align__clingo_weight_rule_batch_t { char x; clingo_weight_rule_batch_t y; };
+
 _CFFI_UNUSED_FN
 static void _cffi_checkfld__clingo_weighted_literal_t(clingo_weighted_literal_t *p)
 {
@@ -19277,7 +21053,7 @@ static const struct _cffi_global_s _cffi_globals[] = {
   { "clingo_add_string", (void *)_cffi_f_clingo_add_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 58), (void *)_cffi_d_clingo_add_string },
   { "clingo_assignment_at", (void *)_cffi_f_clingo_assignment_at, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 117), (void *)_cffi_d_clingo_assignment_at },
   { "clingo_assignment_decision", (void *)_cffi_f_clingo_assignment_decision, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 126), (void *)_cffi_d_clingo_assignment_decision },
-  { "clingo_assignment_decision_level", (void *)_cffi_f_clingo_assignment_decision_level, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1171), (void *)_cffi_d_clingo_assignment_decision_level },
+  { "clingo_assignment_decision_level", (void *)_cffi_f_clingo_assignment_decision_level, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1289), (void *)_cffi_d_clingo_assignment_decision_level },
   { "clingo_assignment_has_conflict", (void *)_cffi_f_clingo_assignment_has_conflict, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 95), (void *)_cffi_d_clingo_assignment_has_conflict },
   { "clingo_assignment_has_literal", (void *)_cffi_f_clingo_assignment_has_literal, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 98), (void *)_cffi_d_clingo_assignment_has_literal },
   { "clingo_assignment_is_false", (void *)_cffi_f_clingo_assignment_is_false, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 102), (void *)_cffi_d_clingo_assignment_is_false },
@@ -19285,14 +21061,14 @@ static const struct _cffi_global_s _cffi_globals[] = {
   { "clingo_assignment_is_total", (void *)_cffi_f_clingo_assignment_is_total, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 95), (void *)_cffi_d_clingo_assignment_is_total },
   { "clingo_assignment_is_true", (void *)_cffi_f_clingo_assignment_is_true, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 102), (void *)_cffi_d_clingo_assignment_is_true },
   { "clingo_assignment_level", (void *)_cffi_f_clingo_assignment_level, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 112), (void *)_cffi_d_clingo_assignment_level },
-  { "clingo_assignment_root_level", (void *)_cffi_f_clingo_assignment_root_level, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1171), (void *)_cffi_d_clingo_assignment_root_level },
-  { "clingo_assignment_size", (void *)_cffi_f_clingo_assignment_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1162), (void *)_cffi_d_clingo_assignment_size },
+  { "clingo_assignment_root_level", (void *)_cffi_f_clingo_assignment_root_level, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1289), (void *)_cffi_d_clingo_assignment_root_level },
+  { "clingo_assignment_size", (void *)_cffi_f_clingo_assignment_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1280), (void *)_cffi_d_clingo_assignment_size },
   { "clingo_assignment_trail_at", (void *)_cffi_f_clingo_assignment_trail_at, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 126), (void *)_cffi_d_clingo_assignment_trail_at },
   { "clingo_assignment_trail_begin", (void *)_cffi_f_clingo_assignment_trail_begin, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 131), (void *)_cffi_d_clingo_assignment_trail_begin },
   { "clingo_assignment_trail_end", (void *)_cffi_f_clingo_assignment_trail_end, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 131), (void *)_cffi_d_clingo_assignment_trail_end },
   { "clingo_assignment_trail_size", (void *)_cffi_f_clingo_assignment_trail_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 122), (void *)_cffi_d_clingo_assignment_trail_size },
   { "clingo_assignment_truth_value", (void *)_cffi_f_clingo_assignment_truth_value, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 107), (void *)_cffi_d_clingo_assignment_truth_value },
-  { "clingo_ast_acquire", (void *)_cffi_f_clingo_ast_acquire, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1183), (void *)_cffi_d_clingo_ast_acquire },
+  { "clingo_ast_acquire", (void *)_cffi_f_clingo_ast_acquire, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1301), (void *)_cffi_d_clingo_ast_acquire },
   { "clingo_ast_aggregate_function_count", (void *)_cffi_const_clingo_ast_aggregate_function_count, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_ast_aggregate_function_max", (void *)_cffi_const_clingo_ast_aggregate_function_max, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_ast_aggregate_function_min", (void *)_cffi_const_clingo_ast_aggregate_function_min, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
@@ -19383,7 +21159,7 @@ static const struct _cffi_global_s _cffi_globals[] = {
   { "clingo_ast_binary_operator_plus", (void *)_cffi_const_clingo_ast_binary_operator_plus, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_ast_binary_operator_power", (void *)_cffi_const_clingo_ast_binary_operator_power, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_ast_binary_operator_xor", (void *)_cffi_const_clingo_ast_binary_operator_xor, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
-  { "clingo_ast_build", (void *)_cffi_const_clingo_ast_build, _CFFI_OP(_CFFI_OP_CONSTANT, 1248), (void *)0 },
+  { "clingo_ast_build", (void *)_cffi_const_clingo_ast_build, _CFFI_OP(_CFFI_OP_CONSTANT, 1376), (void *)0 },
   { "clingo_ast_comparison_operator_equal", (void *)_cffi_const_clingo_ast_comparison_operator_equal, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_ast_comparison_operator_greater_equal", (void *)_cffi_const_clingo_ast_comparison_operator_greater_equal, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_ast_comparison_operator_greater_than", (void *)_cffi_const_clingo_ast_comparison_operator_greater_than, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
@@ -19395,11 +21171,11 @@ static const struct _cffi_global_s _cffi_globals[] = {
   { "clingo_ast_equal", (void *)_cffi_f_clingo_ast_equal, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 145), (void *)_cffi_d_clingo_ast_equal },
   { "clingo_ast_get_type", (void *)_cffi_f_clingo_ast_get_type, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 149), (void *)_cffi_d_clingo_ast_get_type },
   { "clingo_ast_has_attribute", (void *)_cffi_f_clingo_ast_has_attribute, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 153), (void *)_cffi_d_clingo_ast_has_attribute },
-  { "clingo_ast_hash", (void *)_cffi_f_clingo_ast_hash, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1165), (void *)_cffi_d_clingo_ast_hash },
+  { "clingo_ast_hash", (void *)_cffi_f_clingo_ast_hash, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1283), (void *)_cffi_d_clingo_ast_hash },
   { "clingo_ast_less_than", (void *)_cffi_f_clingo_ast_less_than, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 145), (void *)_cffi_d_clingo_ast_less_than },
   { "clingo_ast_parse_files", (void *)_cffi_f_clingo_ast_parse_files, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 21), (void *)_cffi_d_clingo_ast_parse_files },
   { "clingo_ast_parse_string", (void *)_cffi_f_clingo_ast_parse_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 44), (void *)_cffi_d_clingo_ast_parse_string },
-  { "clingo_ast_release", (void *)_cffi_f_clingo_ast_release, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1183), (void *)_cffi_d_clingo_ast_release },
+  { "clingo_ast_release", (void *)_cffi_f_clingo_ast_release, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1301), (void *)_cffi_d_clingo_ast_release },
   { "clingo_ast_sign_double_negation", (void *)_cffi_const_clingo_ast_sign_double_negation, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_ast_sign_negation", (void *)_cffi_const_clingo_ast_sign_negation, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_ast_sign_no_sign", (void *)_cffi_const_clingo_ast_sign_no_sign, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
@@ -19518,40 +21294,41 @@ static const struct _cffi_global_s _cffi_globals[] = {
   { "clingo_consequence_true", (void *)_cffi_const_clingo_consequence_true, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_consequence_unknown", (void *)_cffi_const_clingo_consequence_unknown, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_control_add", (void *)_cffi_f_clingo_control_add, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 458), (void *)_cffi_d_clingo_control_add },
-  { "clingo_control_assign_external", (void *)_cffi_f_clingo_control_assign_external, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 500), (void *)_cffi_d_clingo_control_assign_external },
+  { "clingo_control_assign_external", (void *)_cffi_f_clingo_control_assign_external, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 508), (void *)_cffi_d_clingo_control_assign_external },
   { "clingo_control_backend", (void *)_cffi_f_clingo_control_backend, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 465), (void *)_cffi_d_clingo_control_backend },
-  { "clingo_control_clasp_facade", (void *)_cffi_f_clingo_control_clasp_facade, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 526), (void *)_cffi_d_clingo_control_clasp_facade },
+  { "clingo_control_clasp_facade", (void *)_cffi_f_clingo_control_clasp_facade, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 534), (void *)_cffi_d_clingo_control_clasp_facade },
   { "clingo_control_cleanup", (void *)_cffi_f_clingo_control_cleanup, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 436), (void *)_cffi_d_clingo_control_cleanup },
   { "clingo_control_configuration", (void *)_cffi_f_clingo_control_configuration, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 469), (void *)_cffi_d_clingo_control_configuration },
-  { "clingo_control_free", (void *)_cffi_f_clingo_control_free, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1186), (void *)_cffi_d_clingo_control_free },
-  { "clingo_control_get_const", (void *)_cffi_f_clingo_control_get_const, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 542), (void *)_cffi_d_clingo_control_get_const },
+  { "clingo_control_free", (void *)_cffi_f_clingo_control_free, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1304), (void *)_cffi_d_clingo_control_free },
+  { "clingo_control_get_const", (void *)_cffi_f_clingo_control_get_const, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 550), (void *)_cffi_d_clingo_control_get_const },
   { "clingo_control_get_enable_cleanup", (void *)_cffi_f_clingo_control_get_enable_cleanup, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 436), (void *)_cffi_d_clingo_control_get_enable_cleanup },
   { "clingo_control_get_enable_enumeration_assumption", (void *)_cffi_f_clingo_control_get_enable_enumeration_assumption, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 436), (void *)_cffi_d_clingo_control_get_enable_enumeration_assumption },
-  { "clingo_control_ground", (void *)_cffi_f_clingo_control_ground, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 479), (void *)_cffi_d_clingo_control_ground },
-  { "clingo_control_has_const", (void *)_cffi_f_clingo_control_has_const, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 537), (void *)_cffi_d_clingo_control_has_const },
-  { "clingo_control_interrupt", (void *)_cffi_f_clingo_control_interrupt, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1186), (void *)_cffi_d_clingo_control_interrupt },
-  { "clingo_control_is_conflicting", (void *)_cffi_f_clingo_control_is_conflicting, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 534), (void *)_cffi_d_clingo_control_is_conflicting },
+  { "clingo_control_ground", (void *)_cffi_f_clingo_control_ground, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 487), (void *)_cffi_d_clingo_control_ground },
+  { "clingo_control_has_const", (void *)_cffi_f_clingo_control_has_const, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 545), (void *)_cffi_d_clingo_control_has_const },
+  { "clingo_control_interrupt", (void *)_cffi_f_clingo_control_interrupt, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1304), (void *)_cffi_d_clingo_control_interrupt },
+  { "clingo_control_is_conflicting", (void *)_cffi_f_clingo_control_is_conflicting, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 542), (void *)_cffi_d_clingo_control_is_conflicting },
   { "clingo_control_load", (void *)_cffi_f_clingo_control_load, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 454), (void *)_cffi_d_clingo_control_load },
   { "clingo_control_load_aspif", (void *)_cffi_f_clingo_control_load_aspif, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 443), (void *)_cffi_d_clingo_control_load_aspif },
   { "clingo_control_new", (void *)_cffi_f_clingo_control_new, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 31), (void *)_cffi_d_clingo_control_new },
-  { "clingo_control_register_backend", (void *)_cffi_f_clingo_control_register_backend, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 511), (void *)_cffi_d_clingo_control_register_backend },
+  { "clingo_control_register_backend", (void *)_cffi_f_clingo_control_register_backend, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 519), (void *)_cffi_d_clingo_control_register_backend },
+  { "clingo_control_register_batch_observer", (void *)_cffi_f_clingo_control_register_batch_observer, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 479), (void *)_cffi_d_clingo_control_register_batch_observer },
   { "clingo_control_register_observer", (void *)_cffi_f_clingo_control_register_observer, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 473), (void *)_cffi_d_clingo_control_register_observer },
-  { "clingo_control_register_propagator", (void *)_cffi_f_clingo_control_register_propagator, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 490), (void *)_cffi_d_clingo_control_register_propagator },
-  { "clingo_control_release_external", (void *)_cffi_f_clingo_control_release_external, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 496), (void *)_cffi_d_clingo_control_release_external },
+  { "clingo_control_register_propagator", (void *)_cffi_f_clingo_control_register_propagator, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 498), (void *)_cffi_d_clingo_control_register_propagator },
+  { "clingo_control_release_external", (void *)_cffi_f_clingo_control_release_external, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 504), (void *)_cffi_d_clingo_control_release_external },
   { "clingo_control_remove_minimize", (void *)_cffi_f_clingo_control_remove_minimize, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 436), (void *)_cffi_d_clingo_control_remove_minimize },
   { "clingo_control_set_enable_cleanup", (void *)_cffi_f_clingo_control_set_enable_cleanup, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 439), (void *)_cffi_d_clingo_control_set_enable_cleanup },
   { "clingo_control_set_enable_enumeration_assumption", (void *)_cffi_f_clingo_control_set_enable_enumeration_assumption, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 439), (void *)_cffi_d_clingo_control_set_enable_enumeration_assumption },
-  { "clingo_control_solve", (void *)_cffi_f_clingo_control_solve, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 517), (void *)_cffi_d_clingo_control_solve },
-  { "clingo_control_statistics", (void *)_cffi_f_clingo_control_statistics, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 547), (void *)_cffi_d_clingo_control_statistics },
-  { "clingo_control_symbolic_atoms", (void *)_cffi_f_clingo_control_symbolic_atoms, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 551), (void *)_cffi_d_clingo_control_symbolic_atoms },
-  { "clingo_control_theory_atoms", (void *)_cffi_f_clingo_control_theory_atoms, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 555), (void *)_cffi_d_clingo_control_theory_atoms },
-  { "clingo_control_update_project", (void *)_cffi_f_clingo_control_update_project, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 505), (void *)_cffi_d_clingo_control_update_project },
+  { "clingo_control_solve", (void *)_cffi_f_clingo_control_solve, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 525), (void *)_cffi_d_clingo_control_solve },
+  { "clingo_control_statistics", (void *)_cffi_f_clingo_control_statistics, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 555), (void *)_cffi_d_clingo_control_statistics },
+  { "clingo_control_symbolic_atoms", (void *)_cffi_f_clingo_control_symbolic_atoms, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 559), (void *)_cffi_d_clingo_control_symbolic_atoms },
+  { "clingo_control_theory_atoms", (void *)_cffi_f_clingo_control_theory_atoms, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 563), (void *)_cffi_d_clingo_control_theory_atoms },
+  { "clingo_control_update_project", (void *)_cffi_f_clingo_control_update_project, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 513), (void *)_cffi_d_clingo_control_update_project },
   { "clingo_error_bad_alloc", (void *)_cffi_const_clingo_error_bad_alloc, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
-  { "clingo_error_code", (void *)_cffi_f_clingo_error_code, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_N, 1160), (void *)_cffi_d_clingo_error_code },
+  { "clingo_error_code", (void *)_cffi_f_clingo_error_code, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_N, 1278), (void *)_cffi_d_clingo_error_code },
   { "clingo_error_logic", (void *)_cffi_const_clingo_error_logic, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
-  { "clingo_error_message", (void *)_cffi_f_clingo_error_message, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_N, 1140), (void *)_cffi_d_clingo_error_message },
+  { "clingo_error_message", (void *)_cffi_f_clingo_error_message, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_N, 1258), (void *)_cffi_d_clingo_error_message },
   { "clingo_error_runtime", (void *)_cffi_const_clingo_error_runtime, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
-  { "clingo_error_string", (void *)_cffi_f_clingo_error_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1131), (void *)_cffi_d_clingo_error_string },
+  { "clingo_error_string", (void *)_cffi_f_clingo_error_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1249), (void *)_cffi_d_clingo_error_string },
   { "clingo_error_success", (void *)_cffi_const_clingo_error_success, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_error_unknown", (void *)_cffi_const_clingo_error_unknown, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_external_type_false", (void *)_cffi_const_clingo_external_type_false, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
@@ -19564,58 +21341,64 @@ static const struct _cffi_global_s _cffi_globals[] = {
   { "clingo_heuristic_type_level", (void *)_cffi_const_clingo_heuristic_type_level, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_heuristic_type_sign", (void *)_cffi_const_clingo_heuristic_type_sign, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_heuristic_type_true", (void *)_cffi_const_clingo_heuristic_type_true, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
-  { "clingo_main", (void *)_cffi_f_clingo_main, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1148), (void *)_cffi_d_clingo_main },
-  { "clingo_model_contains", (void *)_cffi_f_clingo_model_contains, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 651), (void *)_cffi_d_clingo_model_contains },
-  { "clingo_model_context", (void *)_cffi_f_clingo_model_context, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 611), (void *)_cffi_d_clingo_model_context },
-  { "clingo_model_cost", (void *)_cffi_f_clingo_model_cost, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 634), (void *)_cffi_d_clingo_model_cost },
-  { "clingo_model_cost_size", (void *)_cffi_f_clingo_model_cost_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 639), (void *)_cffi_d_clingo_model_cost_size },
-  { "clingo_model_extend", (void *)_cffi_f_clingo_model_extend, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 596), (void *)_cffi_d_clingo_model_extend },
-  { "clingo_model_is_consequence", (void *)_cffi_f_clingo_model_is_consequence, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 629), (void *)_cffi_d_clingo_model_is_consequence },
-  { "clingo_model_is_true", (void *)_cffi_f_clingo_model_is_true, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 624), (void *)_cffi_d_clingo_model_is_true },
-  { "clingo_model_number", (void *)_cffi_f_clingo_model_number, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 647), (void *)_cffi_d_clingo_model_number },
-  { "clingo_model_optimality_proven", (void *)_cffi_f_clingo_model_optimality_proven, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 601), (void *)_cffi_d_clingo_model_optimality_proven },
-  { "clingo_model_priority", (void *)_cffi_f_clingo_model_priority, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 619), (void *)_cffi_d_clingo_model_priority },
-  { "clingo_model_symbols", (void *)_cffi_f_clingo_model_symbols, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 661), (void *)_cffi_d_clingo_model_symbols },
-  { "clingo_model_symbols_size", (void *)_cffi_f_clingo_model_symbols_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 656), (void *)_cffi_d_clingo_model_symbols_size },
-  { "clingo_model_thread_id", (void *)_cffi_f_clingo_model_thread_id, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 643), (void *)_cffi_d_clingo_model_thread_id },
-  { "clingo_model_type", (void *)_cffi_f_clingo_model_type, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 615), (void *)_cffi_d_clingo_model_type },
+  { "clingo_main", (void *)_cffi_f_clingo_main, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1266), (void *)_cffi_d_clingo_main },
+  { "clingo_model_contains", (void *)_cffi_f_clingo_model_contains, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 659), (void *)_cffi_d_clingo_model_contains },
+  { "clingo_model_context", (void *)_cffi_f_clingo_model_context, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 619), (void *)_cffi_d_clingo_model_context },
+  { "clingo_model_cost", (void *)_cffi_f_clingo_model_cost, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 642), (void *)_cffi_d_clingo_model_cost },
+  { "clingo_model_cost_size", (void *)_cffi_f_clingo_model_cost_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 647), (void *)_cffi_d_clingo_model_cost_size },
+  { "clingo_model_extend", (void *)_cffi_f_clingo_model_extend, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 604), (void *)_cffi_d_clingo_model_extend },
+  { "clingo_model_is_consequence", (void *)_cffi_f_clingo_model_is_consequence, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 637), (void *)_cffi_d_clingo_model_is_consequence },
+  { "clingo_model_is_true", (void *)_cffi_f_clingo_model_is_true, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 632), (void *)_cffi_d_clingo_model_is_true },
+  { "clingo_model_number", (void *)_cffi_f_clingo_model_number, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 655), (void *)_cffi_d_clingo_model_number },
+  { "clingo_model_optimality_proven", (void *)_cffi_f_clingo_model_optimality_proven, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 609), (void *)_cffi_d_clingo_model_optimality_proven },
+  { "clingo_model_priority", (void *)_cffi_f_clingo_model_priority, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 627), (void *)_cffi_d_clingo_model_priority },
+  { "clingo_model_symbols", (void *)_cffi_f_clingo_model_symbols, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 669), (void *)_cffi_d_clingo_model_symbols },
+  { "clingo_model_symbols_size", (void *)_cffi_f_clingo_model_symbols_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 664), (void *)_cffi_d_clingo_model_symbols_size },
+  { "clingo_model_thread_id", (void *)_cffi_f_clingo_model_thread_id, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 651), (void *)_cffi_d_clingo_model_thread_id },
+  { "clingo_model_type", (void *)_cffi_f_clingo_model_type, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 623), (void *)_cffi_d_clingo_model_type },
   { "clingo_model_type_brave_consequences", (void *)_cffi_const_clingo_model_type_brave_consequences, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_model_type_cautious_consequences", (void *)_cffi_const_clingo_model_type_cautious_consequences, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_model_type_stable_model", (void *)_cffi_const_clingo_model_type_stable_model, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
-  { "clingo_options_add", (void *)_cffi_f_clingo_options_add, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 674), (void *)_cffi_d_clingo_options_add },
-  { "clingo_options_add_flag", (void *)_cffi_f_clingo_options_add_flag, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 667), (void *)_cffi_d_clingo_options_add_flag },
+  { "clingo_options_add", (void *)_cffi_f_clingo_options_add, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 682), (void *)_cffi_d_clingo_options_add },
+  { "clingo_options_add_flag", (void *)_cffi_f_clingo_options_add_flag, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 675), (void *)_cffi_d_clingo_options_add_flag },
   { "clingo_parse_term", (void *)_cffi_f_clingo_parse_term, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 88), (void *)_cffi_d_clingo_parse_term },
-  { "clingo_program_builder_add", (void *)_cffi_f_clingo_program_builder_add, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 691), (void *)_cffi_d_clingo_program_builder_add },
-  { "clingo_program_builder_begin", (void *)_cffi_f_clingo_program_builder_begin, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 688), (void *)_cffi_d_clingo_program_builder_begin },
-  { "clingo_program_builder_end", (void *)_cffi_f_clingo_program_builder_end, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 688), (void *)_cffi_d_clingo_program_builder_end },
-  { "clingo_program_builder_init", (void *)_cffi_f_clingo_program_builder_init, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 486), (void *)_cffi_d_clingo_program_builder_init },
-  { "clingo_propagate_control_add_clause", (void *)_cffi_f_clingo_propagate_control_add_clause, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 703), (void *)_cffi_d_clingo_propagate_control_add_clause },
-  { "clingo_propagate_control_add_literal", (void *)_cffi_f_clingo_propagate_control_add_literal, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 699), (void *)_cffi_d_clingo_propagate_control_add_literal },
-  { "clingo_propagate_control_add_watch", (void *)_cffi_f_clingo_propagate_control_add_watch, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 716), (void *)_cffi_d_clingo_propagate_control_add_watch },
-  { "clingo_propagate_control_assignment", (void *)_cffi_f_clingo_propagate_control_assignment, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1142), (void *)_cffi_d_clingo_propagate_control_assignment },
-  { "clingo_propagate_control_has_watch", (void *)_cffi_f_clingo_propagate_control_has_watch, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 724), (void *)_cffi_d_clingo_propagate_control_has_watch },
-  { "clingo_propagate_control_propagate", (void *)_cffi_f_clingo_propagate_control_propagate, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 695), (void *)_cffi_d_clingo_propagate_control_propagate },
-  { "clingo_propagate_control_remove_watch", (void *)_cffi_f_clingo_propagate_control_remove_watch, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1189), (void *)_cffi_d_clingo_propagate_control_remove_watch },
-  { "clingo_propagate_control_thread_id", (void *)_cffi_f_clingo_propagate_control_thread_id, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1174), (void *)_cffi_d_clingo_propagate_control_thread_id },
-  { "clingo_propagate_init_add_clause", (void *)_cffi_f_clingo_propagate_init_add_clause, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 737), (void *)_cffi_d_clingo_propagate_init_add_clause },
-  { "clingo_propagate_init_add_literal", (void *)_cffi_f_clingo_propagate_init_add_literal, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 732), (void *)_cffi_d_clingo_propagate_init_add_literal },
-  { "clingo_propagate_init_add_minimize", (void *)_cffi_f_clingo_propagate_init_add_minimize, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 757), (void *)_cffi_d_clingo_propagate_init_add_minimize },
-  { "clingo_propagate_init_add_watch", (void *)_cffi_f_clingo_propagate_init_add_watch, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 743), (void *)_cffi_d_clingo_propagate_init_add_watch },
-  { "clingo_propagate_init_add_watch_to_thread", (void *)_cffi_f_clingo_propagate_init_add_watch_to_thread, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 763), (void *)_cffi_d_clingo_propagate_init_add_watch_to_thread },
-  { "clingo_propagate_init_add_weight_constraint", (void *)_cffi_f_clingo_propagate_init_add_weight_constraint, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 747), (void *)_cffi_d_clingo_propagate_init_add_weight_constraint },
-  { "clingo_propagate_init_assignment", (void *)_cffi_f_clingo_propagate_init_assignment, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1145), (void *)_cffi_d_clingo_propagate_init_assignment },
-  { "clingo_propagate_init_freeze_literal", (void *)_cffi_f_clingo_propagate_init_freeze_literal, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 743), (void *)_cffi_d_clingo_propagate_init_freeze_literal },
-  { "clingo_propagate_init_get_check_mode", (void *)_cffi_f_clingo_propagate_init_get_check_mode, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1154), (void *)_cffi_d_clingo_propagate_init_get_check_mode },
-  { "clingo_propagate_init_get_undo_mode", (void *)_cffi_f_clingo_propagate_init_get_undo_mode, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1154), (void *)_cffi_d_clingo_propagate_init_get_undo_mode },
-  { "clingo_propagate_init_number_of_threads", (void *)_cffi_f_clingo_propagate_init_number_of_threads, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1154), (void *)_cffi_d_clingo_propagate_init_number_of_threads },
-  { "clingo_propagate_init_propagate", (void *)_cffi_f_clingo_propagate_init_propagate, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 728), (void *)_cffi_d_clingo_propagate_init_propagate },
-  { "clingo_propagate_init_remove_watch", (void *)_cffi_f_clingo_propagate_init_remove_watch, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 743), (void *)_cffi_d_clingo_propagate_init_remove_watch },
-  { "clingo_propagate_init_remove_watch_from_thread", (void *)_cffi_f_clingo_propagate_init_remove_watch_from_thread, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 763), (void *)_cffi_d_clingo_propagate_init_remove_watch_from_thread },
-  { "clingo_propagate_init_set_check_mode", (void *)_cffi_f_clingo_propagate_init_set_check_mode, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1199), (void *)_cffi_d_clingo_propagate_init_set_check_mode },
-  { "clingo_propagate_init_set_undo_mode", (void *)_cffi_f_clingo_propagate_init_set_undo_mode, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1199), (void *)_cffi_d_clingo_propagate_init_set_undo_mode },
-  { "clingo_propagate_init_solver_literal", (void *)_cffi_f_clingo_propagate_init_solver_literal, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 780), (void *)_cffi_d_clingo_propagate_init_solver_literal },
-  { "clingo_propagate_init_symbolic_atoms", (void *)_cffi_f_clingo_propagate_init_symbolic_atoms, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 772), (void *)_cffi_d_clingo_propagate_init_symbolic_atoms },
-  { "clingo_propagate_init_theory_atoms", (void *)_cffi_f_clingo_propagate_init_theory_atoms, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 776), (void *)_cffi_d_clingo_propagate_init_theory_atoms },
+  { "clingo_program_builder_add", (void *)_cffi_f_clingo_program_builder_add, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 703), (void *)_cffi_d_clingo_program_builder_add },
+  { "clingo_program_builder_begin", (void *)_cffi_f_clingo_program_builder_begin, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 700), (void *)_cffi_d_clingo_program_builder_begin },
+  { "clingo_program_builder_end", (void *)_cffi_f_clingo_program_builder_end, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 700), (void *)_cffi_d_clingo_program_builder_end },
+  { "clingo_program_builder_init", (void *)_cffi_f_clingo_program_builder_init, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 494), (void *)_cffi_d_clingo_program_builder_init },
+  { "clingo_propagate_control_add_clause", (void *)_cffi_f_clingo_propagate_control_add_clause, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 728), (void *)_cffi_d_clingo_propagate_control_add_clause },
+  { "clingo_propagate_control_add_clauses", (void *)_cffi_f_clingo_propagate_control_add_clauses, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 715), (void *)_cffi_d_clingo_propagate_control_add_clauses },
+  { "clingo_propagate_control_add_literal", (void *)_cffi_f_clingo_propagate_control_add_literal, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 711), (void *)_cffi_d_clingo_propagate_control_add_literal },
+  { "clingo_propagate_control_add_watch", (void *)_cffi_f_clingo_propagate_control_add_watch, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 741), (void *)_cffi_d_clingo_propagate_control_add_watch },
+  { "clingo_propagate_control_add_watches", (void *)_cffi_f_clingo_propagate_control_add_watches, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 723), (void *)_cffi_d_clingo_propagate_control_add_watches },
+  { "clingo_propagate_control_assignment", (void *)_cffi_f_clingo_propagate_control_assignment, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1260), (void *)_cffi_d_clingo_propagate_control_assignment },
+  { "clingo_propagate_control_has_watch", (void *)_cffi_f_clingo_propagate_control_has_watch, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 749), (void *)_cffi_d_clingo_propagate_control_has_watch },
+  { "clingo_propagate_control_propagate", (void *)_cffi_f_clingo_propagate_control_propagate, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 707), (void *)_cffi_d_clingo_propagate_control_propagate },
+  { "clingo_propagate_control_remove_watch", (void *)_cffi_f_clingo_propagate_control_remove_watch, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1312), (void *)_cffi_d_clingo_propagate_control_remove_watch },
+  { "clingo_propagate_control_remove_watches", (void *)_cffi_f_clingo_propagate_control_remove_watches, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1307), (void *)_cffi_d_clingo_propagate_control_remove_watches },
+  { "clingo_propagate_control_thread_id", (void *)_cffi_f_clingo_propagate_control_thread_id, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1292), (void *)_cffi_d_clingo_propagate_control_thread_id },
+  { "clingo_propagate_init_add_clause", (void *)_cffi_f_clingo_propagate_init_add_clause, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 767), (void *)_cffi_d_clingo_propagate_init_add_clause },
+  { "clingo_propagate_init_add_literal", (void *)_cffi_f_clingo_propagate_init_add_literal, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 757), (void *)_cffi_d_clingo_propagate_init_add_literal },
+  { "clingo_propagate_init_add_minimize", (void *)_cffi_f_clingo_propagate_init_add_minimize, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 793), (void *)_cffi_d_clingo_propagate_init_add_minimize },
+  { "clingo_propagate_init_add_watch", (void *)_cffi_f_clingo_propagate_init_add_watch, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 779), (void *)_cffi_d_clingo_propagate_init_add_watch },
+  { "clingo_propagate_init_add_watch_to_thread", (void *)_cffi_f_clingo_propagate_init_add_watch_to_thread, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 799), (void *)_cffi_d_clingo_propagate_init_add_watch_to_thread },
+  { "clingo_propagate_init_add_watches", (void *)_cffi_f_clingo_propagate_init_add_watches, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 762), (void *)_cffi_d_clingo_propagate_init_add_watches },
+  { "clingo_propagate_init_add_watches_to_thread", (void *)_cffi_f_clingo_propagate_init_add_watches_to_thread, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 773), (void *)_cffi_d_clingo_propagate_init_add_watches_to_thread },
+  { "clingo_propagate_init_add_weight_constraint", (void *)_cffi_f_clingo_propagate_init_add_weight_constraint, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 783), (void *)_cffi_d_clingo_propagate_init_add_weight_constraint },
+  { "clingo_propagate_init_assignment", (void *)_cffi_f_clingo_propagate_init_assignment, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1263), (void *)_cffi_d_clingo_propagate_init_assignment },
+  { "clingo_propagate_init_freeze_literal", (void *)_cffi_f_clingo_propagate_init_freeze_literal, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 779), (void *)_cffi_d_clingo_propagate_init_freeze_literal },
+  { "clingo_propagate_init_get_check_mode", (void *)_cffi_f_clingo_propagate_init_get_check_mode, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1272), (void *)_cffi_d_clingo_propagate_init_get_check_mode },
+  { "clingo_propagate_init_get_undo_mode", (void *)_cffi_f_clingo_propagate_init_get_undo_mode, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1272), (void *)_cffi_d_clingo_propagate_init_get_undo_mode },
+  { "clingo_propagate_init_number_of_threads", (void *)_cffi_f_clingo_propagate_init_number_of_threads, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1272), (void *)_cffi_d_clingo_propagate_init_number_of_threads },
+  { "clingo_propagate_init_propagate", (void *)_cffi_f_clingo_propagate_init_propagate, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 753), (void *)_cffi_d_clingo_propagate_init_propagate },
+  { "clingo_propagate_init_remove_watch", (void *)_cffi_f_clingo_propagate_init_remove_watch, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 779), (void *)_cffi_d_clingo_propagate_init_remove_watch },
+  { "clingo_propagate_init_remove_watch_from_thread", (void *)_cffi_f_clingo_propagate_init_remove_watch_from_thread, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 799), (void *)_cffi_d_clingo_propagate_init_remove_watch_from_thread },
+  { "clingo_propagate_init_set_check_mode", (void *)_cffi_f_clingo_propagate_init_set_check_mode, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1322), (void *)_cffi_d_clingo_propagate_init_set_check_mode },
+  { "clingo_propagate_init_set_undo_mode", (void *)_cffi_f_clingo_propagate_init_set_undo_mode, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1322), (void *)_cffi_d_clingo_propagate_init_set_undo_mode },
+  { "clingo_propagate_init_solver_literal", (void *)_cffi_f_clingo_propagate_init_solver_literal, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 822), (void *)_cffi_d_clingo_propagate_init_solver_literal },
+  { "clingo_propagate_init_solver_literals", (void *)_cffi_f_clingo_propagate_init_solver_literals, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 816), (void *)_cffi_d_clingo_propagate_init_solver_literals },
+  { "clingo_propagate_init_symbolic_atoms", (void *)_cffi_f_clingo_propagate_init_symbolic_atoms, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 808), (void *)_cffi_d_clingo_propagate_init_symbolic_atoms },
+  { "clingo_propagate_init_theory_atoms", (void *)_cffi_f_clingo_propagate_init_theory_atoms, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 812), (void *)_cffi_d_clingo_propagate_init_theory_atoms },
   { "clingo_propagator_check_mode_both", (void *)_cffi_const_clingo_propagator_check_mode_both, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_propagator_check_mode_fixpoint", (void *)_cffi_const_clingo_propagator_check_mode_fixpoint, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_propagator_check_mode_none", (void *)_cffi_const_clingo_propagator_check_mode_none, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
@@ -19623,113 +21406,127 @@ static const struct _cffi_global_s _cffi_globals[] = {
   { "clingo_propagator_undo_mode_always", (void *)_cffi_const_clingo_propagator_undo_mode_always, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_propagator_undo_mode_default", (void *)_cffi_const_clingo_propagator_undo_mode_default, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_register_script", (void *)_cffi_f_clingo_register_script, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 62), (void *)_cffi_d_clingo_register_script },
-  { "clingo_script_version", (void *)_cffi_f_clingo_script_version, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1128), (void *)_cffi_d_clingo_script_version },
-  { "clingo_set_error", (void *)_cffi_f_clingo_set_error, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1213), (void *)_cffi_d_clingo_set_error },
+  { "clingo_script_version", (void *)_cffi_f_clingo_script_version, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1246), (void *)_cffi_d_clingo_script_version },
+  { "clingo_set_error", (void *)_cffi_f_clingo_set_error, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1336), (void *)_cffi_d_clingo_set_error },
   { "clingo_show_type_all", (void *)_cffi_const_clingo_show_type_all, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_show_type_atoms", (void *)_cffi_const_clingo_show_type_atoms, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_show_type_complement", (void *)_cffi_const_clingo_show_type_complement, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_show_type_shown", (void *)_cffi_const_clingo_show_type_shown, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_show_type_terms", (void *)_cffi_const_clingo_show_type_terms, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_show_type_theory", (void *)_cffi_const_clingo_show_type_theory, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
-  { "clingo_signature_arity", (void *)_cffi_f_clingo_signature_arity, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1177), (void *)_cffi_d_clingo_signature_arity },
+  { "clingo_signature_arity", (void *)_cffi_f_clingo_signature_arity, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1295), (void *)_cffi_d_clingo_signature_arity },
   { "clingo_signature_create", (void *)_cffi_f_clingo_signature_create, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 67), (void *)_cffi_d_clingo_signature_create },
-  { "clingo_signature_hash", (void *)_cffi_f_clingo_signature_hash, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1168), (void *)_cffi_d_clingo_signature_hash },
-  { "clingo_signature_is_equal_to", (void *)_cffi_f_clingo_signature_is_equal_to, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1097), (void *)_cffi_d_clingo_signature_is_equal_to },
-  { "clingo_signature_is_less_than", (void *)_cffi_f_clingo_signature_is_less_than, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1097), (void *)_cffi_d_clingo_signature_is_less_than },
-  { "clingo_signature_is_negative", (void *)_cffi_f_clingo_signature_is_negative, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1057), (void *)_cffi_d_clingo_signature_is_negative },
-  { "clingo_signature_is_positive", (void *)_cffi_f_clingo_signature_is_positive, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1057), (void *)_cffi_d_clingo_signature_is_positive },
-  { "clingo_signature_name", (void *)_cffi_f_clingo_signature_name, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1134), (void *)_cffi_d_clingo_signature_name },
-  { "clingo_solve_control_add_clause", (void *)_cffi_f_clingo_solve_control_add_clause, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 785), (void *)_cffi_d_clingo_solve_control_add_clause },
-  { "clingo_solve_control_symbolic_atoms", (void *)_cffi_f_clingo_solve_control_symbolic_atoms, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 790), (void *)_cffi_d_clingo_solve_control_symbolic_atoms },
+  { "clingo_signature_hash", (void *)_cffi_f_clingo_signature_hash, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1286), (void *)_cffi_d_clingo_signature_hash },
+  { "clingo_signature_is_equal_to", (void *)_cffi_f_clingo_signature_is_equal_to, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1215), (void *)_cffi_d_clingo_signature_is_equal_to },
+  { "clingo_signature_is_less_than", (void *)_cffi_f_clingo_signature_is_less_than, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1215), (void *)_cffi_d_clingo_signature_is_less_than },
+  { "clingo_signature_is_negative", (void *)_cffi_f_clingo_signature_is_negative, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1175), (void *)_cffi_d_clingo_signature_is_negative },
+  { "clingo_signature_is_positive", (void *)_cffi_f_clingo_signature_is_positive, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1175), (void *)_cffi_d_clingo_signature_is_positive },
+  { "clingo_signature_name", (void *)_cffi_f_clingo_signature_name, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1252), (void *)_cffi_d_clingo_signature_name },
+  { "clingo_solve_control_add_clause", (void *)_cffi_f_clingo_solve_control_add_clause, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 831), (void *)_cffi_d_clingo_solve_control_add_clause },
+  { "clingo_solve_control_symbolic_atoms", (void *)_cffi_f_clingo_solve_control_symbolic_atoms, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 836), (void *)_cffi_d_clingo_solve_control_symbolic_atoms },
   { "clingo_solve_event_type_finish", (void *)_cffi_const_clingo_solve_event_type_finish, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_solve_event_type_model", (void *)_cffi_const_clingo_solve_event_type_model, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_solve_event_type_statistics", (void *)_cffi_const_clingo_solve_event_type_statistics, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_solve_event_type_unsat", (void *)_cffi_const_clingo_solve_event_type_unsat, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
-  { "clingo_solve_handle_cancel", (void *)_cffi_f_clingo_solve_handle_cancel, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 794), (void *)_cffi_d_clingo_solve_handle_cancel },
-  { "clingo_solve_handle_close", (void *)_cffi_f_clingo_solve_handle_close, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 794), (void *)_cffi_d_clingo_solve_handle_close },
-  { "clingo_solve_handle_core", (void *)_cffi_f_clingo_solve_handle_core, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 801), (void *)_cffi_d_clingo_solve_handle_core },
-  { "clingo_solve_handle_get", (void *)_cffi_f_clingo_solve_handle_get, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 806), (void *)_cffi_d_clingo_solve_handle_get },
-  { "clingo_solve_handle_last", (void *)_cffi_f_clingo_solve_handle_last, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 797), (void *)_cffi_d_clingo_solve_handle_last },
-  { "clingo_solve_handle_model", (void *)_cffi_f_clingo_solve_handle_model, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 797), (void *)_cffi_d_clingo_solve_handle_model },
-  { "clingo_solve_handle_resume", (void *)_cffi_f_clingo_solve_handle_resume, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 794), (void *)_cffi_d_clingo_solve_handle_resume },
-  { "clingo_solve_handle_wait", (void *)_cffi_f_clingo_solve_handle_wait, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1203), (void *)_cffi_d_clingo_solve_handle_wait },
+  { "clingo_solve_handle_cancel", (void *)_cffi_f_clingo_solve_handle_cancel, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 840), (void *)_cffi_d_clingo_solve_handle_cancel },
+  { "clingo_solve_handle_close", (void *)_cffi_f_clingo_solve_handle_close, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 840), (void *)_cffi_d_clingo_solve_handle_close },
+  { "clingo_solve_handle_core", (void *)_cffi_f_clingo_solve_handle_core, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 847), (void *)_cffi_d_clingo_solve_handle_core },
+  { "clingo_solve_handle_get", (void *)_cffi_f_clingo_solve_handle_get, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 852), (void *)_cffi_d_clingo_solve_handle_get },
+  { "clingo_solve_handle_last", (void *)_cffi_f_clingo_solve_handle_last, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 843), (void *)_cffi_d_clingo_solve_handle_last },
+  { "clingo_solve_handle_model", (void *)_cffi_f_clingo_solve_handle_model, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 843), (void *)_cffi_d_clingo_solve_handle_model },
+  { "clingo_solve_handle_resume", (void *)_cffi_f_clingo_solve_handle_resume, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 840), (void *)_cffi_d_clingo_solve_handle_resume },
+  { "clingo_solve_handle_wait", (void *)_cffi_f_clingo_solve_handle_wait, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1326), (void *)_cffi_d_clingo_solve_handle_wait },
   { "clingo_solve_mode_async", (void *)_cffi_const_clingo_solve_mode_async, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_solve_mode_yield", (void *)_cffi_const_clingo_solve_mode_yield, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_solve_result_exhausted", (void *)_cffi_const_clingo_solve_result_exhausted, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_solve_result_interrupted", (void *)_cffi_const_clingo_solve_result_interrupted, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_solve_result_satisfiable", (void *)_cffi_const_clingo_solve_result_satisfiable, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_solve_result_unsatisfiable", (void *)_cffi_const_clingo_solve_result_unsatisfiable, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
-  { "clingo_statistics_array_at", (void *)_cffi_f_clingo_statistics_array_at, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 865), (void *)_cffi_d_clingo_statistics_array_at },
-  { "clingo_statistics_array_push", (void *)_cffi_f_clingo_statistics_array_push, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 822), (void *)_cffi_d_clingo_statistics_array_push },
-  { "clingo_statistics_array_size", (void *)_cffi_f_clingo_statistics_array_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 854), (void *)_cffi_d_clingo_statistics_array_size },
-  { "clingo_statistics_map_add_subkey", (void *)_cffi_f_clingo_statistics_map_add_subkey, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 810), (void *)_cffi_d_clingo_statistics_map_add_subkey },
-  { "clingo_statistics_map_at", (void *)_cffi_f_clingo_statistics_map_at, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 838), (void *)_cffi_d_clingo_statistics_map_at },
-  { "clingo_statistics_map_has_subkey", (void *)_cffi_f_clingo_statistics_map_has_subkey, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 832), (void *)_cffi_d_clingo_statistics_map_has_subkey },
-  { "clingo_statistics_map_size", (void *)_cffi_f_clingo_statistics_map_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 854), (void *)_cffi_d_clingo_statistics_map_size },
-  { "clingo_statistics_map_subkey_name", (void *)_cffi_f_clingo_statistics_map_subkey_name, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 859), (void *)_cffi_d_clingo_statistics_map_subkey_name },
-  { "clingo_statistics_root", (void *)_cffi_f_clingo_statistics_root, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 828), (void *)_cffi_d_clingo_statistics_root },
-  { "clingo_statistics_type", (void *)_cffi_f_clingo_statistics_type, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 849), (void *)_cffi_d_clingo_statistics_type },
+  { "clingo_statistics_array_at", (void *)_cffi_f_clingo_statistics_array_at, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 917), (void *)_cffi_d_clingo_statistics_array_at },
+  { "clingo_statistics_array_push", (void *)_cffi_f_clingo_statistics_array_push, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 868), (void *)_cffi_d_clingo_statistics_array_push },
+  { "clingo_statistics_array_size", (void *)_cffi_f_clingo_statistics_array_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 906), (void *)_cffi_d_clingo_statistics_array_size },
+  { "clingo_statistics_map_add_subkey", (void *)_cffi_f_clingo_statistics_map_add_subkey, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 856), (void *)_cffi_d_clingo_statistics_map_add_subkey },
+  { "clingo_statistics_map_at", (void *)_cffi_f_clingo_statistics_map_at, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 890), (void *)_cffi_d_clingo_statistics_map_at },
+  { "clingo_statistics_map_has_subkey", (void *)_cffi_f_clingo_statistics_map_has_subkey, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 884), (void *)_cffi_d_clingo_statistics_map_has_subkey },
+  { "clingo_statistics_map_size", (void *)_cffi_f_clingo_statistics_map_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 906), (void *)_cffi_d_clingo_statistics_map_size },
+  { "clingo_statistics_map_subkey_name", (void *)_cffi_f_clingo_statistics_map_subkey_name, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 911), (void *)_cffi_d_clingo_statistics_map_subkey_name },
+  { "clingo_statistics_root", (void *)_cffi_f_clingo_statistics_root, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 874), (void *)_cffi_d_clingo_statistics_root },
+  { "clingo_statistics_to_json", (void *)_cffi_f_clingo_statistics_to_json, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 878), (void *)_cffi_d_clingo_statistics_to_json },
+  { "clingo_statistics_to_json_size", (void *)_cffi_f_clingo_statistics_to_json_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 906), (void *)_cffi_d_clingo_statistics_to_json_size },
+  { "clingo_statistics_type", (void *)_cffi_f_clingo_statistics_type, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 901), (void *)_cffi_d_clingo_statistics_type },
   { "clingo_statistics_type_array", (void *)_cffi_const_clingo_statistics_type_array, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_statistics_type_empty", (void *)_cffi_const_clingo_statistics_type_empty, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_statistics_type_map", (void *)_cffi_const_clingo_statistics_type_map, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_statistics_type_value", (void *)_cffi_const_clingo_statistics_type_value, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
-  { "clingo_statistics_value_get", (void *)_cffi_f_clingo_statistics_value_get, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 844), (void *)_cffi_d_clingo_statistics_value_get },
-  { "clingo_statistics_value_set", (void *)_cffi_f_clingo_statistics_value_set, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 817), (void *)_cffi_d_clingo_statistics_value_set },
-  { "clingo_symbol_arguments", (void *)_cffi_f_clingo_symbol_arguments, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1092), (void *)_cffi_d_clingo_symbol_arguments },
+  { "clingo_statistics_value_get", (void *)_cffi_f_clingo_statistics_value_get, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 896), (void *)_cffi_d_clingo_statistics_value_get },
+  { "clingo_statistics_value_set", (void *)_cffi_f_clingo_statistics_value_set, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 863), (void *)_cffi_d_clingo_statistics_value_set },
+  { "clingo_symbol_arguments", (void *)_cffi_f_clingo_symbol_arguments, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1210), (void *)_cffi_d_clingo_symbol_arguments },
   { "clingo_symbol_create_function", (void *)_cffi_f_clingo_symbol_create_function, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 77), (void *)_cffi_d_clingo_symbol_create_function },
   { "clingo_symbol_create_id", (void *)_cffi_f_clingo_symbol_create_id, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 53), (void *)_cffi_d_clingo_symbol_create_id },
-  { "clingo_symbol_create_infimum", (void *)_cffi_f_clingo_symbol_create_infimum, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1226), (void *)_cffi_d_clingo_symbol_create_infimum },
-  { "clingo_symbol_create_number", (void *)_cffi_f_clingo_symbol_create_number, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1222), (void *)_cffi_d_clingo_symbol_create_number },
+  { "clingo_symbol_create_infimum", (void *)_cffi_f_clingo_symbol_create_infimum, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1349), (void *)_cffi_d_clingo_symbol_create_infimum },
+  { "clingo_symbol_create_number", (void *)_cffi_f_clingo_symbol_create_number, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1345), (void *)_cffi_d_clingo_symbol_create_number },
   { "clingo_symbol_create_string", (void *)_cffi_f_clingo_symbol_create_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 73), (void *)_cffi_d_clingo_symbol_create_string },
-  { "clingo_symbol_create_supremum", (void *)_cffi_f_clingo_symbol_create_supremum, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1226), (void *)_cffi_d_clingo_symbol_create_supremum },
-  { "clingo_symbol_hash", (void *)_cffi_f_clingo_symbol_hash, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1168), (void *)_cffi_d_clingo_symbol_hash },
-  { "clingo_symbol_is_equal_to", (void *)_cffi_f_clingo_symbol_is_equal_to, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1097), (void *)_cffi_d_clingo_symbol_is_equal_to },
-  { "clingo_symbol_is_less_than", (void *)_cffi_f_clingo_symbol_is_less_than, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1097), (void *)_cffi_d_clingo_symbol_is_less_than },
-  { "clingo_symbol_is_negative", (void *)_cffi_f_clingo_symbol_is_negative, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1060), (void *)_cffi_d_clingo_symbol_is_negative },
-  { "clingo_symbol_is_positive", (void *)_cffi_f_clingo_symbol_is_positive, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1060), (void *)_cffi_d_clingo_symbol_is_positive },
-  { "clingo_symbol_name", (void *)_cffi_f_clingo_symbol_name, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1069), (void *)_cffi_d_clingo_symbol_name },
-  { "clingo_symbol_number", (void *)_cffi_f_clingo_symbol_number, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1073), (void *)_cffi_d_clingo_symbol_number },
-  { "clingo_symbol_string", (void *)_cffi_f_clingo_symbol_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1069), (void *)_cffi_d_clingo_symbol_string },
-  { "clingo_symbol_to_string", (void *)_cffi_f_clingo_symbol_to_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1064), (void *)_cffi_d_clingo_symbol_to_string },
-  { "clingo_symbol_to_string_size", (void *)_cffi_f_clingo_symbol_to_string_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1083), (void *)_cffi_d_clingo_symbol_to_string_size },
-  { "clingo_symbol_type", (void *)_cffi_f_clingo_symbol_type, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1157), (void *)_cffi_d_clingo_symbol_type },
+  { "clingo_symbol_create_supremum", (void *)_cffi_f_clingo_symbol_create_supremum, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1349), (void *)_cffi_d_clingo_symbol_create_supremum },
+  { "clingo_symbol_hash", (void *)_cffi_f_clingo_symbol_hash, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1286), (void *)_cffi_d_clingo_symbol_hash },
+  { "clingo_symbol_is_equal_to", (void *)_cffi_f_clingo_symbol_is_equal_to, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1215), (void *)_cffi_d_clingo_symbol_is_equal_to },
+  { "clingo_symbol_is_less_than", (void *)_cffi_f_clingo_symbol_is_less_than, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1215), (void *)_cffi_d_clingo_symbol_is_less_than },
+  { "clingo_symbol_is_negative", (void *)_cffi_f_clingo_symbol_is_negative, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1178), (void *)_cffi_d_clingo_symbol_is_negative },
+  { "clingo_symbol_is_positive", (void *)_cffi_f_clingo_symbol_is_positive, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1178), (void *)_cffi_d_clingo_symbol_is_positive },
+  { "clingo_symbol_name", (void *)_cffi_f_clingo_symbol_name, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1187), (void *)_cffi_d_clingo_symbol_name },
+  { "clingo_symbol_number", (void *)_cffi_f_clingo_symbol_number, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1191), (void *)_cffi_d_clingo_symbol_number },
+  { "clingo_symbol_string", (void *)_cffi_f_clingo_symbol_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1187), (void *)_cffi_d_clingo_symbol_string },
+  { "clingo_symbol_to_cached_string", (void *)_cffi_f_clingo_symbol_to_cached_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1187), (void *)_cffi_d_clingo_symbol_to_cached_string },
+  { "clingo_symbol_to_string", (void *)_cffi_f_clingo_symbol_to_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1182), (void *)_cffi_d_clingo_symbol_to_string },
+  { "clingo_symbol_to_string_size", (void *)_cffi_f_clingo_symbol_to_string_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1201), (void *)_cffi_d_clingo_symbol_to_string_size },
+  { "clingo_symbol_type", (void *)_cffi_f_clingo_symbol_type, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1275), (void *)_cffi_d_clingo_symbol_type },
   { "clingo_symbol_type_function", (void *)_cffi_const_clingo_symbol_type_function, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_symbol_type_infimum", (void *)_cffi_const_clingo_symbol_type_infimum, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_symbol_type_number", (void *)_cffi_const_clingo_symbol_type_number, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_symbol_type_string", (void *)_cffi_const_clingo_symbol_type_string, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_symbol_type_supremum", (void *)_cffi_const_clingo_symbol_type_supremum, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
-  { "clingo_symbolic_atoms_begin", (void *)_cffi_f_clingo_symbolic_atoms_begin, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 884), (void *)_cffi_d_clingo_symbolic_atoms_begin },
-  { "clingo_symbolic_atoms_end", (void *)_cffi_f_clingo_symbolic_atoms_end, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 875), (void *)_cffi_d_clingo_symbolic_atoms_end },
-  { "clingo_symbolic_atoms_find", (void *)_cffi_f_clingo_symbolic_atoms_find, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 899), (void *)_cffi_d_clingo_symbolic_atoms_find },
-  { "clingo_symbolic_atoms_is_external", (void *)_cffi_f_clingo_symbolic_atoms_is_external, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 889), (void *)_cffi_d_clingo_symbolic_atoms_is_external },
-  { "clingo_symbolic_atoms_is_fact", (void *)_cffi_f_clingo_symbolic_atoms_is_fact, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 889), (void *)_cffi_d_clingo_symbolic_atoms_is_fact },
-  { "clingo_symbolic_atoms_is_valid", (void *)_cffi_f_clingo_symbolic_atoms_is_valid, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 889), (void *)_cffi_d_clingo_symbolic_atoms_is_valid },
-  { "clingo_symbolic_atoms_iterator_is_equal_to", (void *)_cffi_f_clingo_symbolic_atoms_iterator_is_equal_to, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 904), (void *)_cffi_d_clingo_symbolic_atoms_iterator_is_equal_to },
-  { "clingo_symbolic_atoms_literal", (void *)_cffi_f_clingo_symbolic_atoms_literal, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 894), (void *)_cffi_d_clingo_symbolic_atoms_literal },
-  { "clingo_symbolic_atoms_next", (void *)_cffi_f_clingo_symbolic_atoms_next, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 899), (void *)_cffi_d_clingo_symbolic_atoms_next },
-  { "clingo_symbolic_atoms_signatures", (void *)_cffi_f_clingo_symbolic_atoms_signatures, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 879), (void *)_cffi_d_clingo_symbolic_atoms_signatures },
-  { "clingo_symbolic_atoms_signatures_size", (void *)_cffi_f_clingo_symbolic_atoms_signatures_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 871), (void *)_cffi_d_clingo_symbolic_atoms_signatures_size },
-  { "clingo_symbolic_atoms_size", (void *)_cffi_f_clingo_symbolic_atoms_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 871), (void *)_cffi_d_clingo_symbolic_atoms_size },
-  { "clingo_symbolic_atoms_symbol", (void *)_cffi_f_clingo_symbolic_atoms_symbol, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 899), (void *)_cffi_d_clingo_symbolic_atoms_symbol },
-  { "clingo_theory_atoms_atom_elements", (void *)_cffi_f_clingo_theory_atoms_atom_elements, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 962), (void *)_cffi_d_clingo_theory_atoms_atom_elements },
-  { "clingo_theory_atoms_atom_guard", (void *)_cffi_f_clingo_theory_atoms_atom_guard, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 930), (void *)_cffi_d_clingo_theory_atoms_atom_guard },
-  { "clingo_theory_atoms_atom_has_guard", (void *)_cffi_f_clingo_theory_atoms_atom_has_guard, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 914), (void *)_cffi_d_clingo_theory_atoms_atom_has_guard },
-  { "clingo_theory_atoms_atom_literal", (void *)_cffi_f_clingo_theory_atoms_atom_literal, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 941), (void *)_cffi_d_clingo_theory_atoms_atom_literal },
-  { "clingo_theory_atoms_atom_term", (void *)_cffi_f_clingo_theory_atoms_atom_term, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 957), (void *)_cffi_d_clingo_theory_atoms_atom_term },
-  { "clingo_theory_atoms_atom_to_string", (void *)_cffi_f_clingo_theory_atoms_atom_to_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 919), (void *)_cffi_d_clingo_theory_atoms_atom_to_string },
-  { "clingo_theory_atoms_atom_to_string_size", (void *)_cffi_f_clingo_theory_atoms_atom_to_string_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 952), (void *)_cffi_d_clingo_theory_atoms_atom_to_string_size },
-  { "clingo_theory_atoms_element_condition", (void *)_cffi_f_clingo_theory_atoms_element_condition, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 946), (void *)_cffi_d_clingo_theory_atoms_element_condition },
-  { "clingo_theory_atoms_element_condition_id", (void *)_cffi_f_clingo_theory_atoms_element_condition_id, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 941), (void *)_cffi_d_clingo_theory_atoms_element_condition_id },
-  { "clingo_theory_atoms_element_to_string", (void *)_cffi_f_clingo_theory_atoms_element_to_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 919), (void *)_cffi_d_clingo_theory_atoms_element_to_string },
-  { "clingo_theory_atoms_element_to_string_size", (void *)_cffi_f_clingo_theory_atoms_element_to_string_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 952), (void *)_cffi_d_clingo_theory_atoms_element_to_string_size },
-  { "clingo_theory_atoms_element_tuple", (void *)_cffi_f_clingo_theory_atoms_element_tuple, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 962), (void *)_cffi_d_clingo_theory_atoms_element_tuple },
-  { "clingo_theory_atoms_size", (void *)_cffi_f_clingo_theory_atoms_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 910), (void *)_cffi_d_clingo_theory_atoms_size },
-  { "clingo_theory_atoms_term_arguments", (void *)_cffi_f_clingo_theory_atoms_term_arguments, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 962), (void *)_cffi_d_clingo_theory_atoms_term_arguments },
-  { "clingo_theory_atoms_term_name", (void *)_cffi_f_clingo_theory_atoms_term_name, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 925), (void *)_cffi_d_clingo_theory_atoms_term_name },
-  { "clingo_theory_atoms_term_number", (void *)_cffi_f_clingo_theory_atoms_term_number, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 936), (void *)_cffi_d_clingo_theory_atoms_term_number },
-  { "clingo_theory_atoms_term_to_string", (void *)_cffi_f_clingo_theory_atoms_term_to_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 919), (void *)_cffi_d_clingo_theory_atoms_term_to_string },
-  { "clingo_theory_atoms_term_to_string_size", (void *)_cffi_f_clingo_theory_atoms_term_to_string_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 952), (void *)_cffi_d_clingo_theory_atoms_term_to_string_size },
-  { "clingo_theory_atoms_term_type", (void *)_cffi_f_clingo_theory_atoms_term_type, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 936), (void *)_cffi_d_clingo_theory_atoms_term_type },
+  { "clingo_symbolic_atoms_begin", (void *)_cffi_f_clingo_symbolic_atoms_begin, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 936), (void *)_cffi_d_clingo_symbolic_atoms_begin },
+  { "clingo_symbolic_atoms_end", (void *)_cffi_f_clingo_symbolic_atoms_end, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 927), (void *)_cffi_d_clingo_symbolic_atoms_end },
+  { "clingo_symbolic_atoms_fetch", (void *)_cffi_f_clingo_symbolic_atoms_fetch, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 966), (void *)_cffi_d_clingo_symbolic_atoms_fetch },
+  { "clingo_symbolic_atoms_find", (void *)_cffi_f_clingo_symbolic_atoms_find, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 976), (void *)_cffi_d_clingo_symbolic_atoms_find },
+  { "clingo_symbolic_atoms_find_pattern", (void *)_cffi_f_clingo_symbolic_atoms_find_pattern, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 956), (void *)_cffi_d_clingo_symbolic_atoms_find_pattern },
+  { "clingo_symbolic_atoms_is_external", (void *)_cffi_f_clingo_symbolic_atoms_is_external, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 941), (void *)_cffi_d_clingo_symbolic_atoms_is_external },
+  { "clingo_symbolic_atoms_is_fact", (void *)_cffi_f_clingo_symbolic_atoms_is_fact, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 941), (void *)_cffi_d_clingo_symbolic_atoms_is_fact },
+  { "clingo_symbolic_atoms_is_valid", (void *)_cffi_f_clingo_symbolic_atoms_is_valid, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 941), (void *)_cffi_d_clingo_symbolic_atoms_is_valid },
+  { "clingo_symbolic_atoms_iterator_is_equal_to", (void *)_cffi_f_clingo_symbolic_atoms_iterator_is_equal_to, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 981), (void *)_cffi_d_clingo_symbolic_atoms_iterator_is_equal_to },
+  { "clingo_symbolic_atoms_literal", (void *)_cffi_f_clingo_symbolic_atoms_literal, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 946), (void *)_cffi_d_clingo_symbolic_atoms_literal },
+  { "clingo_symbolic_atoms_next", (void *)_cffi_f_clingo_symbolic_atoms_next, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 976), (void *)_cffi_d_clingo_symbolic_atoms_next },
+  { "clingo_symbolic_atoms_signature_size", (void *)_cffi_f_clingo_symbolic_atoms_signature_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 951), (void *)_cffi_d_clingo_symbolic_atoms_signature_size },
+  { "clingo_symbolic_atoms_signatures", (void *)_cffi_f_clingo_symbolic_atoms_signatures, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 931), (void *)_cffi_d_clingo_symbolic_atoms_signatures },
+  { "clingo_symbolic_atoms_signatures_size", (void *)_cffi_f_clingo_symbolic_atoms_signatures_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 923), (void *)_cffi_d_clingo_symbolic_atoms_signatures_size },
+  { "clingo_symbolic_atoms_size", (void *)_cffi_f_clingo_symbolic_atoms_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 923), (void *)_cffi_d_clingo_symbolic_atoms_size },
+  { "clingo_symbolic_atoms_symbol", (void *)_cffi_f_clingo_symbolic_atoms_symbol, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 976), (void *)_cffi_d_clingo_symbolic_atoms_symbol },
+  { "clingo_theory_atoms_atom_elements", (void *)_cffi_f_clingo_theory_atoms_atom_elements, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1072), (void *)_cffi_d_clingo_theory_atoms_atom_elements },
+  { "clingo_theory_atoms_atom_guard", (void *)_cffi_f_clingo_theory_atoms_atom_guard, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1007), (void *)_cffi_d_clingo_theory_atoms_atom_guard },
+  { "clingo_theory_atoms_atom_has_guard", (void *)_cffi_f_clingo_theory_atoms_atom_has_guard, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 991), (void *)_cffi_d_clingo_theory_atoms_atom_has_guard },
+  { "clingo_theory_atoms_atom_literal", (void *)_cffi_f_clingo_theory_atoms_atom_literal, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1026), (void *)_cffi_d_clingo_theory_atoms_atom_literal },
+  { "clingo_theory_atoms_atom_term", (void *)_cffi_f_clingo_theory_atoms_atom_term, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1067), (void *)_cffi_d_clingo_theory_atoms_atom_term },
+  { "clingo_theory_atoms_atom_to_string", (void *)_cffi_f_clingo_theory_atoms_atom_to_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 996), (void *)_cffi_d_clingo_theory_atoms_atom_to_string },
+  { "clingo_theory_atoms_atom_to_string_size", (void *)_cffi_f_clingo_theory_atoms_atom_to_string_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1055), (void *)_cffi_d_clingo_theory_atoms_atom_to_string_size },
+  { "clingo_theory_atoms_element_condition", (void *)_cffi_f_clingo_theory_atoms_element_condition, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1049), (void *)_cffi_d_clingo_theory_atoms_element_condition },
+  { "clingo_theory_atoms_element_condition_id", (void *)_cffi_f_clingo_theory_atoms_element_condition_id, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1026), (void *)_cffi_d_clingo_theory_atoms_element_condition_id },
+  { "clingo_theory_atoms_element_to_string", (void *)_cffi_f_clingo_theory_atoms_element_to_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 996), (void *)_cffi_d_clingo_theory_atoms_element_to_string },
+  { "clingo_theory_atoms_element_to_string_size", (void *)_cffi_f_clingo_theory_atoms_element_to_string_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1055), (void *)_cffi_d_clingo_theory_atoms_element_to_string_size },
+  { "clingo_theory_atoms_element_tuple", (void *)_cffi_f_clingo_theory_atoms_element_tuple, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1072), (void *)_cffi_d_clingo_theory_atoms_element_tuple },
+  { "clingo_theory_atoms_elements_size", (void *)_cffi_f_clingo_theory_atoms_elements_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 987), (void *)_cffi_d_clingo_theory_atoms_elements_size },
+  { "clingo_theory_atoms_fetch_atom_elements", (void *)_cffi_f_clingo_theory_atoms_fetch_atom_elements, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1060), (void *)_cffi_d_clingo_theory_atoms_fetch_atom_elements },
+  { "clingo_theory_atoms_fetch_atoms", (void *)_cffi_f_clingo_theory_atoms_fetch_atoms, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1038), (void *)_cffi_d_clingo_theory_atoms_fetch_atoms },
+  { "clingo_theory_atoms_fetch_element_tuples", (void *)_cffi_f_clingo_theory_atoms_fetch_element_tuples, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1060), (void *)_cffi_d_clingo_theory_atoms_fetch_element_tuples },
+  { "clingo_theory_atoms_fetch_elements", (void *)_cffi_f_clingo_theory_atoms_fetch_elements, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1031), (void *)_cffi_d_clingo_theory_atoms_fetch_elements },
+  { "clingo_theory_atoms_fetch_term_arguments", (void *)_cffi_f_clingo_theory_atoms_fetch_term_arguments, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1060), (void *)_cffi_d_clingo_theory_atoms_fetch_term_arguments },
+  { "clingo_theory_atoms_fetch_terms", (void *)_cffi_f_clingo_theory_atoms_fetch_terms, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1018), (void *)_cffi_d_clingo_theory_atoms_fetch_terms },
+  { "clingo_theory_atoms_size", (void *)_cffi_f_clingo_theory_atoms_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 987), (void *)_cffi_d_clingo_theory_atoms_size },
+  { "clingo_theory_atoms_term_arguments", (void *)_cffi_f_clingo_theory_atoms_term_arguments, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1072), (void *)_cffi_d_clingo_theory_atoms_term_arguments },
+  { "clingo_theory_atoms_term_name", (void *)_cffi_f_clingo_theory_atoms_term_name, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1002), (void *)_cffi_d_clingo_theory_atoms_term_name },
+  { "clingo_theory_atoms_term_number", (void *)_cffi_f_clingo_theory_atoms_term_number, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1013), (void *)_cffi_d_clingo_theory_atoms_term_number },
+  { "clingo_theory_atoms_term_to_string", (void *)_cffi_f_clingo_theory_atoms_term_to_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 996), (void *)_cffi_d_clingo_theory_atoms_term_to_string },
+  { "clingo_theory_atoms_term_to_string_size", (void *)_cffi_f_clingo_theory_atoms_term_to_string_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1055), (void *)_cffi_d_clingo_theory_atoms_term_to_string_size },
+  { "clingo_theory_atoms_term_type", (void *)_cffi_f_clingo_theory_atoms_term_type, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1013), (void *)_cffi_d_clingo_theory_atoms_term_type },
+  { "clingo_theory_atoms_terms_size", (void *)_cffi_f_clingo_theory_atoms_terms_size, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 987), (void *)_cffi_d_clingo_theory_atoms_terms_size },
   { "clingo_theory_sequence_type_list", (void *)_cffi_const_clingo_theory_sequence_type_list, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_theory_sequence_type_set", (void *)_cffi_const_clingo_theory_sequence_type_set, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_theory_sequence_type_tuple", (void *)_cffi_const_clingo_theory_sequence_type_tuple, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
@@ -19742,92 +21539,96 @@ static const struct _cffi_global_s _cffi_globals[] = {
   { "clingo_truth_value_false", (void *)_cffi_const_clingo_truth_value_false, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_truth_value_free", (void *)_cffi_const_clingo_truth_value_free, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_truth_value_true", (void *)_cffi_const_clingo_truth_value_true, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
-  { "clingo_version", (void *)_cffi_f_clingo_version, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1208), (void *)_cffi_d_clingo_version },
+  { "clingo_version", (void *)_cffi_f_clingo_version, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 1331), (void *)_cffi_d_clingo_version },
   { "clingo_warning_atom_undefined", (void *)_cffi_const_clingo_warning_atom_undefined, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_warning_file_included", (void *)_cffi_const_clingo_warning_file_included, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_warning_global_variable", (void *)_cffi_const_clingo_warning_global_variable, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_warning_operation_undefined", (void *)_cffi_const_clingo_warning_operation_undefined, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_warning_other", (void *)_cffi_const_clingo_warning_other, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_warning_runtime_error", (void *)_cffi_const_clingo_warning_runtime_error, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
-  { "clingo_warning_string", (void *)_cffi_f_clingo_warning_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1131), (void *)_cffi_d_clingo_warning_string },
+  { "clingo_warning_string", (void *)_cffi_f_clingo_warning_string, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 1249), (void *)_cffi_d_clingo_warning_string },
   { "clingo_warning_variable_unbounded", (void *)_cffi_const_clingo_warning_variable_unbounded, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_weight_constraint_type_equivalence", (void *)_cffi_const_clingo_weight_constraint_type_equivalence, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_weight_constraint_type_implication_left", (void *)_cffi_const_clingo_weight_constraint_type_implication_left, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingo_weight_constraint_type_implication_right", (void *)_cffi_const_clingo_weight_constraint_type_implication_right, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
-  { "g_clingo_ast_attribute_names", (void *)_cffi_var_g_clingo_ast_attribute_names, _CFFI_OP(_CFFI_OP_GLOBAL_VAR_F, 1272), (void *)0 },
-  { "g_clingo_ast_constructors", (void *)_cffi_var_g_clingo_ast_constructors, _CFFI_OP(_CFFI_OP_GLOBAL_VAR_F, 1275), (void *)0 },
+  { "g_clingo_ast_attribute_names", (void *)_cffi_var_g_clingo_ast_attribute_names, _CFFI_OP(_CFFI_OP_GLOBAL_VAR_F, 1400), (void *)0 },
+  { "g_clingo_ast_constructors", (void *)_cffi_var_g_clingo_ast_constructors, _CFFI_OP(_CFFI_OP_GLOBAL_VAR_F, 1403), (void *)0 },
   { "pyclingo_application_logger", (void *)&_cffi_externpy__pyclingo_application_logger, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 27), (void *)pyclingo_application_logger },
-  { "pyclingo_application_main", (void *)&_cffi_externpy__pyclingo_application_main, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1237), (void *)pyclingo_application_main },
-  { "pyclingo_application_message_limit", (void *)&_cffi_externpy__pyclingo_application_message_limit, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1331), (void *)pyclingo_application_message_limit },
-  { "pyclingo_application_options_parse", (void *)&_cffi_externpy__pyclingo_application_options_parse, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 679), (void *)pyclingo_application_options_parse },
-  { "pyclingo_application_print_model", (void *)&_cffi_externpy__pyclingo_application_print_model, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1243), (void *)pyclingo_application_print_model },
-  { "pyclingo_application_program_name", (void *)&_cffi_externpy__pyclingo_application_program_name, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1266), (void *)pyclingo_application_program_name },
-  { "pyclingo_application_register_options", (void *)&_cffi_externpy__pyclingo_application_register_options, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1244), (void *)pyclingo_application_register_options },
-  { "pyclingo_application_validate_options", (void *)&_cffi_externpy__pyclingo_application_validate_options, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 607), (void *)pyclingo_application_validate_options },
-  { "pyclingo_application_version", (void *)&_cffi_externpy__pyclingo_application_version, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1266), (void *)pyclingo_application_version },
-  { "pyclingo_ast_callback", (void *)&_cffi_externpy__pyclingo_ast_callback, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1236), (void *)pyclingo_ast_callback },
-  { "pyclingo_call", (void *)&_cffi_externpy__pyclingo_call, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1264), (void *)pyclingo_call },
-  { "pyclingo_callable", (void *)&_cffi_externpy__pyclingo_callable, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1235), (void *)pyclingo_callable },
-  { "pyclingo_execute", (void *)&_cffi_externpy__pyclingo_execute, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1263), (void *)pyclingo_execute },
-  { "pyclingo_ground_callback", (void *)&_cffi_externpy__pyclingo_ground_callback, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 483), (void *)pyclingo_ground_callback },
+  { "pyclingo_application_main", (void *)&_cffi_externpy__pyclingo_application_main, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1361), (void *)pyclingo_application_main },
+  { "pyclingo_application_message_limit", (void *)&_cffi_externpy__pyclingo_application_message_limit, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1464), (void *)pyclingo_application_message_limit },
+  { "pyclingo_application_options_parse", (void *)&_cffi_externpy__pyclingo_application_options_parse, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 687), (void *)pyclingo_application_options_parse },
+  { "pyclingo_application_print_model", (void *)&_cffi_externpy__pyclingo_application_print_model, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1367), (void *)pyclingo_application_print_model },
+  { "pyclingo_application_program_name", (void *)&_cffi_externpy__pyclingo_application_program_name, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1394), (void *)pyclingo_application_program_name },
+  { "pyclingo_application_register_options", (void *)&_cffi_externpy__pyclingo_application_register_options, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1368), (void *)pyclingo_application_register_options },
+  { "pyclingo_application_validate_options", (void *)&_cffi_externpy__pyclingo_application_validate_options, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 615), (void *)pyclingo_application_validate_options },
+  { "pyclingo_application_version", (void *)&_cffi_externpy__pyclingo_application_version, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1394), (void *)pyclingo_application_version },
+  { "pyclingo_ast_callback", (void *)&_cffi_externpy__pyclingo_ast_callback, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1360), (void *)pyclingo_ast_callback },
+  { "pyclingo_call", (void *)&_cffi_externpy__pyclingo_call, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1392), (void *)pyclingo_call },
+  { "pyclingo_callable", (void *)&_cffi_externpy__pyclingo_callable, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1359), (void *)pyclingo_callable },
+  { "pyclingo_execute", (void *)&_cffi_externpy__pyclingo_execute, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1391), (void *)pyclingo_execute },
+  { "pyclingo_ground_callback", (void *)&_cffi_externpy__pyclingo_ground_callback, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 491), (void *)pyclingo_ground_callback },
   { "pyclingo_logger_callback", (void *)&_cffi_externpy__pyclingo_logger_callback, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 27), (void *)pyclingo_logger_callback },
-  { "pyclingo_main", (void *)&_cffi_externpy__pyclingo_main, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1265), (void *)pyclingo_main },
-  { "pyclingo_observer_acyc_edge", (void *)&_cffi_externpy__pyclingo_observer_acyc_edge, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1249), (void *)pyclingo_observer_acyc_edge },
-  { "pyclingo_observer_assume", (void *)&_cffi_externpy__pyclingo_observer_assume, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1250), (void *)pyclingo_observer_assume },
-  { "pyclingo_observer_begin_step", (void *)&_cffi_externpy__pyclingo_observer_begin_step, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 607), (void *)pyclingo_observer_begin_step },
-  { "pyclingo_observer_end_step", (void *)&_cffi_externpy__pyclingo_observer_end_step, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 607), (void *)pyclingo_observer_end_step },
-  { "pyclingo_observer_external", (void *)&_cffi_externpy__pyclingo_observer_external, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1257), (void *)pyclingo_observer_external },
-  { "pyclingo_observer_heuristic", (void *)&_cffi_externpy__pyclingo_observer_heuristic, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1255), (void *)pyclingo_observer_heuristic },
-  { "pyclingo_observer_init_program", (void *)&_cffi_externpy__pyclingo_observer_init_program, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1234), (void *)pyclingo_observer_init_program },
-  { "pyclingo_observer_minimize", (void *)&_cffi_externpy__pyclingo_observer_minimize, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1251), (void *)pyclingo_observer_minimize },
-  { "pyclingo_observer_output_atom", (void *)&_cffi_externpy__pyclingo_observer_output_atom, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1262), (void *)pyclingo_observer_output_atom },
-  { "pyclingo_observer_output_term", (void *)&_cffi_externpy__pyclingo_observer_output_term, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1261), (void *)pyclingo_observer_output_term },
-  { "pyclingo_observer_project", (void *)&_cffi_externpy__pyclingo_observer_project, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1252), (void *)pyclingo_observer_project },
-  { "pyclingo_observer_rule", (void *)&_cffi_externpy__pyclingo_observer_rule, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1232), (void *)pyclingo_observer_rule },
-  { "pyclingo_observer_theory_atom", (void *)&_cffi_externpy__pyclingo_observer_theory_atom, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1260), (void *)pyclingo_observer_theory_atom },
-  { "pyclingo_observer_theory_atom_with_guard", (void *)&_cffi_externpy__pyclingo_observer_theory_atom_with_guard, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1259), (void *)pyclingo_observer_theory_atom_with_guard },
-  { "pyclingo_observer_theory_element", (void *)&_cffi_externpy__pyclingo_observer_theory_element, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1258), (void *)pyclingo_observer_theory_element },
-  { "pyclingo_observer_theory_term_compound", (void *)&_cffi_externpy__pyclingo_observer_theory_term_compound, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1256), (void *)pyclingo_observer_theory_term_compound },
-  { "pyclingo_observer_theory_term_number", (void *)&_cffi_externpy__pyclingo_observer_theory_term_number, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1257), (void *)pyclingo_observer_theory_term_number },
-  { "pyclingo_observer_theory_term_string", (void *)&_cffi_externpy__pyclingo_observer_theory_term_string, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1253), (void *)pyclingo_observer_theory_term_string },
-  { "pyclingo_observer_weight_rule", (void *)&_cffi_externpy__pyclingo_observer_weight_rule, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1233), (void *)pyclingo_observer_weight_rule },
-  { "pyclingo_propagator_check", (void *)&_cffi_externpy__pyclingo_propagator_check, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1246), (void *)pyclingo_propagator_check },
-  { "pyclingo_propagator_decide", (void *)&_cffi_externpy__pyclingo_propagator_decide, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1254), (void *)pyclingo_propagator_decide },
-  { "pyclingo_propagator_init", (void *)&_cffi_externpy__pyclingo_propagator_init, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1247), (void *)pyclingo_propagator_init },
-  { "pyclingo_propagator_propagate", (void *)&_cffi_externpy__pyclingo_propagator_propagate, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1245), (void *)pyclingo_propagator_propagate },
-  { "pyclingo_propagator_undo", (void *)&_cffi_externpy__pyclingo_propagator_undo, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1332), (void *)pyclingo_propagator_undo },
-  { "pyclingo_script_call", (void *)&_cffi_externpy__pyclingo_script_call, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1240), (void *)pyclingo_script_call },
-  { "pyclingo_script_callable", (void *)&_cffi_externpy__pyclingo_script_callable, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1235), (void *)pyclingo_script_callable },
-  { "pyclingo_script_execute", (void *)&_cffi_externpy__pyclingo_script_execute, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1239), (void *)pyclingo_script_execute },
-  { "pyclingo_script_main", (void *)&_cffi_externpy__pyclingo_script_main, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1238), (void *)pyclingo_script_main },
-  { "pyclingo_solve_event_callback", (void *)&_cffi_externpy__pyclingo_solve_event_callback, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 522), (void *)pyclingo_solve_event_callback },
+  { "pyclingo_main", (void *)&_cffi_externpy__pyclingo_main, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1393), (void *)pyclingo_main },
+  { "pyclingo_observer_acyc_edge", (void *)&_cffi_externpy__pyclingo_observer_acyc_edge, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1377), (void *)pyclingo_observer_acyc_edge },
+  { "pyclingo_observer_assume", (void *)&_cffi_externpy__pyclingo_observer_assume, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1378), (void *)pyclingo_observer_assume },
+  { "pyclingo_observer_begin_step", (void *)&_cffi_externpy__pyclingo_observer_begin_step, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 615), (void *)pyclingo_observer_begin_step },
+  { "pyclingo_observer_end_step", (void *)&_cffi_externpy__pyclingo_observer_end_step, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 615), (void *)pyclingo_observer_end_step },
+  { "pyclingo_observer_external", (void *)&_cffi_externpy__pyclingo_observer_external, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1385), (void *)pyclingo_observer_external },
+  { "pyclingo_observer_heuristic", (void *)&_cffi_externpy__pyclingo_observer_heuristic, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1383), (void *)pyclingo_observer_heuristic },
+  { "pyclingo_observer_init_program", (void *)&_cffi_externpy__pyclingo_observer_init_program, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1358), (void *)pyclingo_observer_init_program },
+  { "pyclingo_observer_minimize", (void *)&_cffi_externpy__pyclingo_observer_minimize, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1379), (void *)pyclingo_observer_minimize },
+  { "pyclingo_observer_output_atom", (void *)&_cffi_externpy__pyclingo_observer_output_atom, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1390), (void *)pyclingo_observer_output_atom },
+  { "pyclingo_observer_output_atoms", (void *)&_cffi_externpy__pyclingo_observer_output_atoms, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1369), (void *)pyclingo_observer_output_atoms },
+  { "pyclingo_observer_output_term", (void *)&_cffi_externpy__pyclingo_observer_output_term, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1389), (void *)pyclingo_observer_output_term },
+  { "pyclingo_observer_project", (void *)&_cffi_externpy__pyclingo_observer_project, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1380), (void *)pyclingo_observer_project },
+  { "pyclingo_observer_rule", (void *)&_cffi_externpy__pyclingo_observer_rule, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1356), (void *)pyclingo_observer_rule },
+  { "pyclingo_observer_rules", (void *)&_cffi_externpy__pyclingo_observer_rules, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1373), (void *)pyclingo_observer_rules },
+  { "pyclingo_observer_theory_atom", (void *)&_cffi_externpy__pyclingo_observer_theory_atom, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1388), (void *)pyclingo_observer_theory_atom },
+  { "pyclingo_observer_theory_atom_with_guard", (void *)&_cffi_externpy__pyclingo_observer_theory_atom_with_guard, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1387), (void *)pyclingo_observer_theory_atom_with_guard },
+  { "pyclingo_observer_theory_element", (void *)&_cffi_externpy__pyclingo_observer_theory_element, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1386), (void *)pyclingo_observer_theory_element },
+  { "pyclingo_observer_theory_elements", (void *)&_cffi_externpy__pyclingo_observer_theory_elements, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1374), (void *)pyclingo_observer_theory_elements },
+  { "pyclingo_observer_theory_term_compound", (void *)&_cffi_externpy__pyclingo_observer_theory_term_compound, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1384), (void *)pyclingo_observer_theory_term_compound },
+  { "pyclingo_observer_theory_term_number", (void *)&_cffi_externpy__pyclingo_observer_theory_term_number, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1385), (void *)pyclingo_observer_theory_term_number },
+  { "pyclingo_observer_theory_term_string", (void *)&_cffi_externpy__pyclingo_observer_theory_term_string, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1381), (void *)pyclingo_observer_theory_term_string },
+  { "pyclingo_observer_weight_rule", (void *)&_cffi_externpy__pyclingo_observer_weight_rule, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1357), (void *)pyclingo_observer_weight_rule },
+  { "pyclingo_observer_weight_rules", (void *)&_cffi_externpy__pyclingo_observer_weight_rules, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1375), (void *)pyclingo_observer_weight_rules },
+  { "pyclingo_propagator_check", (void *)&_cffi_externpy__pyclingo_propagator_check, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1371), (void *)pyclingo_propagator_check },
+  { "pyclingo_propagator_decide", (void *)&_cffi_externpy__pyclingo_propagator_decide, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1382), (void *)pyclingo_propagator_decide },
+  { "pyclingo_propagator_init", (void *)&_cffi_externpy__pyclingo_propagator_init, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1372), (void *)pyclingo_propagator_init },
+  { "pyclingo_propagator_propagate", (void *)&_cffi_externpy__pyclingo_propagator_propagate, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1370), (void *)pyclingo_propagator_propagate },
+  { "pyclingo_propagator_undo", (void *)&_cffi_externpy__pyclingo_propagator_undo, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1465), (void *)pyclingo_propagator_undo },
+  { "pyclingo_script_call", (void *)&_cffi_externpy__pyclingo_script_call, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1364), (void *)pyclingo_script_call },
+  { "pyclingo_script_callable", (void *)&_cffi_externpy__pyclingo_script_callable, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1359), (void *)pyclingo_script_callable },
+  { "pyclingo_script_execute", (void *)&_cffi_externpy__pyclingo_script_execute, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1363), (void *)pyclingo_script_execute },
+  { "pyclingo_script_main", (void *)&_cffi_externpy__pyclingo_script_main, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 1362), (void *)pyclingo_script_main },
+  { "pyclingo_solve_event_callback", (void *)&_cffi_externpy__pyclingo_solve_event_callback, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 530), (void *)pyclingo_solve_event_callback },
 };
 
 static const struct _cffi_field_s _cffi_fields[] = {
   { "program_name", offsetof(clingo_application_t, program_name),
                     sizeof(((clingo_application_t *)0)->program_name),
-                    _CFFI_OP(_CFFI_OP_NOOP, 1266) },
+                    _CFFI_OP(_CFFI_OP_NOOP, 1394) },
   { "version", offsetof(clingo_application_t, version),
                sizeof(((clingo_application_t *)0)->version),
-               _CFFI_OP(_CFFI_OP_NOOP, 1266) },
+               _CFFI_OP(_CFFI_OP_NOOP, 1394) },
   { "message_limit", offsetof(clingo_application_t, message_limit),
                      sizeof(((clingo_application_t *)0)->message_limit),
-                     _CFFI_OP(_CFFI_OP_NOOP, 1331) },
+                     _CFFI_OP(_CFFI_OP_NOOP, 1464) },
   { "main", offsetof(clingo_application_t, main),
             sizeof(((clingo_application_t *)0)->main),
-            _CFFI_OP(_CFFI_OP_NOOP, 1237) },
+            _CFFI_OP(_CFFI_OP_NOOP, 1361) },
   { "logger", offsetof(clingo_application_t, logger),
               sizeof(((clingo_application_t *)0)->logger),
               _CFFI_OP(_CFFI_OP_NOOP, 27) },
   { "printer", offsetof(clingo_application_t, printer),
                sizeof(((clingo_application_t *)0)->printer),
-               _CFFI_OP(_CFFI_OP_NOOP, 1243) },
+               _CFFI_OP(_CFFI_OP_NOOP, 1367) },
   { "register_options", offsetof(clingo_application_t, register_options),
                         sizeof(((clingo_application_t *)0)->register_options),
-                        _CFFI_OP(_CFFI_OP_NOOP, 1244) },
+                        _CFFI_OP(_CFFI_OP_NOOP, 1368) },
   { "validate_options", offsetof(clingo_application_t, validate_options),
                         sizeof(((clingo_application_t *)0)->validate_options),
-                        _CFFI_OP(_CFFI_OP_NOOP, 607) },
+                        _CFFI_OP(_CFFI_OP_NOOP, 615) },
   { "attribute", offsetof(clingo_ast_argument_t, attribute),
                  sizeof(((clingo_ast_argument_t *)0)->attribute),
                  _CFFI_OP(_CFFI_OP_NOOP, 155) },
@@ -19845,73 +21646,85 @@ static const struct _cffi_field_s _cffi_fields[] = {
             _CFFI_OP(_CFFI_OP_NOOP, 40) },
   { "arguments", offsetof(clingo_ast_constructor_t, arguments),
                  sizeof(((clingo_ast_constructor_t *)0)->arguments),
-                 _CFFI_OP(_CFFI_OP_NOOP, 1270) },
+                 _CFFI_OP(_CFFI_OP_NOOP, 1398) },
   { "size", offsetof(clingo_ast_constructor_t, size),
             sizeof(((clingo_ast_constructor_t *)0)->size),
             _CFFI_OP(_CFFI_OP_NOOP, 3) },
   { "constructors", offsetof(clingo_ast_constructors_t, constructors),
                     sizeof(((clingo_ast_constructors_t *)0)->constructors),
-                    _CFFI_OP(_CFFI_OP_NOOP, 1273) },
+                    _CFFI_OP(_CFFI_OP_NOOP, 1401) },
   { "size", offsetof(clingo_ast_constructors_t, size),
             sizeof(((clingo_ast_constructors_t *)0)->size),
             _CFFI_OP(_CFFI_OP_NOOP, 3) },
+  { "rules", offsetof(clingo_ground_program_batch_observer_t, rules),
+             sizeof(((clingo_ground_program_batch_observer_t *)0)->rules),
+             _CFFI_OP(_CFFI_OP_NOOP, 1373) },
+  { "weight_rules", offsetof(clingo_ground_program_batch_observer_t, weight_rules),
+                    sizeof(((clingo_ground_program_batch_observer_t *)0)->weight_rules),
+                    _CFFI_OP(_CFFI_OP_NOOP, 1375) },
+  { "output_atoms", offsetof(clingo_ground_program_batch_observer_t, output_atoms),
+                    sizeof(((clingo_ground_program_batch_observer_t *)0)->output_atoms),
+                    _CFFI_OP(_CFFI_OP_NOOP, 1369) },
+  { "theory_elements", offsetof(clingo_ground_program_batch_observer_t, theory_elements),
+                       sizeof(((clingo_ground_program_batch_observer_t *)0)->theory_elements),
+                       _CFFI_OP(_CFFI_OP_NOOP, 1374) },
   { "init_program", offsetof(clingo_ground_program_observer_t, init_program),
                     sizeof(((clingo_ground_program_observer_t *)0)->init_program),
-                    _CFFI_OP(_CFFI_OP_NOOP, 1234) },
+                    _CFFI_OP(_CFFI_OP_NOOP, 1358) },
   { "begin_step", offsetof(clingo_ground_program_observer_t, begin_step),
                   sizeof(((clingo_ground_program_observer_t *)0)->begin_step),
-                  _CFFI_OP(_CFFI_OP_NOOP, 607) },
+                  _CFFI_OP(_CFFI_OP_NOOP, 615) },
   { "end_step", offsetof(clingo_ground_program_observer_t, end_step),
                 sizeof(((clingo_ground_program_observer_t *)0)->end_step),
-                _CFFI_OP(_CFFI_OP_NOOP, 607) },
+                _CFFI_OP(_CFFI_OP_NOOP, 615) },
   { "rule", offsetof(clingo_ground_program_observer_t, rule),
             sizeof(((clingo_ground_program_observer_t *)0)->rule),
-            _CFFI_OP(_CFFI_OP_NOOP, 1232) },
+            _CFFI_OP(_CFFI_OP_NOOP, 1356) },
   { "weight_rule", offsetof(clingo_ground_program_observer_t, weight_rule),
                    sizeof(((clingo_ground_program_observer_t *)0)->weight_rule),
-                   _CFFI_OP(_CFFI_OP_NOOP, 1233) },
+                   _CFFI_OP(_CFFI_OP_NOOP, 1357) },
   { "minimize", offsetof(clingo_ground_program_observer_t, minimize),
                 sizeof(((clingo_ground_program_observer_t *)0)->minimize),
-                _CFFI_OP(_CFFI_OP_NOOP, 1251) },
+                _CFFI_OP(_CFFI_OP_NOOP, 1379) },
   { "project", offsetof(clingo_ground_program_observer_t, project),
                sizeof(((clingo_ground_program_observer_t *)0)->project),
-               _CFFI_OP(_CFFI_OP_NOOP, 1252) },
+               _CFFI_OP(_CFFI_OP_NOOP, 1380) },
   { "output_atom", offsetof(clingo_ground_program_observer_t, output_atom),
                    sizeof(((clingo_ground_program_observer_t *)0)->output_atom),
-                   _CFFI_OP(_CFFI_OP_NOOP, 1262) },
+                   _CFFI_OP(_CFFI_OP_NOOP, 1390) },
   { "output_term", offsetof(clingo_ground_program_observer_t, output_term),
                    sizeof(((clingo_ground_program_observer_t *)0)->output_term),
-                   _CFFI_OP(_CFFI_OP_NOOP, 1261) },
+                   _CFFI_OP(_CFFI_OP_NOOP, 1389) },
   { "external", offsetof(clingo_ground_program_observer_t, external),
                 sizeof(((clingo_ground_program_observer_t *)0)->external),
-                _CFFI_OP(_CFFI_OP_NOOP, 1257) },
+                _CFFI_OP(_CFFI_OP_NOOP, 1385) },
   { "assume", offsetof(clingo_ground_program_observer_t, assume),
               sizeof(((clingo_ground_program_observer_t *)0)->assume),
-              _CFFI_OP(_CFFI_OP_NOOP, 1250) },
+              _CFFI_OP(_CFFI_OP_NOOP, 1378) },
   { "heuristic", offsetof(clingo_ground_program_observer_t, heuristic),
                  sizeof(((clingo_ground_program_observer_t *)0)->heuristic),
-                 _CFFI_OP(_CFFI_OP_NOOP, 1255) },
+                 _CFFI_OP(_CFFI_OP_NOOP, 1383) },
   { "acyc_edge", offsetof(clingo_ground_program_observer_t, acyc_edge),
                  sizeof(((clingo_ground_program_observer_t *)0)->acyc_edge),
-                 _CFFI_OP(_CFFI_OP_NOOP, 1249) },
+                 _CFFI_OP(_CFFI_OP_NOOP, 1377) },
   { "theory_term_number", offsetof(clingo_ground_program_observer_t, theory_term_number),
                           sizeof(((clingo_ground_program_observer_t *)0)->theory_term_number),
-                          _CFFI_OP(_CFFI_OP_NOOP, 1257) },
+                          _CFFI_OP(_CFFI_OP_NOOP, 1385) },
   { "theory_term_string", offsetof(clingo_ground_program_observer_t, theory_term_string),
                           sizeof(((clingo_ground_program_observer_t *)0)->theory_term_string),
-                          _CFFI_OP(_CFFI_OP_NOOP, 1253) },
+                          _CFFI_OP(_CFFI_OP_NOOP, 1381) },
   { "theory_term_compound", offsetof(clingo_ground_program_observer_t, theory_term_compound),
                             sizeof(((clingo_ground_program_observer_t *)0)->theory_term_compound),
-                            _CFFI_OP(_CFFI_OP_NOOP, 1256) },
+                            _CFFI_OP(_CFFI_OP_NOOP, 1384) },
   { "theory_element", offsetof(clingo_ground_program_observer_t, theory_element),
                       sizeof(((clingo_ground_program_observer_t *)0)->theory_element),
-                      _CFFI_OP(_CFFI_OP_NOOP, 1258) },
+                      _CFFI_OP(_CFFI_OP_NOOP, 1386) },
   { "theory_atom", offsetof(clingo_ground_program_observer_t, theory_atom),
                    sizeof(((clingo_ground_program_observer_t *)0)->theory_atom),
-                   _CFFI_OP(_CFFI_OP_NOOP, 1260) },
+                   _CFFI_OP(_CFFI_OP_NOOP, 1388) },
   { "theory_atom_with_guard", offsetof(clingo_ground_program_observer_t, theory_atom_with_guard),
                               sizeof(((clingo_ground_program_observer_t *)0)->theory_atom_with_guard),
-                              _CFFI_OP(_CFFI_OP_NOOP, 1259) },
+                              _CFFI_OP(_CFFI_OP_NOOP, 1387) },
   { "begin_file", offsetof(clingo_location_t, begin_file),
                   sizeof(((clingo_location_t *)0)->begin_file),
                   _CFFI_OP(_CFFI_OP_NOOP, 40) },
@@ -19930,6 +21743,15 @@ static const struct _cffi_field_s _cffi_fields[] = {
   { "end_column", offsetof(clingo_location_t, end_column),
                   sizeof(((clingo_location_t *)0)->end_column),
                   _CFFI_OP(_CFFI_OP_NOOP, 3) },
+  { "symbols", offsetof(clingo_output_atom_batch_t, symbols),
+               sizeof(((clingo_output_atom_batch_t *)0)->symbols),
+               _CFFI_OP(_CFFI_OP_NOOP, 79) },
+  { "atoms", offsetof(clingo_output_atom_batch_t, atoms),
+             sizeof(((clingo_output_atom_batch_t *)0)->atoms),
+             _CFFI_OP(_CFFI_OP_NOOP, 2) },
+  { "size", offsetof(clingo_output_atom_batch_t, size),
+            sizeof(((clingo_output_atom_batch_t *)0)->size),
+            _CFFI_OP(_CFFI_OP_NOOP, 3) },
   { "name", offsetof(clingo_part_t, name),
             sizeof(((clingo_part_t *)0)->name),
             _CFFI_OP(_CFFI_OP_NOOP, 40) },
@@ -19941,37 +21763,94 @@ static const struct _cffi_field_s _cffi_fields[] = {
             _CFFI_OP(_CFFI_OP_NOOP, 3) },
   { "init", offsetof(clingo_propagator_t, init),
             sizeof(((clingo_propagator_t *)0)->init),
-            _CFFI_OP(_CFFI_OP_NOOP, 1247) },
+            _CFFI_OP(_CFFI_OP_NOOP, 1372) },
   { "propagate", offsetof(clingo_propagator_t, propagate),
                  sizeof(((clingo_propagator_t *)0)->propagate),
-                 _CFFI_OP(_CFFI_OP_NOOP, 1245) },
+                 _CFFI_OP(_CFFI_OP_NOOP, 1370) },
   { "undo", offsetof(clingo_propagator_t, undo),
             sizeof(((clingo_propagator_t *)0)->undo),
-            _CFFI_OP(_CFFI_OP_NOOP, 1332) },
+            _CFFI_OP(_CFFI_OP_NOOP, 1465) },
   { "check", offsetof(clingo_propagator_t, check),
              sizeof(((clingo_propagator_t *)0)->check),
-             _CFFI_OP(_CFFI_OP_NOOP, 1246) },
+             _CFFI_OP(_CFFI_OP_NOOP, 1371) },
   { "decide", offsetof(clingo_propagator_t, decide),
               sizeof(((clingo_propagator_t *)0)->decide),
-              _CFFI_OP(_CFFI_OP_NOOP, 1254) },
+              _CFFI_OP(_CFFI_OP_NOOP, 1382) },
+  { "choices", offsetof(clingo_rule_batch_t, choices),
+               sizeof(((clingo_rule_batch_t *)0)->choices),
+               _CFFI_OP(_CFFI_OP_NOOP, 1355) },
+  { "head_offsets", offsetof(clingo_rule_batch_t, head_offsets),
+                    sizeof(((clingo_rule_batch_t *)0)->head_offsets),
+                    _CFFI_OP(_CFFI_OP_NOOP, 718) },
+  { "heads", offsetof(clingo_rule_batch_t, heads),
+             sizeof(((clingo_rule_batch_t *)0)->heads),
+             _CFFI_OP(_CFFI_OP_NOOP, 2) },
+  { "body_offsets", offsetof(clingo_rule_batch_t, body_offsets),
+                    sizeof(((clingo_rule_batch_t *)0)->body_offsets),
+                    _CFFI_OP(_CFFI_OP_NOOP, 718) },
+  { "bodies", offsetof(clingo_rule_batch_t, bodies),
+              sizeof(((clingo_rule_batch_t *)0)->bodies),
+              _CFFI_OP(_CFFI_OP_NOOP, 4) },
+  { "size", offsetof(clingo_rule_batch_t, size),
+            sizeof(((clingo_rule_batch_t *)0)->size),
+            _CFFI_OP(_CFFI_OP_NOOP, 3) },
   { "execute", offsetof(clingo_script_t, execute),
                sizeof(((clingo_script_t *)0)->execute),
-               _CFFI_OP(_CFFI_OP_NOOP, 1242) },
+               _CFFI_OP(_CFFI_OP_NOOP, 1366) },
   { "call", offsetof(clingo_script_t, call),
             sizeof(((clingo_script_t *)0)->call),
-            _CFFI_OP(_CFFI_OP_NOOP, 1241) },
+            _CFFI_OP(_CFFI_OP_NOOP, 1365) },
   { "callable", offsetof(clingo_script_t, callable),
                 sizeof(((clingo_script_t *)0)->callable),
-                _CFFI_OP(_CFFI_OP_NOOP, 1235) },
+                _CFFI_OP(_CFFI_OP_NOOP, 1359) },
   { "main", offsetof(clingo_script_t, main),
             sizeof(((clingo_script_t *)0)->main),
-            _CFFI_OP(_CFFI_OP_NOOP, 1238) },
+            _CFFI_OP(_CFFI_OP_NOOP, 1362) },
   { "free", offsetof(clingo_script_t, free),
             sizeof(((clingo_script_t *)0)->free),
-            _CFFI_OP(_CFFI_OP_NOOP, 1333) },
+            _CFFI_OP(_CFFI_OP_NOOP, 1466) },
   { "version", offsetof(clingo_script_t, version),
                sizeof(((clingo_script_t *)0)->version),
                _CFFI_OP(_CFFI_OP_NOOP, 40) },
+  { "element_ids", offsetof(clingo_theory_element_batch_t, element_ids),
+                   sizeof(((clingo_theory_element_batch_t *)0)->element_ids),
+                   _CFFI_OP(_CFFI_OP_NOOP, 2) },
+  { "term_offsets", offsetof(clingo_theory_element_batch_t, term_offsets),
+                    sizeof(((clingo_theory_element_batch_t *)0)->term_offsets),
+                    _CFFI_OP(_CFFI_OP_NOOP, 718) },
+  { "terms", offsetof(clingo_theory_element_batch_t, terms),
+             sizeof(((clingo_theory_element_batch_t *)0)->terms),
+             _CFFI_OP(_CFFI_OP_NOOP, 2) },
+  { "condition_offsets", offsetof(clingo_theory_element_batch_t, condition_offsets),
+                         sizeof(((clingo_theory_element_batch_t *)0)->condition_offsets),
+                         _CFFI_OP(_CFFI_OP_NOOP, 718) },
+  { "conditions", offsetof(clingo_theory_element_batch_t, conditions),
+                  sizeof(((clingo_theory_element_batch_t *)0)->conditions),
+                  _CFFI_OP(_CFFI_OP_NOOP, 4) },
+  { "size", offsetof(clingo_theory_element_batch_t, size),
+            sizeof(((clingo_theory_element_batch_t *)0)->size),
+            _CFFI_OP(_CFFI_OP_NOOP, 3) },
+  { "choices", offsetof(clingo_weight_rule_batch_t, choices),
+               sizeof(((clingo_weight_rule_batch_t *)0)->choices),
+               _CFFI_OP(_CFFI_OP_NOOP, 1355) },
+  { "head_offsets", offsetof(clingo_weight_rule_batch_t, head_offsets),
+                    sizeof(((clingo_weight_rule_batch_t *)0)->head_offsets),
+                    _CFFI_OP(_CFFI_OP_NOOP, 718) },
+  { "heads", offsetof(clingo_weight_rule_batch_t, heads),
+             sizeof(((clingo_weight_rule_batch_t *)0)->heads),
+             _CFFI_OP(_CFFI_OP_NOOP, 2) },
+  { "lower_bounds", offsetof(clingo_weight_rule_batch_t, lower_bounds),
+                    sizeof(((clingo_weight_rule_batch_t *)0)->lower_bounds),
+                    _CFFI_OP(_CFFI_OP_NOOP, 4) },
+  { "body_offsets", offsetof(clingo_weight_rule_batch_t, body_offsets),
+                    sizeof(((clingo_weight_rule_batch_t *)0)->body_offsets),
+                    _CFFI_OP(_CFFI_OP_NOOP, 718) },
+  { "bodies", offsetof(clingo_weight_rule_batch_t, bodies),
+              sizeof(((clingo_weight_rule_batch_t *)0)->bodies),
+              _CFFI_OP(_CFFI_OP_NOOP, 13) },
+  { "size", offsetof(clingo_weight_rule_batch_t, size),
+            sizeof(((clingo_weight_rule_batch_t *)0)->size),
+            _CFFI_OP(_CFFI_OP_NOOP, 3) },
   { "literal", offsetof(clingo_weighted_literal_t, literal),
                sizeof(((clingo_weighted_literal_t *)0)->literal),
                _CFFI_OP(_CFFI_OP_NOOP, 12) },
@@ -19981,146 +21860,156 @@ static const struct _cffi_field_s _cffi_fields[] = {
 };
 
 static const struct _cffi_struct_union_s _cffi_struct_unions[] = {
-  { "clingo_application", 1268, _CFFI_F_CHECK_FIELDS,
+  { "clingo_application", 1396, _CFFI_F_CHECK_FIELDS,
     sizeof(clingo_application_t), offsetof(struct _cffi_align__clingo_application_t, y), 0, 8 },
-  { "clingo_assignment", 1269, _CFFI_F_OPAQUE,
+  { "clingo_assignment", 1397, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_ast", 1276, _CFFI_F_OPAQUE,
+  { "clingo_ast", 1404, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_ast_argument", 1271, _CFFI_F_CHECK_FIELDS,
+  { "clingo_ast_argument", 1399, _CFFI_F_CHECK_FIELDS,
     sizeof(clingo_ast_argument_t), offsetof(struct _cffi_align__clingo_ast_argument_t, y), 8, 2 },
-  { "clingo_ast_attribute_names", 1272, _CFFI_F_CHECK_FIELDS,
+  { "clingo_ast_attribute_names", 1400, _CFFI_F_CHECK_FIELDS,
     sizeof(clingo_ast_attribute_names_t), offsetof(struct _cffi_align__clingo_ast_attribute_names_t, y), 10, 2 },
-  { "clingo_ast_constructor", 1274, _CFFI_F_CHECK_FIELDS,
+  { "clingo_ast_constructor", 1402, _CFFI_F_CHECK_FIELDS,
     sizeof(clingo_ast_constructor_t), offsetof(struct _cffi_align__clingo_ast_constructor_t, y), 12, 3 },
-  { "clingo_ast_constructors", 1275, _CFFI_F_CHECK_FIELDS,
+  { "clingo_ast_constructors", 1403, _CFFI_F_CHECK_FIELDS,
     sizeof(clingo_ast_constructors_t), offsetof(struct _cffi_align__clingo_ast_constructors_t, y), 15, 2 },
-  { "clingo_backend", 1277, _CFFI_F_OPAQUE,
+  { "clingo_backend", 1405, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_configuration", 1278, _CFFI_F_OPAQUE,
+  { "clingo_configuration", 1406, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_control", 1279, _CFFI_F_OPAQUE,
+  { "clingo_control", 1407, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_ground_program_observer", 1280, _CFFI_F_CHECK_FIELDS,
-    sizeof(clingo_ground_program_observer_t), offsetof(struct _cffi_align__clingo_ground_program_observer_t, y), 17, 19 },
-  { "clingo_location", 1281, _CFFI_F_CHECK_FIELDS,
-    sizeof(clingo_location_t), offsetof(struct _cffi_align__clingo_location_t, y), 36, 6 },
-  { "clingo_model", 1282, _CFFI_F_OPAQUE,
+  { "clingo_ground_program_batch_observer", 1408, _CFFI_F_CHECK_FIELDS,
+    sizeof(clingo_ground_program_batch_observer_t), offsetof(struct _cffi_align__clingo_ground_program_batch_observer_t, y), 17, 4 },
+  { "clingo_ground_program_observer", 1409, _CFFI_F_CHECK_FIELDS,
+    sizeof(clingo_ground_program_observer_t), offsetof(struct _cffi_align__clingo_ground_program_observer_t, y), 21, 19 },
+  { "clingo_location", 1410, _CFFI_F_CHECK_FIELDS,
+    sizeof(clingo_location_t), offsetof(struct _cffi_align__clingo_location_t, y), 40, 6 },
+  { "clingo_model", 1411, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_options", 1283, _CFFI_F_OPAQUE,
+  { "clingo_options", 1412, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_part", 1284, _CFFI_F_CHECK_FIELDS,
-    sizeof(clingo_part_t), offsetof(struct _cffi_align__clingo_part_t, y), 42, 3 },
-  { "clingo_program_builder", 1285, _CFFI_F_OPAQUE,
+  { "clingo_output_atom_batch", 1413, _CFFI_F_CHECK_FIELDS,
+    sizeof(clingo_output_atom_batch_t), offsetof(struct _cffi_align__clingo_output_atom_batch_t, y), 46, 3 },
+  { "clingo_part", 1414, _CFFI_F_CHECK_FIELDS,
+    sizeof(clingo_part_t), offsetof(struct _cffi_align__clingo_part_t, y), 49, 3 },
+  { "clingo_program_builder", 1415, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_propagate_control", 1286, _CFFI_F_OPAQUE,
+  { "clingo_propagate_control", 1416, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_propagate_init", 1287, _CFFI_F_OPAQUE,
+  { "clingo_propagate_init", 1417, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_propagator", 1288, _CFFI_F_CHECK_FIELDS,
-    sizeof(clingo_propagator_t), offsetof(struct _cffi_align__clingo_propagator_t, y), 45, 5 },
-  { "clingo_script", 1289, _CFFI_F_CHECK_FIELDS,
-    sizeof(clingo_script_t), offsetof(struct _cffi_align__clingo_script_t, y), 50, 6 },
-  { "clingo_solve_control", 1290, _CFFI_F_OPAQUE,
+  { "clingo_propagator", 1418, _CFFI_F_CHECK_FIELDS,
+    sizeof(clingo_propagator_t), offsetof(struct _cffi_align__clingo_propagator_t, y), 52, 5 },
+  { "clingo_rule_batch", 1419, _CFFI_F_CHECK_FIELDS,
+    sizeof(clingo_rule_batch_t), offsetof(struct _cffi_align__clingo_rule_batch_t, y), 57, 6 },
+  { "clingo_script", 1420, _CFFI_F_CHECK_FIELDS,
+    sizeof(clingo_script_t), offsetof(struct _cffi_align__clingo_script_t, y), 63, 6 },
+  { "clingo_solve_control", 1421, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_solve_handle", 1291, _CFFI_F_OPAQUE,
+  { "clingo_solve_handle", 1422, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_statistic", 1292, _CFFI_F_OPAQUE,
+  { "clingo_statistic", 1423, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_symbolic_atoms", 1293, _CFFI_F_OPAQUE,
+  { "clingo_symbolic_atoms", 1424, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_theory_atoms", 1294, _CFFI_F_OPAQUE,
+  { "clingo_theory_atoms", 1425, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_weighted_literal", 1295, _CFFI_F_CHECK_FIELDS,
-    sizeof(clingo_weighted_literal_t), offsetof(struct _cffi_align__clingo_weighted_literal_t, y), 56, 2 },
+  { "clingo_theory_element_batch", 1426, _CFFI_F_CHECK_FIELDS,
+    sizeof(clingo_theory_element_batch_t), offsetof(struct _cffi_align__clingo_theory_element_batch_t, y), 69, 6 },
+  { "clingo_weight_rule_batch", 1427, _CFFI_F_CHECK_FIELDS,
+    sizeof(clingo_weight_rule_batch_t), offsetof(struct _cffi_align__clingo_weight_rule_batch_t, y), 75, 7 },
+  { "clingo_weighted_literal", 1428, _CFFI_F_CHECK_FIELDS,
+    sizeof(clingo_weighted_literal_t), offsetof(struct _cffi_align__clingo_weighted_literal_t, y), 82, 2 },
 };
 
 static const struct _cffi_enum_s _cffi_enums[] = {
-  { "clingo_ast_aggregate_function_e", 1296, _cffi_prim_int(sizeof(enum clingo_ast_aggregate_function_e), ((enum clingo_ast_aggregate_function_e)-1) <= 0),
+  { "clingo_ast_aggregate_function_e", 1429, _cffi_prim_int(sizeof(enum clingo_ast_aggregate_function_e), ((enum clingo_ast_aggregate_function_e)-1) <= 0),
     "clingo_ast_aggregate_function_count,clingo_ast_aggregate_function_sum,clingo_ast_aggregate_function_sump,clingo_ast_aggregate_function_min,clingo_ast_aggregate_function_max" },
-  { "clingo_ast_attribute_e", 1297, _cffi_prim_int(sizeof(enum clingo_ast_attribute_e), ((enum clingo_ast_attribute_e)-1) <= 0),
+  { "clingo_ast_attribute_e", 1430, _cffi_prim_int(sizeof(enum clingo_ast_attribute_e), ((enum clingo_ast_attribute_e)-1) <= 0),
     "clingo_ast_attribute_argument,clingo_ast_attribute_arguments,clingo_ast_attribute_arity,clingo_ast_attribute_atom,clingo_ast_attribute_atoms,clingo_ast_attribute_atom_type,clingo_ast_attribute_bias,clingo_ast_attribute_body,clingo_ast_attribute_code,clingo_ast_attribute_coefficient,clingo_ast_attribute_comparison,clingo_ast_attribute_condition,clingo_ast_attribute_elements,clingo_ast_attribute_external,clingo_ast_attribute_external_type,clingo_ast_attribute_function,clingo_ast_attribute_guard,clingo_ast_attribute_guards,clingo_ast_attribute_head,clingo_ast_attribute_is_default,clingo_ast_attribute_left,clingo_ast_attribute_left_guard,clingo_ast_attribute_literal,clingo_ast_attribute_location,clingo_ast_attribute_modifier,clingo_ast_attribute_name,clingo_ast_attribute_node_u,clingo_ast_attribute_node_v,clingo_ast_attribute_operator_name,clingo_ast_attribute_operator_type,clingo_ast_attribute_operators,clingo_ast_attribute_parameters,clingo_ast_attribute_positive,clingo_ast_attribute_priority,clingo_ast_attribute_right,clingo_ast_attribute_right_guard,clingo_ast_attribute_sequence_type,clingo_ast_attribute_sign,clingo_ast_attribute_symbol,clingo_ast_attribute_term,clingo_ast_attribute_terms,clingo_ast_attribute_value,clingo_ast_attribute_variable,clingo_ast_attribute_weight,clingo_ast_attribute_comment_type" },
-  { "clingo_ast_attribute_type_e", 1298, _cffi_prim_int(sizeof(enum clingo_ast_attribute_type_e), ((enum clingo_ast_attribute_type_e)-1) <= 0),
+  { "clingo_ast_attribute_type_e", 1431, _cffi_prim_int(sizeof(enum clingo_ast_attribute_type_e), ((enum clingo_ast_attribute_type_e)-1) <= 0),
     "clingo_ast_attribute_type_number,clingo_ast_attribute_type_symbol,clingo_ast_attribute_type_location,clingo_ast_attribute_type_string,clingo_ast_attribute_type_ast,clingo_ast_attribute_type_optional_ast,clingo_ast_attribute_type_string_array,clingo_ast_attribute_type_ast_array" },
-  { "clingo_ast_binary_operator_e", 1299, _cffi_prim_int(sizeof(enum clingo_ast_binary_operator_e), ((enum clingo_ast_binary_operator_e)-1) <= 0),
+  { "clingo_ast_binary_operator_e", 1432, _cffi_prim_int(sizeof(enum clingo_ast_binary_operator_e), ((enum clingo_ast_binary_operator_e)-1) <= 0),
     "clingo_ast_binary_operator_xor,clingo_ast_binary_operator_or,clingo_ast_binary_operator_and,clingo_ast_binary_operator_plus,clingo_ast_binary_operator_minus,clingo_ast_binary_operator_multiplication,clingo_ast_binary_operator_division,clingo_ast_binary_operator_modulo,clingo_ast_binary_operator_power" },
-  { "clingo_ast_comparison_operator_e", 1300, _cffi_prim_int(sizeof(enum clingo_ast_comparison_operator_e), ((enum clingo_ast_comparison_operator_e)-1) <= 0),
+  { "clingo_ast_comparison_operator_e", 1433, _cffi_prim_int(sizeof(enum clingo_ast_comparison_operator_e), ((enum clingo_ast_comparison_operator_e)-1) <= 0),
     "clingo_ast_comparison_operator_greater_than,clingo_ast_comparison_operator_less_than,clingo_ast_comparison_operator_less_equal,clingo_ast_comparison_operator_greater_equal,clingo_ast_comparison_operator_not_equal,clingo_ast_comparison_operator_equal" },
-  { "clingo_ast_sign_e", 1301, _cffi_prim_int(sizeof(enum clingo_ast_sign_e), ((enum clingo_ast_sign_e)-1) <= 0),
+  { "clingo_ast_sign_e", 1434, _cffi_prim_int(sizeof(enum clingo_ast_sign_e), ((enum clingo_ast_sign_e)-1) <= 0),
     "clingo_ast_sign_no_sign,clingo_ast_sign_negation,clingo_ast_sign_double_negation" },
-  { "clingo_ast_theory_atom_definition_type_e", 1302, _cffi_prim_int(sizeof(enum clingo_ast_theory_atom_definition_type_e), ((enum clingo_ast_theory_atom_definition_type_e)-1) <= 0),
+  { "clingo_ast_theory_atom_definition_type_e", 1435, _cffi_prim_int(sizeof(enum clingo_ast_theory_atom_definition_type_e), ((enum clingo_ast_theory_atom_definition_type_e)-1) <= 0),
     "clingo_ast_theory_atom_definition_type_head,clingo_ast_theory_atom_definition_type_body,clingo_ast_theory_atom_definition_type_any,clingo_ast_theory_atom_definition_type_directive" },
-  { "clingo_ast_theory_operator_type_e", 1303, _cffi_prim_int(sizeof(enum clingo_ast_theory_operator_type_e), ((enum clingo_ast_theory_operator_type_e)-1) <= 0),
+  { "clingo_ast_theory_operator_type_e", 1436, _cffi_prim_int(sizeof(enum clingo_ast_theory_operator_type_e), ((enum clingo_ast_theory_operator_type_e)-1) <= 0),
     "clingo_ast_theory_operator_type_unary,clingo_ast_theory_operator_type_binary_left,clingo_ast_theory_operator_type_binary_right" },
-  { "clingo_ast_theory_sequence_type_e", 1304, _cffi_prim_int(sizeof(enum clingo_ast_theory_sequence_type_e), ((enum clingo_ast_theory_sequence_type_e)-1) <= 0),
+  { "clingo_ast_theory_sequence_type_e", 1437, _cffi_prim_int(sizeof(enum clingo_ast_theory_sequence_type_e), ((enum clingo_ast_theory_sequence_type_e)-1) <= 0),
     "clingo_ast_theory_sequence_type_tuple,clingo_ast_theory_sequence_type_list,clingo_ast_theory_sequence_type_set" },
-  { "clingo_ast_type_e", 1305, _cffi_prim_int(sizeof(enum clingo_ast_type_e), ((enum clingo_ast_type_e)-1) <= 0),
+  { "clingo_ast_type_e", 1438, _cffi_prim_int(sizeof(enum clingo_ast_type_e), ((enum clingo_ast_type_e)-1) <= 0),
     "clingo_ast_type_id,clingo_ast_type_variable,clingo_ast_type_symbolic_term,clingo_ast_type_unary_operation,clingo_ast_type_binary_operation,clingo_ast_type_interval,clingo_ast_type_function,clingo_ast_type_pool,clingo_ast_type_boolean_constant,clingo_ast_type_symbolic_atom,clingo_ast_type_comparison,clingo_ast_type_guard,clingo_ast_type_conditional_literal,clingo_ast_type_aggregate,clingo_ast_type_body_aggregate_element,clingo_ast_type_body_aggregate,clingo_ast_type_head_aggregate_element,clingo_ast_type_head_aggregate,clingo_ast_type_disjunction,clingo_ast_type_theory_sequence,clingo_ast_type_theory_function,clingo_ast_type_theory_unparsed_term_element,clingo_ast_type_theory_unparsed_term,clingo_ast_type_theory_guard,clingo_ast_type_theory_atom_element,clingo_ast_type_theory_atom,clingo_ast_type_literal,clingo_ast_type_theory_operator_definition,clingo_ast_type_theory_term_definition,clingo_ast_type_theory_guard_definition,clingo_ast_type_theory_atom_definition,clingo_ast_type_rule,clingo_ast_type_definition,clingo_ast_type_show_signature,clingo_ast_type_show_term,clingo_ast_type_minimize,clingo_ast_type_script,clingo_ast_type_program,clingo_ast_type_external,clingo_ast_type_edge,clingo_ast_type_heuristic,clingo_ast_type_project_atom,clingo_ast_type_project_signature,clingo_ast_type_defined,clingo_ast_type_theory_definition,clingo_ast_type_comment" },
-  { "clingo_ast_unary_operator_e", 1306, _cffi_prim_int(sizeof(enum clingo_ast_unary_operator_e), ((enum clingo_ast_unary_operator_e)-1) <= 0),
+  { "clingo_ast_unary_operator_e", 1439, _cffi_prim_int(sizeof(enum clingo_ast_unary_operator_e), ((enum clingo_ast_unary_operator_e)-1) <= 0),
     "clingo_ast_unary_operator_minus,clingo_ast_unary_operator_negation,clingo_ast_unary_operator_absolute" },
-  { "clingo_ast_unpool_type_e", 1307, _cffi_prim_int(sizeof(enum clingo_ast_unpool_type_e), ((enum clingo_ast_unpool_type_e)-1) <= 0),
+  { "clingo_ast_unpool_type_e", 1440, _cffi_prim_int(sizeof(enum clingo_ast_unpool_type_e), ((enum clingo_ast_unpool_type_e)-1) <= 0),
     "clingo_ast_unpool_type_condition,clingo_ast_unpool_type_other,clingo_ast_unpool_type_all" },
-  { "clingo_backend_type_e", 1308, _cffi_prim_int(sizeof(enum clingo_backend_type_e), ((enum clingo_backend_type_e)-1) <= 0),
+  { "clingo_backend_type_e", 1441, _cffi_prim_int(sizeof(enum clingo_backend_type_e), ((enum clingo_backend_type_e)-1) <= 0),
     "clingo_backend_type_reify,clingo_backend_type_reify_sccs,clingo_backend_type_reify_steps,clingo_backend_type_aspif,clingo_backend_type_smodels" },
-  { "clingo_clause_type_e", 1309, _cffi_prim_int(sizeof(enum clingo_clause_type_e), ((enum clingo_clause_type_e)-1) <= 0),
+  { "clingo_clause_type_e", 1442, _cffi_prim_int(sizeof(enum clingo_clause_type_e), ((enum clingo_clause_type_e)-1) <= 0),
     "clingo_clause_type_learnt,clingo_clause_type_static,clingo_clause_type_volatile,clingo_clause_type_volatile_static" },
-  { "clingo_comment_type_e", 1310, _cffi_prim_int(sizeof(enum clingo_comment_type_e), ((enum clingo_comment_type_e)-1) <= 0),
+  { "clingo_comment_type_e", 1443, _cffi_prim_int(sizeof(enum clingo_comment_type_e), ((enum clingo_comment_type_e)-1) <= 0),
     "clingo_comment_type_line,clingo_comment_type_block" },
-  { "clingo_configuration_type_e", 1311, _cffi_prim_int(sizeof(enum clingo_configuration_type_e), ((enum clingo_configuration_type_e)-1) <= 0),
+  { "clingo_configuration_type_e", 1444, _cffi_prim_int(sizeof(enum clingo_configuration_type_e), ((enum clingo_configuration_type_e)-1) <= 0),
     "clingo_configuration_type_value,clingo_configuration_type_array,clingo_configuration_type_map" },
-  { "clingo_consequence_e", 1312, _cffi_prim_int(sizeof(enum clingo_consequence_e), ((enum clingo_consequence_e)-1) <= 0),
+  { "clingo_consequence_e", 1445, _cffi_prim_int(sizeof(enum clingo_consequence_e), ((enum clingo_consequence_e)-1) <= 0),
     "clingo_consequence_false,clingo_consequence_true,clingo_consequence_unknown" },
-  { "clingo_error_e", 1313, _cffi_prim_int(sizeof(enum clingo_error_e), ((enum clingo_error_e)-1) <= 0),
+  { "clingo_error_e", 1446, _cffi_prim_int(sizeof(enum clingo_error_e), ((enum clingo_error_e)-1) <= 0),
     "clingo_error_success,clingo_error_runtime,clingo_error_logic,clingo_error_bad_alloc,clingo_error_unknown" },
-  { "clingo_external_type_e", 1314, _cffi_prim_int(sizeof(enum clingo_external_type_e), ((enum clingo_external_type_e)-1) <= 0),
+  { "clingo_external_type_e", 1447, _cffi_prim_int(sizeof(enum clingo_external_type_e), ((enum clingo_external_type_e)-1) <= 0),
     "clingo_external_type_free,clingo_external_type_true,clingo_external_type_false,clingo_external_type_release" },
-  { "clingo_heuristic_type_e", 1315, _cffi_prim_int(sizeof(enum clingo_heuristic_type_e), ((enum clingo_heuristic_type_e)-1) <= 0),
+  { "clingo_heuristic_type_e", 1448, _cffi_prim_int(sizeof(enum clingo_heuristic_type_e), ((enum clingo_heuristic_type_e)-1) <= 0),
     "clingo_heuristic_type_level,clingo_heuristic_type_sign,clingo_heuristic_type_factor,clingo_heuristic_type_init,clingo_heuristic_type_true,clingo_heuristic_type_false" },
-  { "clingo_model_type_e", 1316, _cffi_prim_int(sizeof(enum clingo_model_type_e), ((enum clingo_model_type_e)-1) <= 0),
+  { "clingo_model_type_e", 1449, _cffi_prim_int(sizeof(enum clingo_model_type_e), ((enum clingo_model_type_e)-1) <= 0),
     "clingo_model_type_stable_model,clingo_model_type_brave_consequences,clingo_model_type_cautious_consequences" },
-  { "clingo_propagator_check_mode_e", 1317, _cffi_prim_int(sizeof(enum clingo_propagator_check_mode_e), ((enum clingo_propagator_check_mode_e)-1) <= 0),
+  { "clingo_propagator_check_mode_e", 1450, _cffi_prim_int(sizeof(enum clingo_propagator_check_mode_e), ((enum clingo_propagator_check_mode_e)-1) <= 0),
     "clingo_propagator_check_mode_none,clingo_propagator_check_mode_total,clingo_propagator_check_mode_fixpoint,clingo_propagator_check_mode_both" },
-  { "clingo_propagator_undo_mode_e", 1318, _cffi_prim_int(sizeof(enum clingo_propagator_undo_mode_e), ((enum clingo_propagator_undo_mode_e)-1) <= 0),
+  { "clingo_propagator_undo_mode_e", 1451, _cffi_prim_int(sizeof(enum clingo_propagator_undo_mode_e), ((enum clingo_propagator_undo_mode_e)-1) <= 0),
     "clingo_propagator_undo_mode_default,clingo_propagator_undo_mode_always" },
-  { "clingo_show_type_e", 1319, _cffi_prim_int(sizeof(enum clingo_show_type_e), ((enum clingo_show_type_e)-1) <= 0),
+  { "clingo_show_type_e", 1452, _cffi_prim_int(sizeof(enum clingo_show_type_e), ((enum clingo_show_type_e)-1) <= 0),
     "clingo_show_type_shown,clingo_show_type_atoms,clingo_show_type_terms,clingo_show_type_theory,clingo_show_type_all,clingo_show_type_complement" },
-  { "clingo_solve_event_type_e", 1320, _cffi_prim_int(sizeof(enum clingo_solve_event_type_e), ((enum clingo_solve_event_type_e)-1) <= 0),
+  { "clingo_solve_event_type_e", 1453, _cffi_prim_int(sizeof(enum clingo_solve_event_type_e), ((enum clingo_solve_event_type_e)-1) <= 0),
     "clingo_solve_event_type_model,clingo_solve_event_type_unsat,clingo_solve_event_type_statistics,clingo_solve_event_type_finish" },
-  { "clingo_solve_mode_e", 1321, _cffi_prim_int(sizeof(enum clingo_solve_mode_e), ((enum clingo_solve_mode_e)-1) <= 0),
+  { "clingo_solve_mode_e", 1454, _cffi_prim_int(sizeof(enum clingo_solve_mode_e), ((enum clingo_solve_mode_e)-1) <= 0),
     "clingo_solve_mode_async,clingo_solve_mode_yield" },
-  { "clingo_solve_result_e", 1322, _cffi_prim_int(sizeof(enum clingo_solve_result_e), ((enum clingo_solve_result_e)-1) <= 0),
+  { "clingo_solve_result_e", 1455, _cffi_prim_int(sizeof(enum clingo_solve_result_e), ((enum clingo_solve_result_e)-1) <= 0),
     "clingo_solve_result_satisfiable,clingo_solve_result_unsatisfiable,clingo_solve_result_exhausted,clingo_solve_result_interrupted" },
-  { "clingo_statistics_type_e", 1323, _cffi_prim_int(sizeof(enum clingo_statistics_type_e), ((enum clingo_statistics_type_e)-1) <= 0),
+  { "clingo_statistics_type_e", 1456, _cffi_prim_int(sizeof(enum clingo_statistics_type_e), ((enum clingo_statistics_type_e)-1) <= 0),
     "clingo_statistics_type_empty,clingo_statistics_type_value,clingo_statistics_type_array,clingo_statistics_type_map" },
-  { "clingo_symbol_type_e", 1324, _cffi_prim_int(sizeof(enum clingo_symbol_type_e), ((enum clingo_symbol_type_e)-1) <= 0),
+  { "clingo_symbol_type_e", 1457, _cffi_prim_int(sizeof(enum clingo_symbol_type_e), ((enum clingo_symbol_type_e)-1) <= 0),
     "clingo_symbol_type_infimum,clingo_symbol_type_number,clingo_symbol_type_string,clingo_symbol_type_function,clingo_symbol_type_supremum" },
-  { "clingo_theory_sequence_type_e", 1325, _cffi_prim_int(sizeof(enum clingo_theory_sequence_type_e), ((enum clingo_theory_sequence_type_e)-1) <= 0),
+  { "clingo_theory_sequence_type_e", 1458, _cffi_prim_int(sizeof(enum clingo_theory_sequence_type_e), ((enum clingo_theory_sequence_type_e)-1) <= 0),
     "clingo_theory_sequence_type_tuple,clingo_theory_sequence_type_set,clingo_theory_sequence_type_list" },
-  { "clingo_theory_term_type_e", 1326, _cffi_prim_int(sizeof(enum clingo_theory_term_type_e), ((enum clingo_theory_term_type_e)-1) <= 0),
+  { "clingo_theory_term_type_e", 1459, _cffi_prim_int(sizeof(enum clingo_theory_term_type_e), ((enum clingo_theory_term_type_e)-1) <= 0),
     "clingo_theory_term_type_tuple,clingo_theory_term_type_list,clingo_theory_term_type_set,clingo_theory_term_type_function,clingo_theory_term_type_number,clingo_theory_term_type_symbol" },
-  { "clingo_truth_value_e", 1327, _cffi_prim_int(sizeof(enum clingo_truth_value_e), ((enum clingo_truth_value_e)-1) <= 0),
+  { "clingo_truth_value_e", 1460, _cffi_prim_int(sizeof(enum clingo_truth_value_e), ((enum clingo_truth_value_e)-1) <= 0),
     "clingo_truth_value_free,clingo_truth_value_true,clingo_truth_value_false" },
-  { "clingo_warning_e", 1328, _cffi_prim_int(sizeof(enum clingo_warning_e), ((enum clingo_warning_e)-1) <= 0),
+  { "clingo_warning_e", 1461, _cffi_prim_int(sizeof(enum clingo_warning_e), ((enum clingo_warning_e)-1) <= 0),
     "clingo_warning_operation_undefined,clingo_warning_runtime_error,clingo_warning_atom_undefined,clingo_warning_file_included,clingo_warning_variable_unbounded,clingo_warning_global_variable,clingo_warning_other" },
-  { "clingo_weight_constraint_type_e", 1329, _cffi_prim_int(sizeof(enum clingo_weight_constraint_type_e), ((enum clingo_weight_constraint_type_e)-1) <= 0),
+  { "clingo_weight_constraint_type_e", 1462, _cffi_prim_int(sizeof(enum clingo_weight_constraint_type_e), ((enum clingo_weight_constraint_type_e)-1) <= 0),
     "clingo_weight_constraint_type_implication_left,clingo_weight_constraint_type_implication_right,clingo_weight_constraint_type_equivalence" },
 };
 
 static const struct _cffi_typename_s _cffi_typenames[] = {
-  { "clingo_application_t", 1268 },
-  { "clingo_assignment_t", 1269 },
+  { "clingo_application_t", 1396 },
+  { "clingo_assignment_t", 1397 },
   { "clingo_ast_aggregate_function_t", 155 },
-  { "clingo_ast_argument_t", 1271 },
-  { "clingo_ast_attribute_names_t", 1272 },
+  { "clingo_ast_argument_t", 1399 },
+  { "clingo_ast_attribute_names_t", 1400 },
   { "clingo_ast_attribute_t", 155 },
   { "clingo_ast_attribute_type_t", 155 },
   { "clingo_ast_binary_operator_t", 155 },
   { "clingo_ast_callback_t", 24 },
   { "clingo_ast_comparison_operator_t", 155 },
-  { "clingo_ast_constructor_t", 1274 },
-  { "clingo_ast_constructors_t", 1275 },
+  { "clingo_ast_constructor_t", 1402 },
+  { "clingo_ast_constructors_t", 1403 },
   { "clingo_ast_sign_t", 155 },
-  { "clingo_ast_t", 1276 },
+  { "clingo_ast_t", 1404 },
   { "clingo_ast_theory_atom_definition_type_t", 155 },
   { "clingo_ast_theory_operator_type_t", 155 },
   { "clingo_ast_theory_sequence_type_t", 155 },
@@ -20128,64 +22017,69 @@ static const struct _cffi_typename_s _cffi_typenames[] = {
   { "clingo_ast_unary_operator_t", 155 },
   { "clingo_ast_unpool_type_bitset_t", 155 },
   { "clingo_atom_t", 69 },
-  { "clingo_backend_t", 1277 },
+  { "clingo_backend_t", 1405 },
   { "clingo_backend_type_t", 29 },
   { "clingo_clause_type_t", 155 },
   { "clingo_comment_type_t", 155 },
-  { "clingo_configuration_t", 1278 },
+  { "clingo_configuration_t", 1406 },
   { "clingo_configuration_type_bitset_t", 29 },
   { "clingo_consequence_t", 155 },
-  { "clingo_control_t", 1279 },
-  { "clingo_default_model_printer_t", 607 },
+  { "clingo_control_t", 1407 },
+  { "clingo_default_model_printer_t", 615 },
   { "clingo_error_t", 155 },
   { "clingo_external_type_t", 155 },
-  { "clingo_ground_callback_t", 483 },
-  { "clingo_ground_program_observer_t", 1280 },
+  { "clingo_ground_callback_t", 491 },
+  { "clingo_ground_program_batch_observer_t", 1408 },
+  { "clingo_ground_program_observer_t", 1409 },
   { "clingo_heuristic_type_t", 155 },
   { "clingo_id_t", 69 },
   { "clingo_literal_t", 12 },
-  { "clingo_location_t", 1281 },
+  { "clingo_location_t", 1410 },
   { "clingo_logger_t", 27 },
-  { "clingo_main_function_t", 1237 },
-  { "clingo_model_printer_t", 1243 },
-  { "clingo_model_t", 1282 },
+  { "clingo_main_function_t", 1361 },
+  { "clingo_model_printer_t", 1367 },
+  { "clingo_model_t", 1411 },
   { "clingo_model_type_t", 155 },
-  { "clingo_options_t", 1283 },
-  { "clingo_part_t", 1284 },
-  { "clingo_program_builder_t", 1285 },
-  { "clingo_propagate_control_t", 1286 },
-  { "clingo_propagate_init_t", 1287 },
-  { "clingo_propagator_check_callback_t", 1246 },
+  { "clingo_options_t", 1412 },
+  { "clingo_output_atom_batch_t", 1413 },
+  { "clingo_part_t", 1414 },
+  { "clingo_program_builder_t", 1415 },
+  { "clingo_propagate_control_t", 1416 },
+  { "clingo_propagate_init_t", 1417 },
+  { "clingo_propagator_check_callback_t", 1371 },
   { "clingo_propagator_check_mode_t", 155 },
-  { "clingo_propagator_init_callback_t", 1247 },
-  { "clingo_propagator_propagate_callback_t", 1245 },
-  { "clingo_propagator_t", 1288 },
-  { "clingo_propagator_undo_callback_t", 1332 },
+  { "clingo_propagator_init_callback_t", 1372 },
+  { "clingo_propagator_propagate_callback_t", 1370 },
+  { "clingo_propagator_t", 1418 },
+  { "clingo_propagator_undo_callback_t", 1465 },
   { "clingo_propagator_undo_mode_t", 155 },
-  { "clingo_script_t", 1289 },
+  { "clingo_rule_batch_t", 1419 },
+  { "clingo_script_t", 1420 },
   { "clingo_show_type_bitset_t", 29 },
   { "clingo_signature_t", 246 },
-  { "clingo_solve_control_t", 1290 },
-  { "clingo_solve_event_callback_t", 522 },
+  { "clingo_solve_control_t", 1421 },
+  { "clingo_solve_event_callback_t", 530 },
   { "clingo_solve_event_type_t", 29 },
-  { "clingo_solve_handle_t", 1291 },
+  { "clingo_solve_handle_t", 1422 },
   { "clingo_solve_mode_bitset_t", 29 },
   { "clingo_solve_result_bitset_t", 29 },
-  { "clingo_statistics_t", 1292 },
+  { "clingo_statistics_t", 1423 },
   { "clingo_statistics_type_t", 155 },
-  { "clingo_symbol_callback_t", 578 },
+  { "clingo_symbol_callback_t", 586 },
   { "clingo_symbol_t", 246 },
   { "clingo_symbol_type_t", 155 },
   { "clingo_symbolic_atom_iterator_t", 246 },
-  { "clingo_symbolic_atoms_t", 1293 },
-  { "clingo_theory_atoms_t", 1294 },
+  { "clingo_symbolic_atoms_t", 1424 },
+  { "clingo_theory_atoms_t", 1425 },
+  { "clingo_theory_element_batch_t", 1426 },
   { "clingo_theory_sequence_type_t", 155 },
   { "clingo_theory_term_type_t", 155 },
   { "clingo_truth_value_t", 155 },
   { "clingo_warning_t", 155 },
   { "clingo_weight_constraint_type_t", 155 },
+  { "clingo_weight_rule_batch_t", 1427 },
   { "clingo_weight_t", 12 },
-  { "clingo_weighted_literal_t", 1295 },
+  { "clingo_weighted_literal_t", 1428 },
 };
 
 static const struct _cffi_type_context_s _cffi_type_context = {
@@ -20195,12 +22089,12 @@ static const struct _cffi_type_context_s _cffi_type_context = {
   _cffi_struct_unions,
   _cffi_enums,
   _cffi_typenames,
-  527,  /* num_globals */
-  26,  /* num_struct_unions */
+  552,  /* num_globals */
+  31,  /* num_struct_unions */
   34,  /* num_enums */
-  79,  /* num_typenames */
+  84,  /* num_typenames */
   NULL,  /* no includes */
-  1335,  /* num_types */
+  1468,  /* num_types */
   1,  /* flags */
 };
 
@@ -62,6 +62,19 @@ def _c_call2(c_type1, c_type2, c_fun, *args, handler=None):
     return p_ret1[0], p_ret2[0]
 
 
+def _view(c_array, size: int, c_type: str, fmt: str) -> memoryview:
+    """
+    Helper to create a read-only memoryview of the given number of elements of
+    a C array.
+
+    The view is only valid as long as the underlying array.
+    """
+    if size == 0:
+        return memoryview(b"").cast(fmt)
+    buf = _ffi.buffer(c_array, size * _ffi.sizeof(c_type))
+    return memoryview(buf).cast(fmt).toreadonly()
+
+
 def _to_str(c_str) -> str:
     return _ffi.string(c_str).decode()
 
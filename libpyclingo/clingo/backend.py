@@ -33,11 +33,25 @@ observe the corresponding rule passed to the backend:
 from abc import ABCMeta
 from typing import ContextManager, Optional, Sequence, Tuple
 
-from ._internal import _c_call, _cb_error_handler, _ffi, _handle_error, _lib, _to_str
+from ._internal import (
+    _c_call,
+    _cb_error_handler,
+    _ffi,
+    _handle_error,
+    _lib,
+    _to_str,
+    _view,
+)
 from .core import OrderedEnum, TruthValue
 from .symbol import Symbol
 
-__all__ = ["Backend", "HeuristicType", "Observer", "TheorySequenceType"]
+__all__ = [
+    "Backend",
+    "BatchObserver",
+    "HeuristicType",
+    "Observer",
+    "TheorySequenceType",
+]
 
 
 class TheorySequenceType(OrderedEnum):
@@ -379,6 +393,120 @@ class Observer(metaclass=ABCMeta):
         """
 
 
+class BatchObserver(Observer):
+    """
+    Interface to inspect rules produced during grounding in batches.
+
+    If one of the methods below is implemented, the corresponding directives
+    are collected and passed in batches instead of calling the respective
+    method of the `Observer` interface. This avoids one call per directive.
+
+    The arrays of a batch are passed as flat read-only memoryviews, which can
+    be wrapped with `numpy.frombuffer`, for example. The i-th directive of a
+    batch is described by the elements between the offsets `offsets[i]` and
+    `offsets[i + 1]`. The views are only valid during the call and must not be
+    stored.
+
+    See Also
+    --------
+    clingo.control.Control.register_batch_observer
+    """
+
+    def rules(
+        self,
+        choices: memoryview,
+        head_offsets: memoryview,
+        heads: memoryview,
+        body_offsets: memoryview,
+        bodies: memoryview,
+    ) -> None:
+        """
+        Observe a batch of rules passed to the solver.
+
+        Parameters
+        ----------
+        choices
+            Whether the head of the i-th rule is a choice.
+        head_offsets
+            The offsets of the rule heads.
+        heads
+            The head atoms of all rules.
+        body_offsets
+            The offsets of the rule bodies.
+        bodies
+            The body literals of all rules.
+        """
+
+    def weight_rules(
+        self,
+        choices: memoryview,
+        head_offsets: memoryview,
+        heads: memoryview,
+        lower_bounds: memoryview,
+        body_offsets: memoryview,
+        literals: memoryview,
+        weights: memoryview,
+    ) -> None:
+        """
+        Observe a batch of rules with one weight constraint in the body passed
+        to the solver.
+
+        Parameters
+        ----------
+        choices
+            Whether the head of the i-th rule is a choice.
+        head_offsets
+            The offsets of the rule heads.
+        heads
+            The head atoms of all rules.
+        lower_bounds
+            The lower bound of the weight constraint of the i-th rule.
+        body_offsets
+            The offsets of the weight constraints.
+        literals
+            The literals of the weight constraints of all rules.
+        weights
+            The weights associated with the literals.
+        """
+
+    def output_atoms(self, symbols: Sequence[Symbol], atoms: memoryview) -> None:
+        """
+        Observe a batch of shown atoms passed to the solver.
+
+        Parameters
+        ----------
+        symbols
+            The symbolic representation of the i-th atom.
+        atoms
+            The i-th associated program atom or zero for facts.
+        """
+
+    def theory_elements(
+        self,
+        element_ids: memoryview,
+        term_offsets: memoryview,
+        terms: memoryview,
+        condition_offsets: memoryview,
+        conditions: memoryview,
+    ) -> None:
+        """
+        Observe a batch of theory elements.
+
+        Parameters
+        ----------
+        element_ids
+            The id of the i-th element.
+        term_offsets
+            The offsets of the term tuples.
+        terms
+            The term tuples of all elements.
+        condition_offsets
+            The offsets of the conditions.
+        conditions
+            The condition literals of all elements.
+        """
+
+
 @_ffi.def_extern(
     onerror=_cb_error_handler("data"), name="pyclingo_observer_init_program"
 )
@@ -563,6 +691,75 @@ def _pyclingo_observer_theory_atom_with_guard(
     return True
 
 
+def _offsets(c_offsets, size):
+    return _view(c_offsets, size + 1, "size_t", "N")
+
+
+@_ffi.def_extern(onerror=_cb_error_handler("data"), name="pyclingo_observer_rules")
+def _pyclingo_observer_rules(batch, data):
+    observer: BatchObserver = _ffi.from_handle(data).data
+    head_offsets = _offsets(batch.head_offsets, batch.size)
+    body_offsets = _offsets(batch.body_offsets, batch.size)
+    observer.rules(
+        _view(batch.choices, batch.size, "bool", "?"),
+        head_offsets,
+        _view(batch.heads, head_offsets[-1], "clingo_atom_t", "I"),
+        body_offsets,
+        _view(batch.bodies, body_offsets[-1], "clingo_literal_t", "i"),
+    )
+    return True
+
+
+@_ffi.def_extern(
+    onerror=_cb_error_handler("data"), name="pyclingo_observer_weight_rules"
+)
+def _pyclingo_observer_weight_rules(batch, data):
+    observer: BatchObserver = _ffi.from_handle(data).data
+    head_offsets = _offsets(batch.head_offsets, batch.size)
+    body_offsets = _offsets(batch.body_offsets, batch.size)
+    # weighted literals are stored as interleaved pairs of literals and weights
+    bodies = _view(batch.bodies, body_offsets[-1], "clingo_weighted_literal_t", "i")
+    observer.weight_rules(
+        _view(batch.choices, batch.size, "bool", "?"),
+        head_offsets,
+        _view(batch.heads, head_offsets[-1], "clingo_atom_t", "I"),
+        _view(batch.lower_bounds, batch.size, "clingo_weight_t", "i"),
+        body_offsets,
+        bodies[0::2],
+        bodies[1::2],
+    )
+    return True
+
+
+@_ffi.def_extern(
+    onerror=_cb_error_handler("data"), name="pyclingo_observer_output_atoms"
+)
+def _pyclingo_observer_output_atoms(batch, data):
+    observer: BatchObserver = _ffi.from_handle(data).data
+    observer.output_atoms(
+        [Symbol(sym) for sym in _ffi.unpack(batch.symbols, batch.size)],
+        _view(batch.atoms, batch.size, "clingo_atom_t", "I"),
+    )
+    return True
+
+
+@_ffi.def_extern(
+    onerror=_cb_error_handler("data"), name="pyclingo_observer_theory_elements"
+)
+def _pyclingo_observer_theory_elements(batch, data):
+    observer: BatchObserver = _ffi.from_handle(data).data
+    term_offsets = _offsets(batch.term_offsets, batch.size)
+    condition_offsets = _offsets(batch.condition_offsets, batch.size)
+    observer.theory_elements(
+        _view(batch.element_ids, batch.size, "clingo_id_t", "I"),
+        term_offsets,
+        _view(batch.terms, term_offsets[-1], "clingo_id_t", "I"),
+        condition_offsets,
+        _view(batch.conditions, condition_offsets[-1], "clingo_literal_t", "i"),
+    )
+    return True
+
+
 class Backend(ContextManager["Backend"]):
     """
     Backend object providing a low level interface to extend a logic program.
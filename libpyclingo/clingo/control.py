@@ -68,7 +68,7 @@ from ._internal import (
     _lib,
     _overwritten,
 )
-from .backend import Backend, Observer
+from .backend import Backend, BatchObserver, Observer
 from .configuration import Configuration
 from .core import Logger
 from .propagator import Propagator
@@ -188,6 +188,113 @@ def _pyclingo_ground_callback(
     return True
 
 
+def _c_observer(observer: Observer):
+    """
+    Helper to create the C callbacks of the given observer.
+    """
+    # pylint: disable=line-too-long
+    return _ffi.new(
+        "clingo_ground_program_observer_t*",
+        (
+            (
+                _lib.pyclingo_observer_init_program
+                if _overwritten(Observer, observer, "init_program")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_begin_step
+                if _overwritten(Observer, observer, "begin_step")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_end_step
+                if _overwritten(Observer, observer, "end_step")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_rule
+                if _overwritten(Observer, observer, "rule")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_weight_rule
+                if _overwritten(Observer, observer, "weight_rule")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_minimize
+                if _overwritten(Observer, observer, "minimize")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_project
+                if _overwritten(Observer, observer, "project")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_output_atom
+                if _overwritten(Observer, observer, "output_atom")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_output_term
+                if _overwritten(Observer, observer, "output_term")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_external
+                if _overwritten(Observer, observer, "external")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_assume
+                if _overwritten(Observer, observer, "assume")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_heuristic
+                if _overwritten(Observer, observer, "heuristic")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_acyc_edge
+                if _overwritten(Observer, observer, "acyc_edge")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_theory_term_number
+                if _overwritten(Observer, observer, "theory_term_number")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_theory_term_string
+                if _overwritten(Observer, observer, "theory_term_string")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_theory_term_compound
+                if _overwritten(Observer, observer, "theory_term_compound")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_theory_element
+                if _overwritten(Observer, observer, "theory_element")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_theory_atom
+                if _overwritten(Observer, observer, "theory_atom")
+                else _ffi.NULL
+            ),
+            (
+                _lib.pyclingo_observer_theory_atom_with_guard
+                if _overwritten(Observer, observer, "theory_atom_with_guard")
+                else _ffi.NULL
+            ),
+        ),
+    )
+
+
 class Control:
     """
     Control object for the grounding/solving process.
@@ -577,6 +684,10 @@ class Control:
         search is active, the subsequent call to `Control.solve` is interrupted. The
         result of the `Control.solve` method can be used to query if the search was
         interrupted.
+
+        If called while grounding, the active call to `Control.ground` additionally
+        raises a `RuntimeError`. The program grounded so far is kept but might be
+        incomplete.
         """
         _lib.clingo_control_interrupt(self._rep)
 
@@ -628,103 +739,59 @@ class Control:
         --------
         clingo.backend
         """
-        # pylint: disable=protected-access,line-too-long
-        c_observer = _ffi.new(
-            "clingo_ground_program_observer_t*",
+        c_observer = _c_observer(observer)
+        c_data = _ffi.new_handle(_CBData(observer, self._error))
+        self._mem.append(c_data)
+        _handle_error(
+            _lib.clingo_control_register_observer(
+                self._rep, c_observer, replace, c_data
+            )
+        )
+
+    def register_batch_observer(
+        self, observer: BatchObserver, batch_size: int = 4096, replace: bool = False
+    ) -> None:
+        """
+        Registers the given observer to inspect the produced grounding in
+        batches.
+
+        Parameters
+        ----------
+        observer
+            The observer to register. Directives for which no batch method is
+            implemented are passed to the methods of the `Observer` interface.
+        batch_size
+            The maximum number of directives in a batch.
+        replace
+            If set to true, the output is just passed to the observer and no longer to
+            the underlying solver (or any previously registered observers).
+
+        See Also
+        --------
+        clingo.backend.BatchObserver
+        """
+        c_observer = _c_observer(observer)
+        c_batch = _ffi.new(
+            "clingo_ground_program_batch_observer_t*",
             (
                 (
-                    _lib.pyclingo_observer_init_program
-                    if _overwritten(Observer, observer, "init_program")
-                    else _ffi.NULL
-                ),
-                (
-                    _lib.pyclingo_observer_begin_step
-                    if _overwritten(Observer, observer, "begin_step")
-                    else _ffi.NULL
-                ),
-                (
-                    _lib.pyclingo_observer_end_step
-                    if _overwritten(Observer, observer, "end_step")
+                    _lib.pyclingo_observer_rules
+                    if _overwritten(BatchObserver, observer, "rules")
                     else _ffi.NULL
                 ),
                 (
-                    _lib.pyclingo_observer_rule
-                    if _overwritten(Observer, observer, "rule")
+                    _lib.pyclingo_observer_weight_rules
+                    if _overwritten(BatchObserver, observer, "weight_rules")
                     else _ffi.NULL
                 ),
                 (
-                    _lib.pyclingo_observer_weight_rule
-                    if _overwritten(Observer, observer, "weight_rule")
+                    _lib.pyclingo_observer_output_atoms
+                    if _overwritten(BatchObserver, observer, "output_atoms")
                     else _ffi.NULL
                 ),
                 (
-                    _lib.pyclingo_observer_minimize
-                    if _overwritten(Observer, observer, "minimize")
-                    else _ffi.NULL
-                ),
-                (
-                    _lib.pyclingo_observer_project
-                    if _overwritten(Observer, observer, "project")
-                    else _ffi.NULL
-                ),
-                (
-                    _lib.pyclingo_observer_output_atom
-                    if _overwritten(Observer, observer, "output_atom")
-                    else _ffi.NULL
-                ),
-                (
-                    _lib.pyclingo_observer_output_term
-                    if _overwritten(Observer, observer, "output_term")
-                    else _ffi.NULL
-                ),
-                (
-                    _lib.pyclingo_observer_external
-                    if _overwritten(Observer, observer, "external")
-                    else _ffi.NULL
-                ),
-                (
-                    _lib.pyclingo_observer_assume
-                    if _overwritten(Observer, observer, "assume")
-                    else _ffi.NULL
-                ),
-                (
-                    _lib.pyclingo_observer_heuristic
-                    if _overwritten(Observer, observer, "heuristic")
-                    else _ffi.NULL
-                ),
-                (
-                    _lib.pyclingo_observer_acyc_edge
-                    if _overwritten(Observer, observer, "acyc_edge")
-                    else _ffi.NULL
-                ),
-                (
-                    _lib.pyclingo_observer_theory_term_number
-                    if _overwritten(Observer, observer, "theory_term_number")
-                    else _ffi.NULL
-                ),
-                (
-                    _lib.pyclingo_observer_theory_term_string
-                    if _overwritten(Observer, observer, "theory_term_string")
-                    else _ffi.NULL
-                ),
-                (
-                    _lib.pyclingo_observer_theory_term_compound
-                    if _overwritten(Observer, observer, "theory_term_compound")
-                    else _ffi.NULL
-                ),
-                (
-                    _lib.pyclingo_observer_theory_element
-                    if _overwritten(Observer, observer, "theory_element")
-                    else _ffi.NULL
-                ),
-                (
-                    _lib.pyclingo_observer_theory_atom
-                    if _overwritten(Observer, observer, "theory_atom")
-                    else _ffi.NULL
-                ),
-                (
-                    _lib.pyclingo_observer_theory_atom_with_guard
-                    if _overwritten(Observer, observer, "theory_atom_with_guard")
+                    _lib.pyclingo_observer_theory_elements
+                    if _overwritten(BatchObserver, observer, "theory_elements")
                     else _ffi.NULL
                 ),
             ),
@@ -732,8 +799,8 @@ class Control:
         c_data = _ffi.new_handle(_CBData(observer, self._error))
         self._mem.append(c_data)
         _handle_error(
-            _lib.clingo_control_register_observer(
-                self._rep, c_observer, replace, c_data
+            _lib.clingo_control_register_batch_observer(
+                self._rep, c_observer, c_batch, batch_size, replace, c_data
             )
         )
 
@@ -922,7 +922,7 @@ def _pyclingo_propagator_init(init, data):
 )
 def _pyclingo_propagator_propagate(control, changes, size, data):
     propagator = _ffi.from_handle(data).data
-    py_changes = [changes[i] for i in range(size)]
+    py_changes = _ffi.unpack(changes, size)
     propagator.propagate(PropagateControl(control), py_changes)
     return True
 
@@ -930,7 +930,7 @@ def _pyclingo_propagator_propagate(control, changes, size, data):
 @_ffi.def_extern(onerror=_cb_error_handler("data"), name="pyclingo_propagator_undo")
 def _pyclingo_propagator_undo(control, changes, size, data):
     propagator = _ffi.from_handle(data).data
-    py_changes = [changes[i] for i in range(size)]
+    py_changes = _ffi.unpack(changes, size)
     ctl = PropagateControl(control)
     propagator.undo(ctl.thread_id, ctl.assignment, py_changes)
 
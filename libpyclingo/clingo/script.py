@@ -171,7 +171,7 @@ def _pyclingo_script_call(
     symbol_callback = _ffi.cast("clingo_symbol_callback_t", symbol_callback)
     arguments = _ffi.cast("clingo_symbol_t*", arguments)
     py_name = _ffi.string(name).decode()
-    py_args = [Symbol(arguments[i]) for i in range(size)]
+    py_args = [Symbol(arg) for arg in _ffi.unpack(arguments, size)]
 
     ret = script.call(_py_location(location), py_name, py_args)
     symbols = list(ret) if isinstance(ret, IterableABC) else [ret]
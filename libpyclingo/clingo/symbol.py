@@ -107,13 +107,15 @@ class Symbol:
         assert self.type == SymbolType.Function
         return f"Function({self.name!r}, {self.arguments!r}, {self.positive!r})"
 
+    # Symbols are unique, so hashing and equality work directly on their
+    # representation without calling into the library.
     def __hash__(self) -> int:
-        return _lib.clingo_symbol_hash(self._rep)
+        return hash(self._rep)
 
     def __eq__(self, other: object) -> bool:
         if not isinstance(other, Symbol):
             return NotImplemented
-        return _lib.clingo_symbol_is_equal_to(self._rep, other._rep)
+        return self._rep == other._rep
 
     def __lt__(self, other: object) -> bool:
         if not isinstance(other, Symbol):
@@ -154,7 +156,7 @@ class Symbol:
         args, size = _c_call2(
             "clingo_symbol_t*", "size_t", _lib.clingo_symbol_arguments, self._rep
         )
-        return [Symbol(args[i]) for i in range(size)]
+        return [Symbol(arg) for arg in _ffi.unpack(args, size)]
 
     @property
     def name(self) -> str:
@@ -6,6 +6,7 @@ from typing import Sequence, Tuple
 from unittest import TestCase
 
 from clingo import (
+    BatchObserver,
     Control,
     Function,
     HeuristicType,
@@ -166,6 +167,68 @@ class TestObserverTheoryWithGuard(Observer):
         self._case.assertEqual(len(elements), 0)
 
 
+class TestBatchObserver(BatchObserver):
+    """
+    Test batch observer.
+    """
+
+    def __init__(self):
+        self.sizes = []
+        self.rules_ = []
+        self.weight_rules_ = []
+        self.output_atoms_ = []
+        self.theory_elements_ = []
+
+    def rules(self, choices, head_offsets, heads, body_offsets, bodies) -> None:
+        self.sizes.append(len(choices))
+        for i, choice in enumerate(choices):
+            self.rules_.append(
+                (
+                    choice,
+                    heads[head_offsets[i] : head_offsets[i + 1]].tolist(),
+                    bodies[body_offsets[i] : body_offsets[i + 1]].tolist(),
+                )
+            )
+
+    def weight_rules(
+        self,
+        choices,
+        head_offsets,
+        heads,
+        lower_bounds,
+        body_offsets,
+        literals,
+        weights,
+    ) -> None:
+        for i, choice in enumerate(choices):
+            body = range(body_offsets[i], body_offsets[i + 1])
+            self.weight_rules_.append(
+                (
+                    choice,
+                    heads[head_offsets[i] : head_offsets[i + 1]].tolist(),
+                    lower_bounds[i],
+                    [(literals[j], weights[j]) for j in body],
+                )
+            )
+
+    def output_atoms(self, symbols, atoms) -> None:
+        self.output_atoms_.extend(symbols)
+
+    def theory_elements(
+        self, element_ids, term_offsets, terms, condition_offsets, conditions
+    ) -> None:
+        for i, element_id in enumerate(element_ids):
+            self.theory_elements_.append(
+                (
+                    element_id,
+                    terms[term_offsets[i] : term_offsets[i + 1]].tolist(),
+                    conditions[
+                        condition_offsets[i] : condition_offsets[i + 1]
+                    ].tolist(),
+                )
+            )
+
+
 class TestBackend(TestCase):
     """
     Tests basic solving and related functions.
@@ -203,6 +266,37 @@ class TestBackend(TestCase):
         ctl.solve()
         self.assertIn("end_step", obs.called)
 
+    def test_batch_observer(self):
+        """
+        Test batch observer via backend.
+        """
+        ctl = Control()
+        obs = TestBatchObserver()
+        ctl.register_batch_observer(obs, 2)
+        with ctl.backend() as backend:
+            atm_a = backend.add_atom(Function("a"))
+            atm_b = backend.add_atom(Function("b"))
+            backend.add_rule([atm_a, atm_b], [], True)
+            backend.add_rule([atm_a], [atm_b])
+            backend.add_rule([atm_b], [-atm_a])
+            backend.add_weight_rule([atm_a], 1, [(atm_b, 2)])
+            num = backend.add_theory_term_number(1)
+            elem = backend.add_theory_element([num], [atm_a, -atm_b])
+            backend.add_theory_atom(backend.add_theory_term_string("t"), [elem], 0)
+        ctl.solve()
+        self.assertEqual(obs.sizes, [2, 1])
+        self.assertEqual(
+            obs.rules_,
+            [
+                (True, [atm_a, atm_b], []),
+                (False, [atm_a], [atm_b]),
+                (False, [atm_b], [-atm_a]),
+            ],
+        )
+        self.assertEqual(obs.weight_rules_, [(False, [atm_a], 1, [(atm_b, 2)])])
+        self.assertEqual(sorted(obs.output_atoms_), [Function("a"), Function("b")])
+        self.assertEqual(obs.theory_elements_, [(elem, [num], [atm_a, -atm_b])])
+
     def test_theory(self):
         """
         Test observer via grounding.
@@ -60,6 +60,12 @@ class TestSymbol(TestCase):
         self.assertNotEqual(hash(Number(1)), hash(Number(2)))
         self.assertTrue(Number(10) == Number(10))
         self.assertTrue(Number(1) != Number(2))
+        self.assertEqual(
+            hash(Function("f", [String("a")])), hash(Function("f", [String("a")]))
+        )
+        self.assertTrue(Function("f", [String("a")]) == Function("f", [String("a")]))
+        self.assertTrue(Function("f", [String("a")]) != Function("f", [String("b")]))
+        self.assertFalse(Number(1) == 1)
         self.assertTrue(Number(1) < Number(2))
         self.assertFalse(Number(2) < Number(1))
         self.assertTrue(Number(2) > Number(1))
@@ -239,6 +239,19 @@ def generate_c(action):
     cnt.append(
         'extern "Python" bool pyclingo_observer_theory_atom_with_guard(clingo_id_t atom_id_or_zero, clingo_id_t term_id, clingo_id_t const *elements, size_t size, clingo_id_t operator_id, clingo_id_t right_hand_side_id, void *data);'
     )
+    # batch observer callbacks
+    cnt.append(
+        'extern "Python" bool pyclingo_observer_rules(clingo_rule_batch_t const *batch, void *data);'
+    )
+    cnt.append(
+        'extern "Python" bool pyclingo_observer_weight_rules(clingo_weight_rule_batch_t const *batch, void *data);'
+    )
+    cnt.append(
+        'extern "Python" bool pyclingo_observer_output_atoms(clingo_output_atom_batch_t const *batch, void *data);'
+    )
+    cnt.append(
+        'extern "Python" bool pyclingo_observer_theory_elements(clingo_theory_element_batch_t const *batch, void *data);'
+    )
     # application callbacks
     cnt.append(
         'extern "Python" char const *pyclingo_application_program_name(void *data);'